@@ -23,6 +23,11 @@ class API {
                                    // recursive verifier) or is it for an ivc verifier?
         bool write_vk{ false };    // should we addditionally write the verification key when writing the proof
         bool include_gates_per_opcode{ false }; // should we include gates_per_opcode in the gates command output
+        std::filesystem::path pk_cache_path{ "" }; // directory of the proving key cache; no caching if empty
+        size_t sumcheck_memory_budget{ 0 };        // bytes for the sumcheck partial evaluation table; unbounded if 0
+        size_t fixed_base_table_points{ 0 };        // size of the CRS prefix with a fixed-base table; none if 0
+        size_t fixed_base_table_memory_budget{ 0 }; // bytes for the fixed-base table; full depth if 0
+        bool mmap_crs{ false };                     // map pre-converted CRS point tables kept in the CRS directory
 
         friend std::ostream& operator<<(std::ostream& os, const Flags& flags)
         {
@@ -41,6 +46,11 @@ class API {
                << "  verifier_type: " << flags.verifier_type << "\n"
                << "  write_vk " << flags.write_vk << "\n"
                << "  include_gates_per_opcode " << flags.include_gates_per_opcode << "\n"
+               << "  pk_cache_path: " << flags.pk_cache_path << "\n"
+               << "  sumcheck_memory_budget: " << flags.sumcheck_memory_budget << "\n"
+               << "  fixed_base_table_points: " << flags.fixed_base_table_points << "\n"
+               << "  fixed_base_table_memory_budget: " << flags.fixed_base_table_memory_budget << "\n"
+               << "  mmap_crs: " << flags.mmap_crs << "\n"
                << "]" << std::endl;
             return os;
         }
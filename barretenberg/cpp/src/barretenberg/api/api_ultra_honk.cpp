@@ -3,7 +3,9 @@
 #include "barretenberg/api/acir_format_getters.hpp"
 #include "barretenberg/api/gate_count.hpp"
 #include "barretenberg/api/get_bn254_crs.hpp"
+#include "barretenberg/api/get_bytecode.hpp"
 #include "barretenberg/api/init_srs.hpp"
+#include "barretenberg/api/proving_key_cache.hpp"
 #include "barretenberg/api/write_prover_output.hpp"
 #include "barretenberg/common/map.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
@@ -14,12 +16,11 @@
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
-namespace bb {
+#include <mutex>
 
-extern std::string CRS_PATH;
+namespace bb {
 
-template <typename Flavor, typename Circuit = typename Flavor::CircuitBuilder>
-Circuit _compute_circuit(const std::string& bytecode_path, const std::string& witness_path)
+template <typename Flavor> uint32_t _get_honk_recursion()
 {
     uint32_t honk_recursion = 0;
     if constexpr (IsAnyOf<Flavor, UltraFlavor, UltraKeccakFlavor, UltraKeccakZKFlavor>) {
@@ -32,12 +33,17 @@ Circuit _compute_circuit(const std::string& bytecode_path, const std::string& wi
         honk_recursion = 1;
     }
 #endif
+    return honk_recursion;
+}
 
+template <typename Flavor, typename Circuit = typename Flavor::CircuitBuilder>
+Circuit _compute_circuit(std::vector<uint8_t> bytecode, const std::string& witness_path)
+{
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1180): Don't init grumpkin crs when unnecessary.
     init_grumpkin_crs(1 << CONST_ECCVM_LOG_N);
 
-    const acir_format::ProgramMetadata metadata{ .honk_recursion = honk_recursion };
-    acir_format::AcirProgram program{ get_constraint_system(bytecode_path) };
+    const acir_format::ProgramMetadata metadata{ .honk_recursion = _get_honk_recursion<Flavor>() };
+    acir_format::AcirProgram program{ acir_format::circuit_buf_to_acir_format(std::move(bytecode)) };
 
     if (!witness_path.empty()) {
         program.witness = get_witness(witness_path);
@@ -45,9 +51,42 @@ Circuit _compute_circuit(const std::string& bytecode_path, const std::string& wi
     return acir_format::create_circuit<Circuit>(program, metadata);
 }
 
-template <typename Flavor>
-UltraProver_<Flavor> _compute_prover(const std::string& bytecode_path, const std::string& witness_path)
+namespace {
+std::shared_ptr<CommitmentKey<curve::BN254>> bn254_commitment_key;
+std::mutex bn254_commitment_key_mutex;
+
+/**
+ * @brief Get a commitment key for a circuit of the given size, reusing the previous one if it is large enough
+ * @details Constructing a commitment key allocates the pippenger scratch space for its full size, so a long running
+ * process (e.g. `bb serve`) keeps the last key and hands it to every prover that fits in it. The key is rebuilt when
+ * the global CRS has been replaced. Getting the key is thread-safe, but a key must not be used by two provers at once:
+ * the prover server executes its prove and write_vk requests one at a time.
+ */
+std::shared_ptr<CommitmentKey<curve::BN254>> get_bn254_commitment_key(const size_t circuit_size)
+{
+    std::unique_lock lock(bn254_commitment_key_mutex);
+    if (!bn254_commitment_key || bn254_commitment_key->dyadic_size < circuit_size ||
+        bn254_commitment_key->crs_factory != srs::get_bn254_crs_factory()) {
+        bn254_commitment_key = std::make_shared<CommitmentKey<curve::BN254>>(circuit_size);
+    }
+    return bn254_commitment_key;
+}
+} // namespace
+
+/**
+ * @brief Construct the prover of a circuit, together with its VK if that comes for free
+ * @details If pk_cache_path is not empty, the witness-independent polynomials of the proving key and the VK are loaded
+ * from the proving key cache at that path, or computed and stored there on a miss (see ProvingKeyCache). The returned
+ * VK is null if the cache is disabled.
+ */
+template <typename Flavor, typename VK = typename Flavor::VerificationKey>
+std::pair<UltraProver_<Flavor>, std::shared_ptr<VK>> _compute_prover(const std::string& bytecode_path,
+                                                                     const std::string& witness_path,
+                                                                     const std::filesystem::path& pk_cache_path)
 {
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using Cache = ProvingKeyCache<Flavor>;
+
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1303): This is only needed to construct a vk for an
     // AVM2 goblinized recursive verifier circuit and can be removed once that circuit can be constructed efficiently
     // based on mock inputs.
@@ -56,30 +95,64 @@ UltraProver_<Flavor> _compute_prover(const std::string& bytecode_path, const std
         init_bn254_crs(1 << 23);
     }
 
-    auto prover = UltraProver_<Flavor>{ _compute_circuit<Flavor>(bytecode_path, witness_path) };
+    auto bytecode = get_bytecode(bytecode_path);
+    std::optional<Cache> cache;
+    std::optional<typename Cache::Entry> entry;
+    if (!pk_cache_path.empty()) {
+        cache.emplace(pk_cache_path, bytecode, _get_honk_recursion<Flavor>());
+        entry = cache->load();
+    }
+
+    std::shared_ptr<DeciderProvingKey> proving_key;
+    {
+        auto circuit = _compute_circuit<Flavor>(bytecode, witness_path);
+        proving_key = std::make_shared<DeciderProvingKey>(
+            circuit, TraceSettings{}, nullptr, entry ? entry->polynomials : nullptr);
+    }
+    if (entry && !Cache::matches(*entry, *proving_key)) {
+        info("Ignoring a proving key cache entry that does not match the circuit.");
+        entry.reset();
+        auto circuit = _compute_circuit<Flavor>(std::move(bytecode), witness_path);
+        proving_key = std::make_shared<DeciderProvingKey>(circuit);
+    }
+    auto prover = UltraProver_<Flavor>{ proving_key };
 
     size_t required_crs_size = prover.proving_key->proving_key.circuit_size;
     if constexpr (Flavor::HasZK) {
         required_crs_size = std::max(required_crs_size, curve::BN254::SUBGROUP_SIZE * 2);
     }
     init_bn254_crs(required_crs_size);
-    return prover;
+    prover.commitment_key = get_bn254_commitment_key(prover.proving_key->proving_key.circuit_size);
+    prover.proving_key->proving_key.commitment_key = prover.commitment_key;
+
+    std::shared_ptr<VK> vk;
+    if (entry) {
+        vk = entry->verification_key;
+    } else if (cache) {
+        vk = std::make_shared<VK>(prover.proving_key->proving_key);
+        cache->store(*prover.proving_key, *vk);
+    }
+    return { std::move(prover), vk };
 }
 
 template <typename Flavor, typename VK = typename Flavor::VerificationKey>
 PubInputsProofAndKey<VK> _compute_vk(const std::filesystem::path& bytecode_path,
-                                     const std::filesystem::path& witness_path)
+                                     const std::filesystem::path& witness_path,
+                                     const std::filesystem::path& pk_cache_path)
 {
-    auto prover = _compute_prover<Flavor>(bytecode_path.string(), witness_path.string());
-    return { PublicInputsVector{}, HonkProof{}, std::make_shared<VK>(prover.proving_key->proving_key) };
+    auto [prover, vk] = _compute_prover<Flavor>(bytecode_path.string(), witness_path.string(), pk_cache_path);
+    return { PublicInputsVector{}, HonkProof{}, vk ? vk : std::make_shared<VK>(prover.proving_key->proving_key) };
 }
 
 template <typename Flavor, typename VK = typename Flavor::VerificationKey>
 PubInputsProofAndKey<VK> _prove(const bool compute_vk,
                                 const std::filesystem::path& bytecode_path,
-                                const std::filesystem::path& witness_path)
+                                const std::filesystem::path& witness_path,
+                                const std::filesystem::path& pk_cache_path,
+                                const size_t sumcheck_memory_budget)
 {
-    auto prover = _compute_prover<Flavor>(bytecode_path.string(), witness_path.string());
+    auto [prover, vk] = _compute_prover<Flavor>(bytecode_path.string(), witness_path.string(), pk_cache_path);
+    prover.sumcheck_memory_budget = sumcheck_memory_budget;
     HonkProof concat_pi_and_proof = prover.construct_proof();
     size_t num_inner_public_inputs = prover.proving_key->proving_key.num_public_inputs;
     // Loose check that the public inputs contain a pairing point accumulator, doesn't catch everything.
@@ -101,7 +174,7 @@ PubInputsProofAndKey<VK> _prove(const bool compute_vk,
     };
     return { public_inputs_and_proof.public_inputs,
              public_inputs_and_proof.proof,
-             compute_vk ? std::make_shared<VK>(prover.proving_key->proving_key) : nullptr };
+             compute_vk ? (vk ? vk : std::make_shared<VK>(prover.proving_key->proving_key)) : nullptr };
 }
 
 template <typename Flavor>
@@ -113,8 +186,7 @@ bool _verify(const bool ipa_accumulation,
     using VerificationKey = typename Flavor::VerificationKey;
     using Verifier = UltraVerifier_<Flavor>;
 
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
+    init_bn254_verifier_crs();
 
     auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
     auto public_inputs = many_from_buffer<bb::fr>(read_file(public_inputs_path));
@@ -176,18 +248,24 @@ void UltraHonkAPI::prove(const Flags& flags,
     };
 
     if (flags.ipa_accumulation) {
-        _write(_prove<UltraRollupFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraRollupFlavor>(
+            flags.write_vk, bytecode_path, witness_path, flags.pk_cache_path, flags.sumcheck_memory_budget));
     } else if (flags.oracle_hash_type == "poseidon2") {
-        _write(_prove<UltraFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraFlavor>(
+            flags.write_vk, bytecode_path, witness_path, flags.pk_cache_path, flags.sumcheck_memory_budget));
     } else if (flags.oracle_hash_type == "keccak" && !flags.zk) {
-        _write(_prove<UltraKeccakFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraKeccakFlavor>(
+            flags.write_vk, bytecode_path, witness_path, flags.pk_cache_path, flags.sumcheck_memory_budget));
     } else if (flags.oracle_hash_type == "keccak" && flags.zk) {
-        _write(_prove<UltraKeccakZKFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraKeccakZKFlavor>(
+            flags.write_vk, bytecode_path, witness_path, flags.pk_cache_path, flags.sumcheck_memory_budget));
 #ifdef STARKNET_GARAGA_FLAVORS
     } else if (flags.oracle_hash_type == "starknet" && !flags.zk) {
-        _write(_prove<UltraStarknetFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraStarknetFlavor>(
+            flags.write_vk, bytecode_path, witness_path, flags.pk_cache_path, flags.sumcheck_memory_budget));
     } else if (flags.oracle_hash_type == "starknet" && flags.zk) {
-        _write(_prove<UltraStarknetZKFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraStarknetZKFlavor>(
+            flags.write_vk, bytecode_path, witness_path, flags.pk_cache_path, flags.sumcheck_memory_budget));
 #endif
     } else {
         throw_or_abort("Invalid proving options specified in _prove");
@@ -243,19 +321,19 @@ void UltraHonkAPI::write_vk(const Flags& flags,
     const auto _write = [&](auto&& _prove_output) { write(_prove_output, flags.output_format, "vk", output_path); };
 
     if (flags.ipa_accumulation) {
-        _write(_compute_vk<UltraRollupFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraRollupFlavor>(bytecode_path, "", flags.pk_cache_path));
     } else if (flags.oracle_hash_type == "poseidon2") {
-        _write(_compute_vk<UltraFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraFlavor>(bytecode_path, "", flags.pk_cache_path));
     } else if (flags.oracle_hash_type == "keccak" && !flags.zk) {
-        _write(_compute_vk<UltraKeccakFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraKeccakFlavor>(bytecode_path, "", flags.pk_cache_path));
 #ifdef STARKNET_GARAGA_FLAVORS
     } else if (flags.oracle_hash_type == "starknet" && !flags.zk) {
-        _write(_compute_vk<UltraStarknetFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraStarknetFlavor>(bytecode_path, "", flags.pk_cache_path));
     } else if (flags.oracle_hash_type == "starknet" && flags.zk) {
-        _write(_compute_vk<UltraStarknetZKFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraStarknetZKFlavor>(bytecode_path, "", flags.pk_cache_path));
 #endif
     } else if (flags.oracle_hash_type == "keccak" && flags.zk) {
-        _write(_compute_vk<UltraKeccakZKFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraKeccakZKFlavor>(bytecode_path, "", flags.pk_cache_path));
     } else {
         throw_or_abort("Invalid proving options specified in _prove");
     }
@@ -1,11 +1,66 @@
 #include "init_srs.hpp"
+#include "barretenberg/srs/factories/fixed_base_prover_crs.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include "barretenberg/srs/factories/mmap_prover_crs.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include "get_bn254_crs.hpp"
 #include "get_grumpkin_crs.hpp"
 
+#include <functional>
+#include <mutex>
+
 namespace bb {
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 
+namespace {
+// The global CRS factories last installed by this file, and their number of prover points (zero for a verifier-only
+// factory). A long running process (e.g. `bb serve`) initializes the CRSs once per request, and keeps the resident CRS
+// (and the commitment keys built from it) unless a larger one is needed. Other code may replace the global factories
+// (e.g. the UltraPlonk API installs a verifier-only one), so a resident CRS is only reused while it is still installed.
+std::shared_ptr<srs::factories::CrsFactory<curve::BN254>> bn254_crs_factory;
+size_t bn254_crs_num_points = 0;
+std::shared_ptr<srs::factories::CrsFactory<curve::Grumpkin>> grumpkin_crs_factory;
+size_t grumpkin_crs_num_points = 0;
+CrsOptions crs_options;
+std::mutex crs_mutex;
+
+/**
+ * @brief Map the pre-converted point table of a CRS, creating it from the raw points if it is missing or too small
+ * @details Once the point table exists, starting a prover only maps it, and concurrent bb processes share its pages
+ * through the page cache. Returns nullptr (after loading the raw points into `points`) if point tables are disabled
+ * (see CrsOptions::map_point_tables) or the point table cannot be written or mapped, in which case the caller falls
+ * back to an in-memory CRS.
+ */
+template <typename Curve>
+std::shared_ptr<srs::factories::ProverCrs<Curve>> get_mapped_prover_crs(
+    std::string const& point_table_path,
+    size_t num_points,
+    std::vector<typename Curve::AffineElement>& points,
+    const std::function<std::vector<typename Curve::AffineElement>()>& get_points)
+{
+    using srs::factories::MmapProverCrs;
+    if (!crs_options.map_point_tables) {
+        points = get_points();
+        return nullptr;
+    }
+    auto prover_crs = MmapProverCrs<Curve>::open(point_table_path, num_points);
+    if (prover_crs) {
+        return prover_crs;
+    }
+    points = get_points();
+    if (srs::factories::write_point_table_file<Curve>(point_table_path, points)) {
+        prover_crs = MmapProverCrs<Curve>::open(point_table_path, num_points);
+    }
+    return prover_crs;
+}
+} // namespace
+
+void set_crs_options(const CrsOptions& options)
+{
+    std::unique_lock lock(crs_mutex);
+    crs_options = options;
+}
+
 std::string getHomeDir()
 {
     char* home = std::getenv("HOME");
@@ -20,9 +75,46 @@ std::string getHomeDir()
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    const size_t num_points = dyadic_circuit_size + 1;
+    std::unique_lock lock(crs_mutex);
+    if (num_points <= bn254_crs_num_points && srs::get_bn254_crs_factory() == bn254_crs_factory) {
+        return;
+    }
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    std::vector<g1::affine_element> bn254_g1_data;
+    std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> prover_crs = get_mapped_prover_crs<curve::BN254>(
+        CRS_PATH + "/bn254_point_table.dat", num_points, bn254_g1_data, [&]() {
+            return get_bn254_g1_data(CRS_PATH, num_points);
+        });
+    if (!prover_crs) {
+        prover_crs = std::make_shared<srs::factories::MemProverCrs<curve::BN254>>(bn254_g1_data);
+    }
+    if (crs_options.bn254_fixed_base_table.num_points > 0) {
+        auto fixed_base_table = srs::factories::load_or_compute_fixed_base_table<curve::BN254>(
+            CRS_PATH, prover_crs->get_monomial_points(), crs_options.bn254_fixed_base_table);
+        if (fixed_base_table) {
+            prover_crs = std::make_shared<srs::factories::FixedBaseProverCrs<curve::BN254>>(
+                std::move(prover_crs), std::move(fixed_base_table));
+        }
+    }
+    srs::init_crs_factory_with_prover_crs(prover_crs, bn254_g2_data);
+    bn254_crs_factory = srs::get_bn254_crs_factory();
+    bn254_crs_num_points = num_points;
+}
+
+/**
+ * @brief Initialize the global crs_factory for bn254 verification, which only needs the g2 point
+ * @details A prover crs, which also holds the g2 point, is kept if one has already been initialized.
+ */
+void init_bn254_verifier_crs()
+{
+    std::unique_lock lock(crs_mutex);
+    if (bn254_crs_factory && srs::get_bn254_crs_factory() == bn254_crs_factory) {
+        return;
+    }
+    srs::init_crs_factory({}, get_bn254_g2_data(CRS_PATH));
+    bn254_crs_factory = srs::get_bn254_crs_factory();
+    bn254_crs_num_points = 0;
 }
 
 /**
@@ -33,7 +125,22 @@ void init_bn254_crs(size_t dyadic_circuit_size)
  */
 void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 {
-    auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, eccvm_dyadic_circuit_size + 1);
-    srs::init_grumpkin_crs_factory(grumpkin_g1_data);
+    const size_t num_points = eccvm_dyadic_circuit_size + 1;
+    std::unique_lock lock(crs_mutex);
+    if (num_points <= grumpkin_crs_num_points && srs::get_grumpkin_crs_factory() == grumpkin_crs_factory) {
+        return;
+    }
+    std::vector<curve::Grumpkin::AffineElement> grumpkin_g1_data;
+    auto prover_crs = get_mapped_prover_crs<curve::Grumpkin>(
+        CRS_PATH + "/grumpkin_point_table.dat", num_points, grumpkin_g1_data, [&]() {
+            return get_grumpkin_g1_data(CRS_PATH, num_points);
+        });
+    if (prover_crs) {
+        srs::init_grumpkin_crs_factory_with_prover_crs(prover_crs);
+    } else {
+        srs::init_grumpkin_crs_factory(grumpkin_g1_data);
+    }
+    grumpkin_crs_factory = srs::get_grumpkin_crs_factory();
+    grumpkin_crs_num_points = num_points;
 }
 } // namespace bb
@@ -1,10 +1,28 @@
 #pragma once
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include <cstddef>
 #include <string>
 
 namespace bb {
 std::string getHomeDir();
 
+/**
+ * @brief Options of the prover CRSs initialized by init_bn254_crs and init_grumpkin_crs
+ */
+struct CrsOptions {
+    // Keep a pre-converted point table of each CRS in the CRS directory (twice the size of the raw points) and map it,
+    // rather than loading and converting the raw points in every process
+    bool map_point_tables = false;
+    // Precompute a fixed-base table of a prefix of the bn254 CRS, persisted in the CRS directory (disabled if its
+    // num_points is zero)
+    scalar_multiplication::FixedBaseTableConfig bn254_fixed_base_table;
+};
+
+/**
+ * @brief Set the options of the prover CRSs initialized from now on
+ */
+void set_crs_options(const CrsOptions& options);
+
 /**
  * @brief Initialize the global crs_factory for bn254 based on a known dyadic circuit size
  *
@@ -12,6 +30,11 @@ std::string getHomeDir();
  */
 void init_bn254_crs(size_t dyadic_circuit_size);
 
+/**
+ * @brief Initialize the global crs_factory for bn254 verification, unless a prover crs is already initialized
+ */
+void init_bn254_verifier_crs();
+
 /**
  * @brief Initialize the global crs_factory for grumpkin based on a known dyadic circuit size
  * @details Grumpkin crs is required only for the ECCVM
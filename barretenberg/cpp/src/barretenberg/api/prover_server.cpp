@@ -0,0 +1,383 @@
+#ifndef __wasm__
+#include "prover_server.hpp"
+#include "barretenberg/api/api_ultra_honk.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace bb {
+
+namespace {
+constexpr size_t READ_CHUNK_SIZE = 1 << 16;
+
+void check_server_options(const ProofSystemOptions& options)
+{
+    if (options.scheme != "ultra_honk") {
+        throw_or_abort("The prover server only supports --scheme ultra_honk, got " + options.scheme);
+    }
+}
+
+void check_server_output_path(const std::string& output_path)
+{
+    // In stream mode, stdout carries the responses
+    if (output_path == "-") {
+        throw_or_abort("The prover server cannot write its outputs to stdout.");
+    }
+}
+} // namespace
+
+API::Flags ProofSystemOptions::to_flags() const
+{
+    API::Flags flags{};
+    flags.scheme = scheme;
+    flags.oracle_hash_type = oracle_hash_type;
+    flags.output_format = output_format;
+    flags.zk = zk;
+    flags.ipa_accumulation = ipa_accumulation;
+    return flags;
+}
+
+/**
+ * @brief A request stream, together with the number of its requests that are yet to be answered
+ */
+struct ProverServer::Connection {
+    int input_fd;
+    int output_fd;
+    std::mutex mutex;
+    std::condition_variable idle_condition;
+    size_t num_pending = 0;
+
+    Connection(int input_fd, int output_fd)
+        : input_fd(input_fd)
+        , output_fd(output_fd)
+    {}
+
+    void send(const msgpack::sbuffer& buffer)
+    {
+        std::unique_lock lock(mutex);
+        size_t offset = 0;
+        while (offset < buffer.size()) {
+            const ssize_t written = ::write(output_fd, buffer.data() + offset, buffer.size() - offset);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                // The client went away; its outstanding requests still run to completion
+                info("Failed to send a prover server response: ", std::strerror(errno));
+                return;
+            }
+            offset += static_cast<size_t>(written);
+        }
+    }
+
+    void start_request()
+    {
+        std::unique_lock lock(mutex);
+        num_pending++;
+    }
+
+    void finish_request()
+    {
+        std::unique_lock lock(mutex);
+        if (--num_pending == 0) {
+            idle_condition.notify_all();
+        }
+    }
+
+    void wait_until_idle()
+    {
+        std::unique_lock lock(mutex);
+        idle_condition.wait(lock, [this] { return num_pending == 0; });
+    }
+};
+
+ProverServer::ProverServer(size_t max_concurrent_requests, std::filesystem::path pk_cache_path)
+    : max_concurrent_requests(std::max<size_t>(max_concurrent_requests, 1))
+    , pk_cache_path(std::move(pk_cache_path))
+{
+    // Proving and writing VKs share the resident commitment key (and its pippenger scratch space), so they get an
+    // exclusive execution context. Verifications share a context, so they never overlap a prove or write_vk and only
+    // run concurrently with each other. That, and parallel_for admitting concurrent callers, is what lets IPA
+    // verifications run their MSMs without a lock of their own.
+    register_handler<ProveRequest>(PROVE, &ProverServer::prove, /*unique=*/true);
+    register_handler<WriteVkRequest>(WRITE_VK, &ProverServer::write_vk, /*unique=*/true);
+    register_handler<VerifyRequest>(VERIFY, &ProverServer::verify, /*unique=*/false);
+
+    workers.reserve(this->max_concurrent_requests);
+    for (size_t i = 0; i < this->max_concurrent_requests; ++i) {
+        workers.emplace_back(&ProverServer::worker_loop, this);
+    }
+}
+
+ProverServer::~ProverServer()
+{
+    {
+        std::unique_lock lock(requests_mutex);
+        stop = true;
+    }
+    requests_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+template <typename RequestType>
+void ProverServer::register_handler(uint32_t msg_type,
+                                    ProverServerResponse (ProverServer::*handler)(const RequestType&),
+                                    bool unique)
+{
+    dispatcher.register_target(
+        msg_type,
+        [this, msg_type, handler](msgpack::object& obj, msgpack::sbuffer& buffer) {
+            messaging::TypedMessage<RequestType> request;
+            obj.convert(request);
+
+            messaging::MsgHeader header(request.header.messageId);
+            messaging::TypedMessage<ProverServerResponse> response(msg_type, header, (this->*handler)(request.value));
+            msgpack::pack(buffer, response);
+            return true;
+        },
+        unique);
+}
+
+ProverServerResponse ProverServer::prove(const ProveRequest& request)
+{
+    check_server_options(request.options);
+    check_server_output_path(request.output_path);
+    API::Flags flags = request.options.to_flags();
+    flags.write_vk = request.write_vk;
+    flags.pk_cache_path = pk_cache_path;
+
+    UltraHonkAPI api;
+    api.prove(flags, request.bytecode_path, request.witness_path, request.output_path);
+    return {};
+}
+
+ProverServerResponse ProverServer::verify(const VerifyRequest& request)
+{
+    check_server_options(request.options);
+
+    UltraHonkAPI api;
+    const bool verified =
+        api.verify(request.options.to_flags(), request.public_inputs_path, request.proof_path, request.vk_path);
+    return { .success = true, .verified = verified, .error = "" };
+}
+
+ProverServerResponse ProverServer::write_vk(const WriteVkRequest& request)
+{
+    check_server_options(request.options);
+    check_server_output_path(request.output_path);
+
+    API::Flags flags = request.options.to_flags();
+    flags.pk_cache_path = pk_cache_path;
+
+    UltraHonkAPI api;
+    api.write_vk(flags, request.bytecode_path, request.output_path);
+    return {};
+}
+
+/**
+ * @brief Read and queue the requests of a connection until EOF or TERMINATE
+ *
+ * @return false if the connection asked the server to terminate
+ */
+bool ProverServer::read_requests(const std::shared_ptr<Connection>& connection)
+{
+    msgpack::unpacker unpacker;
+    auto message = std::make_shared<msgpack::object_handle>();
+    while (true) {
+        unpacker.reserve_buffer(READ_CHUNK_SIZE);
+        const ssize_t num_read = ::read(connection->input_fd, unpacker.buffer(), READ_CHUNK_SIZE);
+        if (num_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (num_read <= 0) {
+            return true;
+        }
+        unpacker.buffer_consumed(static_cast<size_t>(num_read));
+
+        while (unpacker.next(*message)) {
+            messaging::HeaderOnlyMessage header;
+            try {
+                message->get().convert(header);
+            } catch (const std::exception& e) {
+                info("Closing prover server connection after a malformed message: ", e.what());
+                return true;
+            }
+
+            if (header.msgType == messaging::SystemMsgTypes::TERMINATE) {
+                return false;
+            }
+            if (header.msgType == messaging::SystemMsgTypes::PING) {
+                messaging::MsgHeader pong_header(header.header.messageId);
+                messaging::HeaderOnlyMessage pong(messaging::SystemMsgTypes::PONG, pong_header);
+                msgpack::sbuffer buffer;
+                msgpack::pack(buffer, pong);
+                connection->send(buffer);
+                continue;
+            }
+
+            // Wait for a free slot, so that a client cannot queue up an unbounded amount of work
+            {
+                std::unique_lock lock(requests_mutex);
+                slots_condition.wait(lock,
+                                     [this] { return num_requests_in_flight < max_concurrent_requests || terminated; });
+                if (terminated) {
+                    return true;
+                }
+                num_requests_in_flight++;
+                connection->start_request();
+                requests.push_back({ connection, std::move(message) });
+            }
+            requests_condition.notify_one();
+            message = std::make_shared<msgpack::object_handle>();
+        }
+    }
+}
+
+void ProverServer::process_request(const Request& request)
+{
+    msgpack::object obj = request.message->get();
+    msgpack::sbuffer buffer;
+    try {
+        dispatcher.on_new_data(obj, buffer);
+    } catch (const std::exception& e) {
+        messaging::HeaderOnlyMessage request_header;
+        obj.convert(request_header);
+        info("Prover server request ", request_header.header.messageId, " failed: ", e.what());
+
+        messaging::MsgHeader header(request_header.header.messageId);
+        messaging::TypedMessage<ProverServerResponse> response(
+            request_header.msgType, header, { .success = false, .verified = false, .error = e.what() });
+        buffer.clear();
+        msgpack::pack(buffer, response);
+    }
+    request.connection->send(buffer);
+}
+
+void ProverServer::worker_loop()
+{
+    while (true) {
+        Request request;
+        {
+            std::unique_lock lock(requests_mutex);
+            requests_condition.wait(lock, [this] { return stop || !requests.empty(); });
+            if (requests.empty()) {
+                return;
+            }
+            request = std::move(requests.front());
+            requests.pop_front();
+        }
+
+        process_request(request);
+
+        {
+            std::unique_lock lock(requests_mutex);
+            num_requests_in_flight--;
+        }
+        slots_condition.notify_all();
+        request.connection->finish_request();
+    }
+}
+
+void ProverServer::serve_stream(int input_fd, int output_fd)
+{
+    // A client going away must not kill the server
+    std::signal(SIGPIPE, SIG_IGN);
+    auto connection = std::make_shared<Connection>(input_fd, output_fd);
+    read_requests(connection);
+    connection->wait_until_idle();
+}
+
+void ProverServer::terminate()
+{
+    std::unique_lock lock(requests_mutex);
+    terminated = true;
+    slots_condition.notify_all();
+    // Unblock accept() and the reads of the other connections
+    if (listen_fd >= 0) {
+        ::shutdown(listen_fd, SHUT_RDWR);
+    }
+    for (const int fd : connection_fds) {
+        ::shutdown(fd, SHUT_RD);
+    }
+}
+
+void ProverServer::serve_socket(const std::string& socket_path)
+{
+    std::signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw_or_abort("Socket path too long: " + socket_path);
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw_or_abort(std::string("Failed to create socket: ") + std::strerror(errno));
+    }
+    ::unlink(socket_path.c_str());
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(fd, SOMAXCONN) != 0) {
+        ::close(fd);
+        throw_or_abort("Failed to listen on " + socket_path + ": " + std::strerror(errno));
+    }
+    {
+        std::unique_lock lock(requests_mutex);
+        listen_fd = fd;
+    }
+    info("Prover server listening on ", socket_path);
+
+    size_t num_connections = 0;
+    std::condition_variable connections_condition;
+    while (true) {
+        const int connection_fd = ::accept(fd, nullptr, nullptr);
+        if (connection_fd < 0 && errno == EINTR) {
+            continue;
+        }
+        if (connection_fd < 0) {
+            // terminate() shuts the listening socket down
+            break;
+        }
+        std::unique_lock lock(requests_mutex);
+        if (terminated) {
+            ::close(connection_fd);
+            break;
+        }
+        connection_fds.insert(connection_fd);
+        num_connections++;
+        std::thread([this, connection_fd, &num_connections, &connections_condition] {
+            auto connection = std::make_shared<Connection>(connection_fd, connection_fd);
+            if (!read_requests(connection)) {
+                terminate();
+            }
+            connection->wait_until_idle();
+
+            std::unique_lock connection_lock(requests_mutex);
+            connection_fds.erase(connection_fd);
+            ::close(connection_fd);
+            if (--num_connections == 0) {
+                connections_condition.notify_all();
+            }
+        }).detach();
+    }
+
+    std::unique_lock lock(requests_mutex);
+    connections_condition.wait(lock, [&] { return num_connections == 0; });
+    listen_fd = -1;
+    ::close(fd);
+    ::unlink(socket_path.c_str());
+}
+
+} // namespace bb
+#endif
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "barretenberg/api/api.hpp"
+#include "barretenberg/messaging/dispatcher.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bb {
+
+enum ProverServerMessageType {
+    PROVE = messaging::FIRST_APP_MSG_TYPE,
+    VERIFY,
+    WRITE_VK,
+};
+
+/**
+ * @brief The subset of API::Flags that selects the proof system of a request
+ */
+struct ProofSystemOptions {
+    std::string scheme{ "ultra_honk" };
+    std::string oracle_hash_type{ "poseidon2" };
+    std::string output_format{ "bytes" };
+    bool zk{ false };
+    bool ipa_accumulation{ false };
+
+    MSGPACK_FIELDS(scheme, oracle_hash_type, output_format, zk, ipa_accumulation);
+
+    API::Flags to_flags() const;
+};
+
+struct ProveRequest {
+    ProofSystemOptions options;
+    std::string bytecode_path;
+    std::string witness_path;
+    std::string output_path;
+    bool write_vk{ false };
+    MSGPACK_FIELDS(options, bytecode_path, witness_path, output_path, write_vk);
+};
+
+struct VerifyRequest {
+    ProofSystemOptions options;
+    std::string public_inputs_path;
+    std::string proof_path;
+    std::string vk_path;
+    MSGPACK_FIELDS(options, public_inputs_path, proof_path, vk_path);
+};
+
+struct WriteVkRequest {
+    ProofSystemOptions options;
+    std::string bytecode_path;
+    std::string output_path;
+    MSGPACK_FIELDS(options, bytecode_path, output_path);
+};
+
+struct ProverServerResponse {
+    bool success{ true };
+    bool verified{ false };
+    std::string error;
+    MSGPACK_FIELDS(success, verified, error);
+};
+
+/**
+ * @brief A long running prover that serves prove/verify/write_vk requests over a msgpack stream
+ * @details Requests are messaging::TypedMessage<Request> objects, and each is answered with a
+ * messaging::TypedMessage<ProverServerResponse> of the same message type whose header.requestId is the messageId of
+ * the request. Responses may be sent out of order. The system messages PING and TERMINATE are answered with a PONG and
+ * stop the server, respectively.
+ *
+ * The process state that `bb prove` rebuilds on every invocation (the CRSs, the commitment key and the thread pool)
+ * stays resident between requests. Up to max_concurrent_requests requests are in flight at any time; further requests
+ * are not read until a slot frees up. Proving and writing VKs use the resident commitment key, so each of these
+ * requests runs alone: it waits for the requests in flight to finish, and no other request starts until it is done.
+ * Verification requests only run concurrently with other verification requests.
+ */
+class ProverServer {
+  public:
+    /**
+     * @param pk_cache_path Directory of the proving key cache used by prove and write_vk requests; no caching if empty
+     */
+    explicit ProverServer(size_t max_concurrent_requests, std::filesystem::path pk_cache_path = "");
+    ProverServer(const ProverServer&) = delete;
+    ProverServer& operator=(const ProverServer&) = delete;
+    ~ProverServer();
+
+    /**
+     * @brief Serve the requests read from input_fd, writing the responses to output_fd, until EOF or TERMINATE
+     * @details Returns once all requests read have been answered.
+     */
+    void serve_stream(int input_fd, int output_fd);
+
+    /**
+     * @brief Serve the connections to a Unix socket at socket_path, each as a request stream, until a TERMINATE
+     */
+    void serve_socket(const std::string& socket_path);
+
+  private:
+    struct Connection;
+    struct Request {
+        std::shared_ptr<Connection> connection;
+        std::shared_ptr<msgpack::object_handle> message;
+    };
+
+    messaging::MessageDispatcher dispatcher;
+    std::vector<std::thread> workers;
+    std::deque<Request> requests;
+    size_t max_concurrent_requests;
+    std::filesystem::path pk_cache_path;
+    size_t num_requests_in_flight = 0;
+    std::mutex requests_mutex;
+    std::condition_variable requests_condition;
+    std::condition_variable slots_condition;
+    bool stop = false;
+    bool terminated = false;
+    int listen_fd = -1;
+    std::set<int> connection_fds;
+
+    template <typename RequestType>
+    void register_handler(uint32_t msg_type,
+                          ProverServerResponse (ProverServer::*handler)(const RequestType&),
+                          bool unique);
+
+    ProverServerResponse prove(const ProveRequest& request);
+    ProverServerResponse verify(const VerifyRequest& request);
+    ProverServerResponse write_vk(const WriteVkRequest& request);
+
+    bool read_requests(const std::shared_ptr<Connection>& connection);
+    void process_request(const Request& request);
+    void terminate();
+    void worker_loop();
+};
+
+} // namespace bb
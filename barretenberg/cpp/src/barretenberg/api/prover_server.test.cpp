@@ -0,0 +1,232 @@
+#ifndef __wasm__
+#include "prover_server.hpp"
+#include "barretenberg/api/file_io.hpp"
+#include "barretenberg/dsl/acir_format/serde/acir.hpp"
+#include "barretenberg/dsl/acir_format/serde/witness_stack.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/srs/io.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <thread>
+#include <unistd.h>
+
+namespace bb {
+extern std::string CRS_PATH;
+} // namespace bb
+
+using namespace bb;
+
+namespace {
+
+// Hex encodings of the field elements used by the test circuit
+const std::string FIELD_ZERO(64, '0');
+const std::string FIELD_ONE = std::string(63, '0') + "1";
+const std::string FIELD_MINUS_ONE = "30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000000";
+
+class ProverServerTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite()
+    {
+        // Serve the CRS from a flat copy of the first points of the ignition transcript, so that no CRS is downloaded
+        constexpr size_t NUM_CRS_POINTS = (1 << 17) + 1;
+        const auto crs_dir = std::filesystem::temp_directory_path() / "prover_server_tests_crs";
+        std::filesystem::create_directories(crs_dir);
+        std::vector<g1::affine_element> g1_points(NUM_CRS_POINTS);
+        srs::IO<curve::BN254>::read_transcript_g1(g1_points.data(), NUM_CRS_POINTS, srs::get_ignition_crs_path());
+        g2::affine_element g2_point;
+        srs::IO<curve::BN254>::read_transcript_g2(g2_point, srs::get_ignition_crs_path());
+        std::vector<uint8_t> g1_data;
+        g1_data.reserve(NUM_CRS_POINTS * 64);
+        for (const auto& point : g1_points) {
+            const auto buffer = to_buffer(point);
+            g1_data.insert(g1_data.end(), buffer.begin(), buffer.end());
+        }
+        write_file((crs_dir / "bn254_g1.dat").string(), g1_data);
+        write_file((crs_dir / "bn254_g2.dat").string(), to_buffer(g2_point));
+        CRS_PATH = crs_dir.string();
+    }
+
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() /
+              ("prover_server_tests_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    /**
+     * @brief Write a gzipped program proving knowledge of a factorisation w₁⋅w₂ = w₃ of the public input w₁ = 3, and
+     * its witness
+     */
+    void write_circuit()
+    {
+        Acir::Expression expression{
+            .mul_terms = { { FIELD_ONE, Acir::Witness{ 0 }, Acir::Witness{ 1 } } },
+            .linear_combinations = { { FIELD_MINUS_ONE, Acir::Witness{ 2 } } },
+            .q_c = FIELD_ZERO,
+        };
+        Acir::Circuit circuit{
+            .current_witness_index = 2,
+            .opcodes = { Acir::Opcode{ .value = Acir::Opcode::AssertZero{ .value = expression } } },
+            .expression_width = { .value = Acir::ExpressionWidth::Bounded{ .width = 4 } },
+            .private_parameters = { Acir::Witness{ 1 }, Acir::Witness{ 2 } },
+            .public_parameters = { .value = { Acir::Witness{ 0 } } },
+            .return_values = {},
+            .assert_messages = {},
+        };
+        Acir::Program program{ .functions = { circuit }, .unconstrained_functions = {} };
+        write_gzipped(bytecode_path(), program.bincodeSerialize());
+
+        Witnesses::WitnessMap witness_map;
+        witness_map.value[Witnesses::Witness{ 0 }] = std::string(63, '0') + "3";
+        witness_map.value[Witnesses::Witness{ 1 }] = std::string(63, '0') + "4";
+        witness_map.value[Witnesses::Witness{ 2 }] = std::string(63, '0') + "c";
+        Witnesses::WitnessStack witness_stack{ .stack = { { .index = 0, .witness = witness_map } } };
+        write_gzipped(witness_path(), witness_stack.bincodeSerialize());
+    }
+
+    static void write_gzipped(const std::filesystem::path& path, const std::vector<uint8_t>& data)
+    {
+        const auto raw_path = path.string() + ".raw";
+        write_file(raw_path, data);
+        ASSERT_EQ(std::system(("gzip -c '" + raw_path + "' > '" + path.string() + "'").c_str()), 0);
+    }
+
+    /**
+     * @brief Serve the given requests as a single stream and return the responses, in the order they were sent
+     */
+    static std::vector<messaging::TypedMessage<ProverServerResponse>> serve(ProverServer& server,
+                                                                            const msgpack::sbuffer& requests)
+    {
+        int input_pipe[2];
+        int output_pipe[2];
+        EXPECT_EQ(::pipe(input_pipe), 0);
+        EXPECT_EQ(::pipe(output_pipe), 0);
+        std::vector<uint8_t> output;
+        std::thread reader([&] {
+            std::array<uint8_t, 4096> chunk{};
+            ssize_t num_read = 0;
+            while ((num_read = ::read(output_pipe[0], chunk.data(), chunk.size())) > 0) {
+                output.insert(output.end(), chunk.begin(), chunk.begin() + num_read);
+            }
+        });
+        EXPECT_EQ(::write(input_pipe[1], requests.data(), requests.size()), static_cast<ssize_t>(requests.size()));
+        ::close(input_pipe[1]);
+        server.serve_stream(input_pipe[0], output_pipe[1]);
+        ::close(output_pipe[1]);
+        reader.join();
+        ::close(input_pipe[0]);
+        ::close(output_pipe[0]);
+
+        std::vector<messaging::TypedMessage<ProverServerResponse>> responses;
+        size_t offset = 0;
+        while (offset < output.size()) {
+            auto handle = msgpack::unpack(reinterpret_cast<const char*>(output.data()), output.size(), offset);
+            messaging::HeaderOnlyMessage header;
+            handle.get().convert(header);
+            // A PONG carries no response value
+            if (header.msgType == messaging::SystemMsgTypes::PONG) {
+                responses.emplace_back(header.msgType, header.header, ProverServerResponse{});
+                continue;
+            }
+            responses.emplace_back();
+            handle.get().convert(responses.back());
+        }
+        return responses;
+    }
+
+    template <typename Request>
+    static void pack_request(msgpack::sbuffer& buffer, uint32_t msg_type, uint32_t message_id, const Request& request)
+    {
+        messaging::MsgHeader header(message_id, 0);
+        msgpack::pack(buffer, messaging::TypedMessage<Request>(msg_type, header, request));
+    }
+
+    std::filesystem::path bytecode_path() const { return dir / "program.gz"; }
+    std::filesystem::path witness_path() const { return dir / "witness.gz"; }
+
+    std::filesystem::path dir;
+};
+
+} // namespace
+
+/**
+ * @brief Prove a circuit and verify the proof through the server
+ */
+TEST_F(ProverServerTests, ProveAndVerify)
+{
+    write_circuit();
+    ProverServer server(/*max_concurrent_requests=*/2);
+
+    msgpack::sbuffer requests;
+    const auto output_dir = dir / "out";
+    std::filesystem::create_directories(output_dir);
+    pack_request(requests,
+                 PROVE,
+                 1,
+                 ProveRequest{ .bytecode_path = bytecode_path(),
+                               .witness_path = witness_path(),
+                               .output_path = output_dir,
+                               .write_vk = true });
+    auto responses = serve(server, requests);
+    ASSERT_EQ(responses.size(), 1);
+    EXPECT_EQ(responses[0].msgType, static_cast<uint32_t>(PROVE));
+    EXPECT_EQ(responses[0].header.requestId, 1);
+    EXPECT_TRUE(responses[0].value.success) << responses[0].value.error;
+
+    requests.clear();
+    pack_request(requests,
+                 VERIFY,
+                 2,
+                 VerifyRequest{ .public_inputs_path = output_dir / "public_inputs",
+                                .proof_path = output_dir / "proof",
+                                .vk_path = output_dir / "vk" });
+    responses = serve(server, requests);
+    ASSERT_EQ(responses.size(), 1);
+    EXPECT_EQ(responses[0].header.requestId, 2);
+    EXPECT_TRUE(responses[0].value.success) << responses[0].value.error;
+    EXPECT_TRUE(responses[0].value.verified);
+}
+
+/**
+ * @brief A failing request is answered with an error, and does not affect the other requests of the stream
+ */
+TEST_F(ProverServerTests, ErrorResponse)
+{
+    ProverServer server(/*max_concurrent_requests=*/1);
+
+    msgpack::sbuffer requests;
+    pack_request(requests,
+                 PROVE,
+                 1,
+                 ProveRequest{ .options = { .scheme = "client_ivc" },
+                               .bytecode_path = bytecode_path(),
+                               .witness_path = witness_path(),
+                               .output_path = dir });
+    messaging::MsgHeader ping_header(2, 0);
+    msgpack::pack(requests, messaging::HeaderOnlyMessage(messaging::SystemMsgTypes::PING, ping_header));
+    pack_request(requests, WRITE_VK, 3, WriteVkRequest{ .bytecode_path = bytecode_path(), .output_path = "-" });
+
+    const auto responses = serve(server, requests);
+    ASSERT_EQ(responses.size(), 3);
+    // The PONG is sent by the reading thread, so it may overtake the failed requests
+    size_t num_errors = 0;
+    for (const auto& response : responses) {
+        if (response.msgType == messaging::SystemMsgTypes::PONG) {
+            EXPECT_EQ(response.header.requestId, 2);
+            continue;
+        }
+        EXPECT_EQ(response.header.requestId, response.msgType == PROVE ? 1 : 3);
+        EXPECT_FALSE(response.value.success);
+        EXPECT_FALSE(response.value.error.empty());
+        num_errors++;
+    }
+    EXPECT_EQ(num_errors, 2);
+}
+#endif
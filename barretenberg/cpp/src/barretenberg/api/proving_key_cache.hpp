@@ -0,0 +1,260 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef __wasm__
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+/**
+ * @brief The directory, under cache_path, of the proving key cache entries of this build of bb
+ * @details Entries hold the in-memory representation of the polynomials and are only checked against the circuit
+ * shape when loaded (see ProvingKeyCache::matches), so they must only be read by the build that wrote them. Release
+ * builds are identified by their version. Development builds all carry the same placeholder version (made of zeros),
+ * so they are identified by the size and modification time of the running binary instead. Returns an empty path,
+ * which disables the cache, if a development build cannot be identified.
+ */
+inline std::filesystem::path get_proving_key_cache_dir(const std::filesystem::path& cache_path, const char* version)
+{
+    const std::string version_string(version);
+    const bool is_placeholder = std::all_of(
+        version_string.begin(), version_string.end(), [](const char c) { return c == '0' || c == '.'; });
+    if (!is_placeholder) {
+        return cache_path / version_string;
+    }
+    std::error_code error;
+    const auto binary = std::filesystem::read_symlink("/proc/self/exe", error);
+    const auto size = error ? 0 : std::filesystem::file_size(binary, error);
+    const auto modified = error ? std::filesystem::file_time_type{} : std::filesystem::last_write_time(binary, error);
+    if (error) {
+        info("Disabling the proving key cache, as this development build of bb cannot be identified.");
+        return {};
+    }
+    return cache_path / format("dev-", size, "-", modified.time_since_epoch().count());
+}
+
+/**
+ * @brief An on-disk cache of the witness-independent part of UltraHonk proving keys, together with the matching
+ * verification keys
+ * @details The selectors, the sigma/id polynomials, the lookup tables and the lagrange polynomials depend only on the
+ * circuit, which is determined by the ACIR bytecode and the parameters used to build the circuit from it. An entry is
+ * keyed by the SHA-256 of the bytecode, the flavor, the honk recursion mode and the (unstructured) trace settings, so
+ * that repeated proofs of the same circuit skip the construction of these polynomials and the VK commitments.
+ *
+ * Entries hold the polynomials in their in-memory Montgomery representation, so the cache is a local cache rather
+ * than a portable format. Entries are written under a temporary name and renamed into place, so that concurrent
+ * processes never read a partially written entry. Entries of different builds of bb live in different directories
+ * (see get_proving_key_cache_dir). As a further guard against stale entries, a loaded entry is only used if the proving
+ * key built with it agrees with its VK on the circuit size and public inputs and has the same active ranges.
+ */
+template <typename Flavor> class ProvingKeyCache {
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using Polynomial = typename Flavor::Polynomial;
+    using FF = typename Flavor::FF;
+    using VerificationKey = typename Flavor::VerificationKey;
+
+  public:
+    using PrecomputedPolynomials = typename DeciderProvingKey::PrecomputedPolynomials;
+
+    struct Entry {
+        std::shared_ptr<PrecomputedPolynomials> polynomials;
+        std::shared_ptr<VerificationKey> verification_key;
+        std::vector<std::pair<size_t, size_t>> active_ranges;
+    };
+
+    ProvingKeyCache(const std::filesystem::path& cache_dir,
+                    const std::vector<uint8_t>& bytecode,
+                    const uint32_t honk_recursion)
+        : path(cache_dir / compute_key(bytecode, honk_recursion))
+    {}
+
+    /**
+     * @brief Load the entry of the circuit, or return nullopt if there is none or it cannot be read
+     */
+    std::optional<Entry> load() const
+    {
+        PROFILE_THIS_NAME("ProvingKeyCache::load");
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file || read_u64(file) != MAGIC) {
+            return std::nullopt;
+        }
+
+        Entry entry{ std::make_shared<PrecomputedPolynomials>(), nullptr, {} };
+        for (auto& poly : entry.polynomials->get_all()) {
+            const size_t start_index = read_u64(file);
+            const size_t size = read_u64(file);
+            const size_t virtual_size = read_u64(file);
+            if (!file || start_index + size > virtual_size) {
+                return std::nullopt;
+            }
+            poly = Polynomial(size, virtual_size, start_index, Polynomial::DontZeroMemory::FLAG);
+            file.read(reinterpret_cast<char*>(poly.data()), static_cast<std::streamsize>(size * sizeof(FF)));
+        }
+
+        const size_t num_ranges = read_u64(file);
+        for (size_t i = 0; file && i < num_ranges; ++i) {
+            const size_t start = read_u64(file);
+            const size_t end = read_u64(file);
+            entry.active_ranges.emplace_back(start, end);
+        }
+
+        const size_t vk_size = read_u64(file);
+        if (!file) {
+            return std::nullopt;
+        }
+        std::vector<uint8_t> vk_buffer(vk_size);
+        file.read(reinterpret_cast<char*>(vk_buffer.data()), static_cast<std::streamsize>(vk_size));
+        if (!file) {
+            return std::nullopt;
+        }
+        entry.verification_key = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(vk_buffer));
+        vinfo("Loaded proving key cache entry ", path);
+        return entry;
+    }
+
+    /**
+     * @brief Whether a proving key built with the polynomials of the entry describes the same circuit as the entry
+     */
+    static bool matches(const Entry& entry, const DeciderProvingKey& decider_pk)
+    {
+        const auto& proving_key = decider_pk.proving_key;
+        const auto& vk = *entry.verification_key;
+        return vk.circuit_size == proving_key.circuit_size && vk.num_public_inputs == proving_key.num_public_inputs &&
+               vk.pub_inputs_offset == proving_key.pub_inputs_offset &&
+               entry.active_ranges == proving_key.active_region_data.get_ranges();
+    }
+
+    /**
+     * @brief Store the precomputed polynomials of a proving key and its VK as the entry of the circuit
+     *
+     * @return Whether the entry could be written
+     */
+    bool store(DeciderProvingKey& decider_pk, const VerificationKey& vk) const
+    {
+        PROFILE_THIS_NAME("ProvingKeyCache::store");
+#ifdef __wasm__
+        static_cast<void>(decider_pk);
+        static_cast<void>(vk);
+        return false;
+#else
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+
+        const std::string temp_path = format(path.string(), ".tmp.", getpid());
+        {
+            std::ofstream file(temp_path, std::ios::binary);
+            if (!file) {
+                vinfo("Could not write proving key cache entry ", path);
+                return false;
+            }
+            write_u64(file, MAGIC);
+            for (const auto& poly : decider_pk.proving_key.polynomials.get_precomputed()) {
+                write_u64(file, poly.start_index());
+                write_u64(file, poly.size());
+                write_u64(file, poly.virtual_size());
+                file.write(reinterpret_cast<const char*>(poly.data()),
+                           static_cast<std::streamsize>(poly.size() * sizeof(FF)));
+            }
+
+            const auto ranges = decider_pk.proving_key.active_region_data.get_ranges();
+            write_u64(file, ranges.size());
+            for (const auto& [start, end] : ranges) {
+                write_u64(file, start);
+                write_u64(file, end);
+            }
+
+            const auto vk_buffer = to_buffer(vk);
+            write_u64(file, vk_buffer.size());
+            file.write(reinterpret_cast<const char*>(vk_buffer.data()),
+                       static_cast<std::streamsize>(vk_buffer.size()));
+            if (!file) {
+                std::remove(temp_path.c_str());
+                vinfo("Could not write proving key cache entry ", path);
+                return false;
+            }
+        }
+        if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+            std::remove(temp_path.c_str());
+            return false;
+        }
+        vinfo("Stored proving key cache entry ", path);
+        return true;
+#endif
+    }
+
+  private:
+    // Bumped whenever the format of an entry, or the polynomials it holds, change
+    static constexpr uint64_t MAGIC = 0x6262706b63686531; // "bbpkche1"
+
+    std::filesystem::path path;
+
+    static std::string flavor_name()
+    {
+        if constexpr (std::same_as<Flavor, UltraFlavor>) {
+            return "ultra";
+        } else if constexpr (std::same_as<Flavor, UltraZKFlavor>) {
+            return "ultra_zk";
+        } else if constexpr (std::same_as<Flavor, UltraKeccakFlavor>) {
+            return "ultra_keccak";
+        } else if constexpr (std::same_as<Flavor, UltraKeccakZKFlavor>) {
+            return "ultra_keccak_zk";
+        } else if constexpr (std::same_as<Flavor, UltraRollupFlavor>) {
+            return "ultra_rollup";
+#ifdef STARKNET_GARAGA_FLAVORS
+        } else if constexpr (std::same_as<Flavor, UltraStarknetFlavor>) {
+            return "ultra_starknet";
+        } else if constexpr (std::same_as<Flavor, UltraStarknetZKFlavor>) {
+            return "ultra_starknet_zk";
+#endif
+        } else {
+            throw_or_abort("Proving key cache does not support this flavor.");
+            return "";
+        }
+    }
+
+    static std::string compute_key(const std::vector<uint8_t>& bytecode, const uint32_t honk_recursion)
+    {
+        std::vector<uint8_t> preimage = bytecode;
+        const std::string parameters =
+            format(flavor_name(), ":honk_recursion=", honk_recursion, ":trace=unstructured:", MAGIC);
+        preimage.insert(preimage.end(), parameters.begin(), parameters.end());
+
+        std::ostringstream key;
+        for (const uint8_t byte : crypto::sha256(preimage)) {
+            key << std::hex << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(byte);
+        }
+        return key.str();
+    }
+
+    static uint64_t read_u64(std::ifstream& file)
+    {
+        uint64_t value = 0;
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    }
+
+    static void write_u64(std::ofstream& file, const uint64_t value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+};
+
+} // namespace bb
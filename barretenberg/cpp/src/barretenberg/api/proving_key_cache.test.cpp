@@ -0,0 +1,127 @@
+#include "proving_key_cache.hpp"
+#include "barretenberg/stdlib/plonk_recursion/pairing_points.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+
+class ProvingKeyCacheTests : public ::testing::Test {
+  protected:
+    using Flavor = UltraFlavor;
+    using Cache = ProvingKeyCache<Flavor>;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using VerificationKey = Flavor::VerificationKey;
+
+    static void SetUpTestSuite() { bb::srs::init_crs_factory(bb::srs::get_ignition_crs_path()); }
+
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() /
+              ("proving_key_cache_tests_" +
+               std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    // A circuit whose witness depends on the seed, but whose precomputed polynomials do not
+    static UltraCircuitBuilder create_circuit(const uint64_t seed)
+    {
+        UltraCircuitBuilder builder;
+        const fr a = fr(seed);
+        const fr b = fr(seed + 1);
+        const uint32_t a_idx = builder.add_public_variable(a);
+        const uint32_t b_idx = builder.add_variable(b);
+        const uint32_t c_idx = builder.add_variable(a * b);
+        builder.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+        MockCircuits::add_arithmetic_gates(builder, 1 << 8);
+        MockCircuits::add_lookup_gates(builder);
+        stdlib::recursion::PairingPoints<UltraCircuitBuilder>::add_default_to_public_inputs(builder);
+        return builder;
+    }
+
+    std::filesystem::path dir;
+    const std::vector<uint8_t> bytecode{ 1, 2, 3, 4 };
+};
+
+} // namespace
+
+/**
+ * @brief An entry stored on disk is loaded by a fresh cache, and proofs built with it verify against its VK
+ */
+TEST_F(ProvingKeyCacheTests, StoreLoadProveAndVerify)
+{
+    {
+        auto circuit = create_circuit(5);
+        auto proving_key = std::make_shared<DeciderProvingKey>(circuit);
+        const VerificationKey vk(proving_key->proving_key);
+        EXPECT_FALSE(Cache(dir, bytecode, 1).load().has_value());
+        EXPECT_TRUE(Cache(dir, bytecode, 1).store(*proving_key, vk));
+    }
+
+    // Entries are keyed by the bytecode and the honk recursion mode
+    EXPECT_FALSE(Cache(dir, { 1, 2, 3 }, 1).load().has_value());
+    EXPECT_FALSE(Cache(dir, bytecode, 2).load().has_value());
+
+    auto entry = Cache(dir, bytecode, 1).load();
+    ASSERT_TRUE(entry.has_value());
+    auto circuit = create_circuit(7);
+    auto proving_key = std::make_shared<DeciderProvingKey>(circuit, TraceSettings{}, nullptr, entry->polynomials);
+    EXPECT_TRUE(Cache::matches(*entry, *proving_key));
+
+    UltraProver_<Flavor> prover(proving_key);
+    const auto proof = prover.construct_proof();
+    UltraVerifier_<Flavor> verifier(entry->verification_key);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    // The cached VK is the one of the circuit
+    const VerificationKey expected_vk(proving_key->proving_key);
+    EXPECT_EQ(*entry->verification_key, expected_vk);
+}
+
+/**
+ * @brief An entry is ignored if the proving key built with it does not have the shape of the stored circuit
+ * @details An entry of a different circuit size is not even shared into the proving key.
+ */
+TEST_F(ProvingKeyCacheTests, MismatchedEntry)
+{
+    auto circuit = create_circuit(5);
+    auto proving_key = std::make_shared<DeciderProvingKey>(circuit);
+    const VerificationKey vk(proving_key->proving_key);
+    ASSERT_TRUE(Cache(dir, bytecode, 1).store(*proving_key, vk));
+    auto entry = Cache(dir, bytecode, 1).load();
+    ASSERT_TRUE(entry.has_value());
+
+    // The polynomials of the entry are too small for the other circuit, so its proving key is constructed without them
+    auto other_circuit = create_circuit(5);
+    MockCircuits::add_arithmetic_gates(other_circuit, 1 << 10);
+    auto other_proving_key =
+        std::make_shared<DeciderProvingKey>(other_circuit, TraceSettings{}, nullptr, entry->polynomials);
+    EXPECT_FALSE(Cache::matches(*entry, *other_proving_key));
+
+    UltraProver_<Flavor> prover(other_proving_key);
+    const auto proof = prover.construct_proof();
+    auto other_vk = std::make_shared<VerificationKey>(other_proving_key->proving_key);
+    UltraVerifier_<Flavor> verifier(other_vk);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+/**
+ * @brief Entries of release builds are keyed by version, and those of development builds by the binary
+ */
+TEST_F(ProvingKeyCacheTests, BuildDirectory)
+{
+    EXPECT_EQ(get_proving_key_cache_dir(dir, "1.2.3"), dir / "1.2.3");
+    const auto dev_dir = get_proving_key_cache_dir(dir, "00000000.00000000.00000000");
+    if (!dev_dir.empty()) {
+        EXPECT_EQ(dev_dir.parent_path(), dir);
+        EXPECT_TRUE(dev_dir.filename().string().starts_with("dev-"));
+        EXPECT_EQ(get_proving_key_cache_dir(dir, "00000000.00000000.00000000"), dev_dir);
+    }
+}
@@ -19,7 +19,10 @@
 #include "barretenberg/api/api_ultra_honk.hpp"
 #include "barretenberg/api/api_ultra_plonk.hpp"
 #include "barretenberg/api/gate_count.hpp"
+#include "barretenberg/api/init_srs.hpp"
 #include "barretenberg/api/prove_tube.hpp"
+#include "barretenberg/api/prover_server.hpp"
+#include "barretenberg/api/proving_key_cache.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
@@ -176,6 +179,47 @@ int parse_and_run_cli_command(int argc, char* argv[])
             ->check(CLI::ExistingDirectory);
     };
 
+    const auto add_mmap_crs_flag = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_flag("--mmap_crs",
+                       flags.mmap_crs,
+                       "Keep pre-converted point tables of the CRSs in the CRS directory and map them, rather than "
+                       "converting the raw points in every process. Concurrent bb processes share the mapped tables. "
+                       "The tables take twice the space of the raw points.")
+            ->envname("BB_MMAP_CRS");
+    };
+
+    const auto add_pk_cache_path_option = [&](CLI::App* subcommand) {
+        return subcommand->add_option(
+            "--pk_cache_path",
+            flags.pk_cache_path,
+            "Directory of a cache of UltraHonk proving key polynomials and verification keys, keyed by the hash of "
+            "the bytecode and the proving options. Repeated proofs of a circuit skip the construction of its "
+            "selector, permutation and table polynomials. Disabled if not given.");
+    };
+
+    const auto add_sumcheck_memory_budget_option = [&](CLI::App* subcommand) {
+        return subcommand->add_option(
+            "--sumcheck_memory_budget",
+            flags.sumcheck_memory_budget,
+            "Maximum size in bytes of the table of partially evaluated polynomials of sumcheck. Until the table fits, "
+            "sumcheck rounds are computed from the full polynomials, trading prover time for peak memory. Unbounded "
+            "if not given.");
+    };
+
+    const auto add_fixed_base_table_options = [&](CLI::App* subcommand) {
+        subcommand->add_option(
+            "--fixed_base_table_points",
+            flags.fixed_base_table_points,
+            "Number of points of the prefix of the CRS to precompute a fixed-base table for. Commitments to "
+            "polynomials within the prefix skip the doublings of pippenger. The table is stored in the CRS directory. "
+            "Disabled if not given.");
+        return subcommand->add_option("--fixed_base_table_memory_budget",
+                                      flags.fixed_base_table_memory_budget,
+                                      "Maximum size in bytes of the fixed-base table, which bounds its depth. "
+                                      "Defaults to the size of a full-depth table over --fixed_base_table_points.");
+    };
+
     const auto add_oracle_hash_option = [&](CLI::App* subcommand) {
         return subcommand
             ->add_option(
@@ -330,6 +374,10 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_verbose_flag(prove);
     add_debug_flag(prove);
     add_crs_path_option(prove);
+    add_pk_cache_path_option(prove);
+    add_mmap_crs_flag(prove);
+    add_sumcheck_memory_budget_option(prove);
+    add_fixed_base_table_options(prove);
     add_oracle_hash_option(prove);
     add_output_format_option(prove);
     add_write_vk_flag(prove);
@@ -359,6 +407,8 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_debug_flag(write_vk);
     add_output_format_option(write_vk);
     add_crs_path_option(write_vk);
+    add_pk_cache_path_option(write_vk);
+    add_mmap_crs_flag(write_vk);
     add_init_kzg_accumulator_option(write_vk);
     add_oracle_hash_option(write_vk);
     add_ipa_accumulation_flag(write_vk);
@@ -403,6 +453,33 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_zk_option(write_solidity_verifier);
     add_crs_path_option(write_solidity_verifier);
 
+    /***************************************************************************************************************
+     * Subcommand: serve
+     ***************************************************************************************************************/
+    CLI::App* serve =
+        app.add_subcommand("serve",
+                           "Run a persistent prover that serves UltraHonk prove, verify and write_vk requests, encoded "
+                           "as msgpack messages, keeping the CRS and commitment key resident between requests.");
+
+    std::string serve_socket_path;
+    size_t max_concurrent_requests{ 1 };
+    serve->add_option("--socket",
+                      serve_socket_path,
+                      "Path of a Unix socket to listen on. If not given, requests are read from stdin and "
+                      "responses are written to stdout.");
+    serve
+        ->add_option("--max_concurrent_requests",
+                     max_concurrent_requests,
+                     "Maximum number of requests in flight. Proving requests are always executed one at a time.")
+        ->check(CLI::PositiveNumber);
+
+    add_verbose_flag(serve);
+    add_debug_flag(serve);
+    add_crs_path_option(serve);
+    add_pk_cache_path_option(serve);
+    add_mmap_crs_flag(serve);
+    add_fixed_base_table_options(serve);
+
     /***************************************************************************************************************
      * Subcommand: OLD_API
      ***************************************************************************************************************/
@@ -691,6 +768,20 @@ int parse_and_run_cli_command(int argc, char* argv[])
     CLI11_PARSE(app, argc, argv);
     debug_logging = flags.debug;
     verbose_logging = debug_logging || flags.verbose;
+    if (flags.fixed_base_table_points > 0 && flags.fixed_base_table_memory_budget == 0) {
+        flags.fixed_base_table_memory_budget =
+            scalar_multiplication::FixedBaseTable<curve::BN254>::get_row_size(flags.fixed_base_table_points) *
+            scalar_multiplication::get_fixed_base_num_windows(scalar_multiplication::FIXED_BASE_DEFAULT_WINDOW_BITS);
+    }
+    set_crs_options({ .map_point_tables = flags.mmap_crs,
+                      .bn254_fixed_base_table = { .num_points = flags.fixed_base_table_points,
+                                                  .memory_budget = flags.fixed_base_table_memory_budget } });
+    // Entries of the proving key cache are only valid for the build of bb that wrote them. The version is read through
+    // a volatile pointer, as the release process patches it in the binary after compilation.
+    if (!flags.pk_cache_path.empty()) {
+        const char* volatile version = BB_VERSION_PLACEHOLDER;
+        flags.pk_cache_path = get_proving_key_cache_dir(flags.pk_cache_path, version);
+    }
 
     print_active_subcommands(app);
     info("Scheme is: ", flags.scheme, ", num threads: ", get_num_cpus());
@@ -749,6 +840,16 @@ int parse_and_run_cli_command(int argc, char* argv[])
                 std::exit(1);
             }
         }
+        // SERVER
+        if (serve->parsed()) {
+            ProverServer server(max_concurrent_requests, flags.pk_cache_path);
+            if (serve_socket_path.empty()) {
+                server.serve_stream(fileno(stdin), fileno(stdout));
+            } else {
+                server.serve_socket(serve_socket_path);
+            }
+            return 0;
+        }
         // TUBE
         if (prove_tube_command->parsed()) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/1201): Potentially remove this extra logic.
@@ -1,6 +1,8 @@
 #include "barretenberg/bb/cli.hpp"
+#include "barretenberg/common/numa.hpp"
 
 int main(int argc, char* argv[])
 {
+    bb::init_numa_policy();
     return bb::parse_and_run_cli_command(argc, argv);
 }
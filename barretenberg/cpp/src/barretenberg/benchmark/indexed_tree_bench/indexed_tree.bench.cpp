@@ -5,10 +5,13 @@
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/cached_content_addressed_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/content_addressed_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/sorted_block_map.hpp"
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -20,10 +23,14 @@ using StoreType = ContentAddressedCachedTreeStore<NullifierLeafValue>;
 using Poseidon2 = ContentAddressedIndexedTree<StoreType, Poseidon2HashPolicy>;
 using Pedersen = ContentAddressedIndexedTree<StoreType, PedersenHashPolicy>;
 
+using PublicDataStoreType = ContentAddressedCachedTreeStore<PublicDataLeafValue>;
+using PublicDataTree = ContentAddressedIndexedTree<PublicDataStoreType, Poseidon2HashPolicy>;
+
 const size_t TREE_DEPTH = 40;
 const size_t MAX_BATCH_SIZE = 64;
 
-template <typename TreeType> void add_values(TreeType& tree, const std::vector<NullifierLeafValue>& values)
+template <typename TreeType, typename LeafValueType>
+void add_values(TreeType& tree, const std::vector<LeafValueType>& values)
 {
     Signal signal(1);
     bool success = true;
@@ -41,7 +48,8 @@ template <typename TreeType> void add_values(TreeType& tree, const std::vector<N
     }
 }
 
-template <typename TreeType> void add_values_with_witness(TreeType& tree, const std::vector<NullifierLeafValue>& values)
+template <typename TreeType, typename LeafValueType>
+void add_values_with_witness(TreeType& tree, const std::vector<LeafValueType>& values)
 {
     bool success = true;
     std::string error_message;
@@ -360,4 +368,300 @@ BENCHMARK(multi_thread_indexed_tree_bench<Poseidon2, SEQUENTIAL>)
     ->Range(512, 8192)
     ->Iterations(100);
 
+/**
+ * @brief Writes a block of range(0) public data updates, with witnesses, to a tree using range(1) threads. Half of the
+ * writes update committed slots and half create new ones, so the low leaves are searched for in both the database and
+ * the cache. Shows how generating the insertions scales with the size of the thread pool.
+ */
+void public_data_batch_insert_scaling_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const size_t num_threads = size_t(state.range(1));
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    std::unique_ptr<PublicDataStoreType> store = std::make_unique<PublicDataStoreType>(name, TREE_DEPTH, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
+    PublicDataTree tree = PublicDataTree(std::move(store), workers, 2);
+
+    const size_t initial_size = 1024 * 64;
+    std::vector<fr> committed_slots(initial_size);
+    std::vector<PublicDataLeafValue> initial_batch(initial_size);
+    for (size_t i = 0; i < initial_size; ++i) {
+        committed_slots[i] = fr(random_engine.get_random_uint256());
+        initial_batch[i] = PublicDataLeafValue(committed_slots[i], fr(random_engine.get_random_uint256()));
+    }
+    add_values(tree, initial_batch);
+    {
+        Signal signal(1);
+        tree.commit([&](const TypedResponse<CommitResponse>&) { signal.signal_level(0); });
+        signal.wait_for_level(0);
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<PublicDataLeafValue> values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            fr slot = i % 2 == 0 ? committed_slots[random_engine.get_random_uint64() % initial_size]
+                                 : fr(random_engine.get_random_uint256());
+            values[i] = PublicDataLeafValue(slot, fr(random_engine.get_random_uint256()));
+        }
+        state.ResumeTiming();
+        add_values_with_witness(tree, values);
+        state.PauseTiming();
+        // Return the tree to its committed state so that every iteration updates the same set of slots
+        Signal signal(1);
+        tree.rollback([&](const Response&) { signal.signal_level(0); });
+        signal.wait_for_level(0);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
+
+    std::filesystem::remove_all(directory);
+}
+
+/**
+ * @brief Inserts batches of range(0) nullifiers into a tree holding range(1) uncommitted nullifiers, within a
+ * checkpoint that is reverted after every batch. The low leaves of the batch are searched for in the cache's leaf key
+ * index, and the keys the batch adds to it are undone by the revert.
+ */
+void uncommitted_batch_insert_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const size_t num_uncommitted = size_t(state.range(1));
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, 1);
+    std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, TREE_DEPTH, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(1);
+    Poseidon2 tree = Poseidon2(std::move(store), workers, batch_size);
+
+    const size_t initial_batch_size = 1024 * 8;
+    for (size_t inserted = 0; inserted < num_uncommitted; inserted += initial_batch_size) {
+        std::vector<NullifierLeafValue> initial_batch(initial_batch_size);
+        for (size_t i = 0; i < initial_batch_size; ++i) {
+            initial_batch[i] = fr(random_engine.get_random_uint256());
+        }
+        add_values(tree, initial_batch);
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<NullifierLeafValue> values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            values[i] = fr(random_engine.get_random_uint256());
+        }
+        state.ResumeTiming();
+        {
+            Signal signal(1);
+            tree.checkpoint([&](const Response&) { signal.signal_level(0); });
+            signal.wait_for_level(0);
+        }
+        add_values(tree, values);
+        {
+            Signal signal(1);
+            tree.revert_checkpoint([&](const Response&) { signal.signal_level(0); });
+            signal.wait_for_level(0);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
+
+    std::filesystem::remove_all(directory);
+}
+
+enum RecordEncoding { MSGPACK, FIXED_WIDTH };
+
+/**
+ * @brief Encodes and decodes range(0) nodes and leaf pre-images as the tree store writes and reads them, either with
+ * msgpack or with the fixed width record codec
+ */
+template <RecordEncoding encoding> void record_encoding_bench(State& state) noexcept
+{
+    const size_t num_records = size_t(state.range(0));
+    std::vector<NodePayload> nodes(num_records);
+    std::vector<IndexedLeaf<NullifierLeafValue>> leaves(num_records);
+    for (size_t i = 0; i < num_records; ++i) {
+        nodes[i] = { .left = fr(random_engine.get_random_uint256()),
+                     .right = fr(random_engine.get_random_uint256()),
+                     .ref = i };
+        leaves[i] = IndexedLeaf<NullifierLeafValue>(
+            NullifierLeafValue(fr(random_engine.get_random_uint256())), i, fr(random_engine.get_random_uint256()));
+    }
+    std::vector<uint8_t> encoded;
+    NodePayload node;
+    IndexedLeaf<NullifierLeafValue> leaf;
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_records; ++i) {
+            if constexpr (encoding == FIXED_WIDTH) {
+                LMDBTreeStore::encode_record(nodes[i], encoded);
+                LMDBTreeStore::decode_record(encoded, node);
+                LMDBTreeStore::encode_record(leaves[i], encoded);
+                LMDBTreeStore::decode_record(encoded, leaf);
+            } else {
+                msgpack::sbuffer buffer;
+                msgpack::pack(buffer, nodes[i]);
+                encoded.assign(buffer.data(), buffer.data() + buffer.size());
+                msgpack::unpack((const char*)encoded.data(), encoded.size()).get().convert(node);
+                msgpack::sbuffer leafBuffer;
+                msgpack::pack(leafBuffer, leaves[i]);
+                encoded.assign(leafBuffer.data(), leafBuffer.data() + leafBuffer.size());
+                msgpack::unpack((const char*)encoded.data(), encoded.size()).get().convert(leaf);
+            }
+            DoNotOptimize(node);
+            DoNotOptimize(leaf);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_records) * 2);
+}
+
+/**
+ * @brief Writes and commits range(0) nodes and leaf pre-images to a tree store, then reads them all back
+ */
+void lmdb_record_commit_and_read_bench(State& state) noexcept
+{
+    const size_t num_records = size_t(state.range(0));
+    std::string directory = random_temp_directory();
+    std::filesystem::create_directories(directory);
+    LMDBTreeStore store(directory, random_string(), 1024 * 1024, 2);
+
+    std::vector<fr> hashes(num_records);
+    std::vector<NodePayload> nodes(num_records);
+    std::vector<IndexedLeaf<NullifierLeafValue>> leaves(num_records);
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < num_records; ++i) {
+            hashes[i] = fr(random_engine.get_random_uint256());
+            nodes[i] = { .left = fr(random_engine.get_random_uint256()), .right = std::nullopt, .ref = 1 };
+            leaves[i] = IndexedLeaf<NullifierLeafValue>(NullifierLeafValue(hashes[i]), i, fr::zero());
+        }
+        state.ResumeTiming();
+        {
+            LMDBWriteTransaction::Ptr tx = store.create_write_transaction();
+            for (size_t i = 0; i < num_records; ++i) {
+                store.write_node(hashes[i], nodes[i], *tx);
+                store.write_leaf_by_hash(hashes[i], leaves[i], *tx);
+            }
+            tx->commit();
+        }
+        {
+            LMDBReadTransaction::Ptr tx = store.create_read_transaction();
+            NodePayload node;
+            IndexedLeaf<NullifierLeafValue> leaf;
+            for (size_t i = 0; i < num_records; ++i) {
+                store.read_node(hashes[i], node, *tx);
+                store.read_leaf_by_hash(hashes[i], leaf, *tx);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_records) * 2);
+
+    std::filesystem::remove_all(directory);
+}
+
+enum LeafKeyIndexType { ORDERED_MAP, SORTED_BLOCKS };
+
+/**
+ * @brief Inserts range(0) random leaf keys into the cache's leaf key index, then looks up the low leaf of as many
+ * random keys, either with a std::map or with the sorted block map the cache uses
+ */
+template <LeafKeyIndexType index_type> void leaf_key_index_bench(State& state) noexcept
+{
+    using IndexType = std::conditional_t<index_type == ORDERED_MAP,
+                                         std::map<uint256_t, index_t>,
+                                         SortedBlockMap<uint256_t, index_t>>;
+    const size_t num_keys = size_t(state.range(0));
+    std::vector<uint256_t> keys(num_keys);
+    std::vector<uint256_t> queries(num_keys);
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < num_keys; ++i) {
+            keys[i] = random_engine.get_random_uint256();
+            queries[i] = random_engine.get_random_uint256();
+        }
+        IndexType index;
+        state.ResumeTiming();
+        for (size_t i = 0; i < num_keys; ++i) {
+            index.insert({ keys[i], i });
+        }
+        index_t found = 0;
+        for (size_t i = 0; i < num_keys; ++i) {
+            if constexpr (index_type == ORDERED_MAP) {
+                auto it = index.upper_bound(queries[i]);
+                found += it == index.begin() ? 0 : std::prev(it)->second;
+            } else {
+                const auto* entry = index.find_less_or_equal(queries[i]);
+                found += entry == nullptr ? 0 : entry->second;
+            }
+        }
+        DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_keys) * 2);
+}
+
+enum CacheReadType { HIT, MISS };
+
+/**
+ * @brief Reads range(0) nodes by index from a cache whose entries are spread over range(1) snapshot layers, as those of
+ * a fork's parent are once it has been forked range(1) times (zero layers being a flat cache), either hitting entries
+ * spread evenly over the layers or missing all of them
+ */
+template <CacheReadType read_type> void layered_cache_read_bench(State& state) noexcept
+{
+    const size_t num_nodes = size_t(state.range(0));
+    const size_t num_layers = size_t(state.range(1));
+    const auto level = static_cast<uint32_t>(TREE_DEPTH);
+    ContentAddressedCache<NullifierLeafValue> cache(level);
+    for (size_t i = 0; i < num_nodes; ++i) {
+        cache.put_node_by_index(level, i, fr(i));
+        if (num_layers > 0 && (i + 1) % (num_nodes / num_layers) == 0) {
+            cache.snapshot();
+        }
+    }
+    const index_t offset = read_type == HIT ? 0 : num_nodes;
+    for (auto _ : state) {
+        size_t found = 0;
+        for (size_t i = 0; i < num_nodes; ++i) {
+            if (cache.get_node_by_index(level, offset + i).has_value()) {
+                found++;
+            }
+        }
+        DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_nodes));
+}
+
+BENCHMARK(record_encoding_bench<MSGPACK>)->Unit(benchmark::kMillisecond)->Arg(1 << 14);
+BENCHMARK(record_encoding_bench<FIXED_WIDTH>)->Unit(benchmark::kMillisecond)->Arg(1 << 14);
+BENCHMARK(lmdb_record_commit_and_read_bench)->Unit(benchmark::kMillisecond)->Arg(1 << 14)->Iterations(10);
+
+BENCHMARK(leaf_key_index_bench<ORDERED_MAP>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1 << 12, 1 << 18);
+BENCHMARK(leaf_key_index_bench<SORTED_BLOCKS>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1 << 12, 1 << 18);
+
+BENCHMARK(layered_cache_read_bench<HIT>)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({ { 1 << 16 }, { 0, 1, 2, 4, 8 } });
+BENCHMARK(layered_cache_read_bench<MISS>)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({ { 1 << 16 }, { 0, 1, 2, 4, 8 } });
+
+BENCHMARK(public_data_batch_insert_scaling_bench)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 1024, 8192 }, { 1, 2, 4, 8, 16 } })
+    ->Iterations(10);
+
+BENCHMARK(uncommitted_batch_insert_bench)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 64, 1024 }, { 1 << 13, 1 << 16 } })
+    ->Iterations(10);
+
 BENCHMARK_MAIN();
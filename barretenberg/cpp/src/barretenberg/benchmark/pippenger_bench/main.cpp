@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -82,6 +83,99 @@ int pippenger()
     return 0;
 }
 
+/**
+ * @brief Compare the sorted-schedule and bucket-ownership pippenger engines on 2^16..2^24 points
+ */
+int compare_pippenger_engines()
+{
+    constexpr size_t MIN_LOG_NUM_POINTS = 16;
+    constexpr size_t MAX_LOG_NUM_POINTS = 24;
+    constexpr size_t MAX_NUM_POINTS = 1UL << MAX_LOG_NUM_POINTS;
+
+    auto crs = std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(MAX_NUM_POINTS,
+                                                                                  bb::srs::get_ignition_crs_path());
+    std::vector<fr> engine_scalars(MAX_NUM_POINTS);
+    for (auto& scalar : engine_scalars) {
+        scalar = fr::random_element();
+    }
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(MAX_NUM_POINTS);
+
+    for (size_t log_num_points = MIN_LOG_NUM_POINTS; log_num_points <= MAX_LOG_NUM_POINTS; ++log_num_points) {
+        const size_t num_points = 1UL << log_num_points;
+        for (const auto engine : { scalar_multiplication::PippengerEngine::SORTED_SCHEDULE,
+                                   scalar_multiplication::PippengerEngine::BUCKET_OWNERSHIP }) {
+            scalar_multiplication::set_pippenger_engine(engine);
+            std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+            g1::element result = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+                PolynomialSpan<const curve::BN254::ScalarField>{ /*start_index*/ 0,
+                                                                 { &engine_scalars[0], /*size*/ num_points } },
+                crs->get_monomial_points(),
+                state);
+            std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+            std::chrono::microseconds diff =
+                std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+            std::cout << "2^" << log_num_points << " points, "
+                      << (engine == scalar_multiplication::PippengerEngine::SORTED_SCHEDULE ? "sorted schedule"
+                                                                                            : "bucket ownership")
+                      << ": " << diff.count() << "us" << std::endl;
+            static_cast<void>(result);
+        }
+    }
+    scalar_multiplication::set_pippenger_engine(scalar_multiplication::PippengerEngine::SORTED_SCHEDULE);
+    return 0;
+}
+
+int compare_fixed_base_msm()
+{
+    constexpr size_t MIN_LOG_NUM_POINTS = 10;
+    constexpr size_t MAX_LOG_NUM_POINTS = 20;
+    constexpr size_t MAX_NUM_POINTS = 1UL << MAX_LOG_NUM_POINTS;
+    // Enough memory for a full-depth table over the largest prefix
+    const scalar_multiplication::FixedBaseTableConfig config{
+        .num_points = MAX_NUM_POINTS,
+        .window_bits = scalar_multiplication::FIXED_BASE_DEFAULT_WINDOW_BITS,
+        .memory_budget = scalar_multiplication::FixedBaseTable<curve::BN254>::get_row_size(MAX_NUM_POINTS) *
+                         scalar_multiplication::get_fixed_base_num_windows(
+                             scalar_multiplication::FIXED_BASE_DEFAULT_WINDOW_BITS),
+    };
+
+    std::chrono::steady_clock::time_point setup_start = std::chrono::steady_clock::now();
+    auto crs = std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(
+        MAX_NUM_POINTS, bb::srs::get_ignition_crs_path(), config);
+    std::chrono::steady_clock::time_point setup_end = std::chrono::steady_clock::now();
+    std::cout << "fixed-base table setup: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(setup_end - setup_start).count() << "ms"
+              << std::endl;
+    const auto table = crs->get_fixed_base_table();
+
+    std::vector<fr> msm_scalars(MAX_NUM_POINTS);
+    for (auto& scalar : msm_scalars) {
+        scalar = fr::random_element();
+    }
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(MAX_NUM_POINTS);
+
+    for (size_t log_num_points = MIN_LOG_NUM_POINTS; log_num_points <= MAX_LOG_NUM_POINTS; ++log_num_points) {
+        const size_t num_points = 1UL << log_num_points;
+        PolynomialSpan<const curve::BN254::ScalarField> msm_input{ /*start_index*/ 0,
+                                                                   { &msm_scalars[0], /*size*/ num_points } };
+
+        std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+        g1::affine_element pippenger_result =
+            scalar_multiplication::pippenger_unsafe<curve::BN254>(msm_input, crs->get_monomial_points(), state);
+        std::chrono::steady_clock::time_point time_mid = std::chrono::steady_clock::now();
+        g1::affine_element fixed_base_result = scalar_multiplication::fixed_base_msm<curve::BN254>(*table, msm_input);
+        std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+
+        BB_ASSERT_EQ(pippenger_result, fixed_base_result);
+        std::cout << "2^" << log_num_points << " points, pippenger: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(time_mid - time_start).count()
+                  << "us, fixed base: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_mid).count() << "us"
+                  << std::endl;
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -117,5 +211,9 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "comparing pippenger engines" << std::endl;
+    compare_pippenger_engines();
+    std::cout << "comparing fixed-base msm" << std::endl;
+    compare_fixed_base_msm();
     return 0;
 }
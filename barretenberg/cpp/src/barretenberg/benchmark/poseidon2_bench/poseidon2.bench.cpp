@@ -41,4 +41,44 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+/**
+ * @brief Hashes range(0) independent pairs one at a time, reporting hashes per second
+ */
+void poseidon2_hash_pair_throughput_bench(State& state) noexcept
+{
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<grumpkin::fq> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    std::vector<grumpkin::fq> outputs(num_pairs);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_pairs; ++i) {
+            outputs[i] = poseiden_hash_impl(inputs[2 * i], inputs[2 * i + 1]);
+        }
+        DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_pairs));
+}
+BENCHMARK(poseidon2_hash_pair_throughput_bench)->Unit(benchmark::kMillisecond)->Arg(1 << 10)->Arg(1 << 14);
+
+/**
+ * @brief Hashes range(0) independent pairs with the batched permutation, reporting hashes per second
+ */
+void poseidon2_hash_pairs_batch_throughput_bench(State& state) noexcept
+{
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<grumpkin::fq> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    std::vector<grumpkin::fq> outputs(num_pairs);
+    for (auto _ : state) {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(inputs, outputs);
+        DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_pairs));
+}
+BENCHMARK(poseidon2_hash_pairs_batch_throughput_bench)->Unit(benchmark::kMillisecond)->Arg(1 << 10)->Arg(1 << 14);
+
 BENCHMARK_MAIN();
\ No newline at end of file
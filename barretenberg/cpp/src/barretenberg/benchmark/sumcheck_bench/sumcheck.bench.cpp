@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/common/numa.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
+
+using namespace benchmark;
+
+/**
+ * Sumcheck throughput over prover polynomials of 2^k rows. Run once as is and once with BB_NUMA_POLICY=local to compare
+ * the NUMA policies; the label of each result names the policy it ran under.
+ */
+namespace bb {
+
+using Flavor = UltraFlavor;
+using FF = Flavor::FF;
+using ProverPolynomials = Flavor::ProverPolynomials;
+using RelationSeparator = Flavor::RelationSeparator;
+
+namespace {
+ProverPolynomials construct_polynomials(size_t log_n)
+{
+    // The constructor zeroes the polynomials from the parallel_for threads, which places their pages
+    ProverPolynomials polynomials(1UL << log_n);
+    size_t idx = 0;
+    for (auto& poly : polynomials.get_unshifted()) {
+        for (size_t i = poly.start_index(); i < poly.end_index(); ++i) {
+            poly.at(i) = FF(i + idx);
+        }
+        idx++;
+    }
+    return polynomials;
+}
+
+RelationSeparator construct_alpha()
+{
+    RelationSeparator alpha;
+    for (size_t idx = 0; idx < alpha.size(); idx++) {
+        alpha[idx] = FF(idx + 2);
+    }
+    return alpha;
+}
+
+std::vector<FF> construct_gate_challenges(size_t log_n)
+{
+    std::vector<FF> gate_challenges(log_n);
+    for (size_t idx = 0; idx < log_n; idx++) {
+        gate_challenges[idx] = FF(idx + 3);
+    }
+    return gate_challenges;
+}
+
+void set_policy_label(State& state)
+{
+    state.SetLabel(numa_local_policy() ? "numa=local" : "numa=off");
+}
+} // namespace
+
+// The first sumcheck round, which reads every row of every prover polynomial
+void sumcheck_first_round(State& state) noexcept
+{
+    const auto log_n = static_cast<size_t>(state.range(0));
+    const size_t n = 1UL << log_n;
+    ProverPolynomials polynomials = construct_polynomials(log_n);
+    const RelationSeparator alpha = construct_alpha();
+    const GateSeparatorPolynomial<FF> gate_separators(construct_gate_challenges(log_n), log_n);
+    const RelationParameters<FF> relation_parameters{};
+
+    SumcheckProverRound<Flavor> round(n);
+    for (auto _ : state) {
+        DoNotOptimize(round.compute_univariate(polynomials, relation_parameters, gate_separators, alpha));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    set_policy_label(state);
+}
+
+// All rounds, including the allocation of the partially evaluated polynomials
+void sumcheck_prove(State& state) noexcept
+{
+    const auto log_n = static_cast<size_t>(state.range(0));
+    const size_t n = 1UL << log_n;
+    ProverPolynomials polynomials = construct_polynomials(log_n);
+    const RelationSeparator alpha = construct_alpha();
+    const std::vector<FF> gate_challenges = construct_gate_challenges(log_n);
+
+    for (auto _ : state) {
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        SumcheckProver<Flavor> sumcheck(n, transcript);
+        DoNotOptimize(sumcheck.prove(polynomials, {}, alpha, gate_challenges));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    set_policy_label(state);
+}
+
+BENCHMARK(sumcheck_first_round)->DenseRange(16, 20, 2)->Unit(kMillisecond);
+BENCHMARK(sumcheck_prove)->DenseRange(16, 20, 2)->Unit(kMillisecond);
+
+} // namespace bb
+
+int main(int argc, char** argv)
+{
+    bb::init_numa_policy();
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -16,6 +16,9 @@
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/batch_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/classified_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
@@ -118,6 +121,14 @@ template <class Curve> class CommitmentKey {
                                   srs->get_monomial_size()));
         }
 
+        // Commitments against the precomputed prefix of the SRS use the fixed-base tables, which need no doublings,
+        // unless the polynomial is too small to amortise the bucket setup of a fixed-base MSM
+        const auto fixed_base_table = srs->get_fixed_base_table();
+        if (fixed_base_table && polynomial.size() >= scalar_multiplication::FIXED_BASE_MIN_MSM_SIZE &&
+            polynomial.end_index() <= fixed_base_table->num_points) {
+            return scalar_multiplication::fixed_base_msm<Curve>(*fixed_base_table, polynomial);
+        }
+
         // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
         // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
         // with our polynomial span.
@@ -130,6 +141,32 @@ template <class Curve> class CommitmentKey {
         return point;
     };
 
+    /**
+     * @brief Commit to a batch of polynomials at once
+     * @details Rather than running one multithreaded pippenger per polynomial, the scalars of all polynomials are
+     * distributed over the available threads and the MSMs are computed in a single parallel region (see
+     * scalar_multiplication::batch_multi_scalar_mul). This avoids paying the pippenger setup and thread
+     * synchronisation cost for every commitment, which dominates for rounds with many small-to-medium polynomials.
+     *
+     * @param polynomials
+     * @return std::vector<Commitment> The commitment to each polynomial
+     */
+    std::vector<Commitment> batch_commit(std::span<const PolynomialSpan<const Fr>> polynomials)
+    {
+        PROFILE_THIS_NAME("batch_commit");
+        std::span<const G1> point_table = srs->get_monomial_points();
+        for (const auto& polynomial : polynomials) {
+            if (polynomial.end_index() > srs->get_monomial_size()) {
+                throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                      polynomial.end_index(),
+                                      " points with an SRS of size ",
+                                      srs->get_monomial_size()));
+            }
+        }
+        std::vector<std::span<const G1>> point_tables(polynomials.size(), point_table);
+        return scalar_multiplication::batch_multi_scalar_mul<Curve>(point_tables, polynomials);
+    }
+
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
@@ -200,6 +237,27 @@ template <class Curve> class CommitmentKey {
         return scalar_multiplication::pippenger_unsafe<Curve>({ 0, scalars }, points, pippenger_runtime_state);
     }
 
+    /**
+     * @brief Efficiently commit to a polynomial whose coefficients are mostly zero, one or small
+     * @details Extends commit_sparse: beyond skipping zeros, points with a unit coefficient are summed directly and
+     * coefficients below 2^SMALL_SCALAR_BITS are handled with a short signed-window bucket method, so that only the
+     * full-width coefficients go through pippenger. Suited to selectors and lookup read counts/tags.
+     * @warning Like commit_sparse, this copies the {point, scalar} pairs of each class; if most coefficients are
+     * full-width it falls back to a conventional pippenger over the whole polynomial.
+     *
+     * @param polynomial
+     * @return Commitment
+     */
+    Commitment commit_low_weight(PolynomialSpan<const Fr> polynomial)
+    {
+        PROFILE_THIS_NAME("commit_low_weight");
+        BB_ASSERT_LTE(polynomial.end_index(),
+                      srs->get_monomial_size(),
+                      "Attempting to commit to a polynomial that needs more points than the SRS size.");
+        return scalar_multiplication::pippenger_unsafe_with_scalar_classification<Curve>(
+            polynomial, srs->get_monomial_points(), pippenger_runtime_state);
+    }
+
     /**
      * @brief Efficiently commit to a polynomial whose nonzero elements are arranged in discrete blocks
      * @details Given a set of ranges where the polynomial takes non-zero values, copy the non-zero inputs (scalars,
@@ -348,7 +406,7 @@ template <class Curve> class CommitmentKey {
         return result;
     }
 
-    enum class CommitType { Default, Structured, Sparse, StructuredNonZeroComplement };
+    enum class CommitType { Default, Structured, Sparse, LowWeight, StructuredNonZeroComplement };
 
     Commitment commit_with_type(PolynomialSpan<const Fr> poly,
                                 CommitType type,
@@ -360,6 +418,8 @@ template <class Curve> class CommitmentKey {
             return commit_structured(poly, active_ranges, final_active_wire_idx);
         case CommitType::Sparse:
             return commit_sparse(poly);
+        case CommitType::LowWeight:
+            return commit_low_weight(poly);
         case CommitType::StructuredNonZeroComplement:
             return commit_structured_with_nonzero_complement(poly, active_ranges, final_active_wire_idx);
         case CommitType::Default:
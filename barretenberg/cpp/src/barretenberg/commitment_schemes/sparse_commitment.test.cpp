@@ -390,4 +390,62 @@ TYPED_TEST(CommitmentKeyTest, CommitStructuredNonzeroComplement)
     EXPECT_EQ(result, expected_result);
 }
 
+// Check that batch_commit agrees with committing to each polynomial individually
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const std::vector<size_t> sizes = { 3, 700, num_points, 1500 };
+    const std::vector<size_t> start_indices = { 0, 31, 0, 1024 };
+
+    std::vector<Polynomial> polynomials;
+    for (auto [size, start_index] : zip_view(sizes, start_indices)) {
+        polynomials.emplace_back(Polynomial::random(size, num_points, start_index));
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<PolynomialSpan<const Fr>> spans;
+    for (const auto& polynomial : polynomials) {
+        spans.emplace_back(polynomial);
+    }
+    std::vector<G1> batch_result = key->batch_commit(spans);
+
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        EXPECT_EQ(batch_result[i], key->commit(polynomials[i]));
+    }
+}
+
+TYPED_TEST(CommitmentKeyTest, LowWeightCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    // Selector-like polynomial with a sprinkling of small and full-width values
+    const size_t num_points = 1 << 12;
+    const size_t start_index = 13;
+    Polynomial polynomial(num_points - start_index, num_points, start_index);
+    for (size_t i = start_index; i < num_points; ++i) {
+        if (i % 3 == 0) {
+            polynomial.at(i) = Fr::one();
+        } else if (i % 7 == 0) {
+            polynomial.at(i) = Fr(i);
+        } else if (i % 11 == 0) {
+            polynomial.at(i) = Fr::random_element();
+        }
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    G1 low_weight_commitment = key->commit_low_weight(polynomial);
+    G1 commitment = key->commit(polynomial);
+    EXPECT_EQ(low_weight_commitment, commitment);
+}
+
 } // namespace bb
@@ -0,0 +1,63 @@
+#include "numa.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/env/numa_policy.hpp"
+
+#if defined(__linux__) && !defined(NO_MULTITHREADING)
+#include <pthread.h>
+#include <sched.h>
+#include <vector>
+#endif
+
+#if defined(__linux__) && defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace bb {
+
+bool numa_local_policy()
+{
+    static const bool local = env_numa_policy() == NUMA_POLICY_LOCAL;
+    return local;
+}
+
+void init_numa_policy()
+{
+#if defined(__linux__) && defined(__GLIBC__)
+    if (numa_local_policy()) {
+        constexpr int MMAP_THRESHOLD = 1 << 20;
+        mallopt(M_MMAP_THRESHOLD, MMAP_THRESHOLD);
+    }
+#endif
+}
+
+void pin_thread_to_cpu(size_t index)
+{
+#if defined(__linux__) && !defined(NO_MULTITHREADING)
+    static const std::vector<size_t> cpus = []() {
+        std::vector<size_t> cpus;
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+            for (size_t cpu = 0; cpu < static_cast<size_t>(CPU_SETSIZE); ++cpu) {
+                if (CPU_ISSET(cpu, &allowed)) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        return cpus;
+    }();
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpus[index % cpus.size()], &cpu_set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+        vinfo("Could not pin thread ", index, " to cpu ", cpus[index % cpus.size()]);
+    }
+#else
+    static_cast<void>(index);
+#endif
+}
+
+} // namespace bb
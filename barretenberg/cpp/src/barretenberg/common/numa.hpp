@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+
+namespace bb {
+
+/**
+ * @brief Whether the NUMA policy (BB_NUMA_POLICY, see env/numa_policy.hpp) is "local"
+ * @details Under the local policy, the threads of parallel_for are pinned to cores and iteration j of a top-level
+ * parallel_for always runs on the j-th of these threads (the calling thread being the 0th). Polynomials are then
+ * first-touched in the chunks the loops over them use, so that each chunk is placed on the NUMA node of the core that
+ * processes it.
+ */
+bool numa_local_policy();
+
+/**
+ * @brief Apply the process-wide settings of the NUMA policy; to be called once at startup, before any polynomial is
+ * allocated
+ * @details Under the local policy, fixes glibc's mmap threshold: glibc raises it (up to 32MiB) as large blocks are
+ * freed, after which new polynomials reuse the pages of freed ones, wherever these were placed. A fixed threshold gives
+ * every large allocation fresh pages, which are placed by the thread that first touches them. Does nothing under the
+ * off policy.
+ */
+void init_numa_policy();
+
+/**
+ * @brief Pin the calling thread to the index-th (modulo their number) of the CPUs the process may run on
+ * @details Does nothing on platforms without thread affinity.
+ */
+void pin_thread_to_cpu(size_t index);
+
+} // namespace bb
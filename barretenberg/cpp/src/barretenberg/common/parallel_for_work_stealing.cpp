@@ -0,0 +1,17 @@
+#ifndef NO_MULTITHREADING
+#include "task_scheduler.hpp"
+#include "thread.hpp"
+
+namespace bb {
+/**
+ * A work-stealing strategy (see TaskScheduler). The calling thread and one helper task per worker claim iterations
+ * from an atomic counter. Unlike the other pooled strategies, calls may be nested (e.g. an MSM inside a parallel loop
+ * over commitments) or made from several threads at once: a thread waiting for its iterations to complete executes
+ * other queued tasks, including the helper tasks of nested calls.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    TaskScheduler::get().parallel_for(num_iterations, func);
+}
+} // namespace bb
+#endif
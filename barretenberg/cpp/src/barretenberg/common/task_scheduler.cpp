@@ -0,0 +1,294 @@
+#ifndef NO_MULTITHREADING
+
+#include "task_scheduler.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace bb {
+
+namespace {
+// The scheduler, if any, of which the current thread is a worker, and its index
+thread_local const TaskScheduler* current_scheduler = nullptr;
+thread_local size_t current_worker_index = 0;
+
+/**
+ * @brief The iterations of a parallel_for, claimed one at a time by the calling thread and the helper tasks, or
+ * assigned to them statically
+ * @details Helper tasks claiming iterations may only start after all iterations have been claimed, by which time the
+ * caller may have returned. They then claim no iteration and never touch func, which only lives as long as the call.
+ * Statically assigned helper tasks each have at least one iteration, which the caller waits for.
+ *
+ * An iteration that throws still counts as completed, so the caller always waits for the other threads to leave func
+ * before it rethrows the exception; the iterations that start after it are skipped.
+ */
+struct ParallelForJob {
+    const std::function<void(size_t)>& func;
+    const size_t num_iterations;
+    std::atomic<size_t> next_iteration = 0;
+    std::atomic<size_t> num_completed = 0;
+    std::atomic<bool> failed = false;
+    std::mutex mutex;
+    std::condition_variable complete_condition;
+    // The first exception thrown by func, guarded by mutex
+    std::exception_ptr exception;
+
+    ParallelForJob(const std::function<void(size_t)>& func, size_t num_iterations)
+        : func(func)
+        , num_iterations(num_iterations)
+    {}
+
+    bool is_complete() const { return num_completed.load() == num_iterations; }
+
+    void run_iteration(size_t i)
+    {
+        if (failed.load()) {
+            return;
+        }
+        try {
+            func(i);
+        } catch (...) {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+            failed = true;
+        }
+    }
+
+    /**
+     * @brief Rethrow the first exception thrown by func, if any, once the job is complete
+     */
+    void rethrow_exception()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void run_iterations()
+    {
+        size_t num_run = 0;
+        for (size_t i = next_iteration++; i < num_iterations; i = next_iteration++) {
+            run_iteration(i);
+            num_run++;
+        }
+        complete(num_run);
+    }
+
+    void run_strided_iterations(size_t first, size_t stride)
+    {
+        size_t num_run = 0;
+        for (size_t i = first; i < num_iterations; i += stride) {
+            run_iteration(i);
+            num_run++;
+        }
+        complete(num_run);
+    }
+
+    void complete(size_t num_run)
+    {
+        if (num_run > 0 && num_completed.fetch_add(num_run) + num_run == num_iterations) {
+            std::unique_lock<std::mutex> lock(mutex);
+            complete_condition.notify_all();
+        }
+    }
+};
+} // namespace
+
+TaskScheduler::TaskScheduler(size_t num_workers, bool local_policy)
+    : numa_local(local_policy)
+{
+    deques.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        deques.emplace_back(std::make_unique<TaskDeque>());
+    }
+    if (numa_local) {
+        pin_thread_to_cpu(0);
+    }
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&TaskScheduler::worker_loop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+TaskScheduler& TaskScheduler::get()
+{
+    static TaskScheduler scheduler(get_num_cpus() - 1);
+    return scheduler;
+}
+
+size_t TaskScheduler::current_deque_index() const
+{
+    return current_scheduler == this ? current_worker_index : workers.size();
+}
+
+void TaskScheduler::push(Task task, size_t affinity, bool pinned)
+{
+    size_t deque_index = current_deque_index();
+    if (affinity != NO_AFFINITY && !workers.empty()) {
+        deque_index = affinity % workers.size();
+    }
+    std::unique_lock<std::mutex> lock(deques[deque_index]->mutex);
+    deques[deque_index]->tasks.push_back({ std::move(task), pinned });
+}
+
+void TaskScheduler::submit(Task task, size_t affinity)
+{
+    // Count the task before it becomes visible, so that the count never drops below the number of queued tasks
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_queued++;
+    }
+    push(std::move(task), affinity);
+    sleep_condition.notify_one();
+}
+
+/**
+ * @brief Pop a task from the back of the given deque or, failing that, steal the first task that is not pinned from
+ * another deque, and run it
+ *
+ * @return Whether a task was run
+ */
+bool TaskScheduler::run_one_task(size_t deque_index)
+{
+    QueuedTask queued;
+    {
+        auto& own = *deques[deque_index];
+        std::unique_lock<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            queued = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+    for (size_t offset = 1; !queued.task && offset < deques.size(); ++offset) {
+        auto& other = *deques[(deque_index + offset) % deques.size()];
+        std::unique_lock<std::mutex> lock(other.mutex);
+        auto it = std::find_if(
+            other.tasks.begin(), other.tasks.end(), [](const QueuedTask& candidate) { return !candidate.pinned; });
+        if (it != other.tasks.end()) {
+            queued = std::move(*it);
+            other.tasks.erase(it);
+        }
+    }
+    if (!queued.task) {
+        return false;
+    }
+    if (queued.pinned) {
+        deques[deque_index]->num_pinned--;
+    } else {
+        num_queued--;
+    }
+    queued.task();
+    return true;
+}
+
+void TaskScheduler::worker_loop(size_t worker_index)
+{
+    current_scheduler = this;
+    current_worker_index = worker_index;
+    if (numa_local) {
+        pin_thread_to_cpu(worker_index + 1);
+    }
+    const auto& own = *deques[worker_index];
+    while (true) {
+        if (run_one_task(worker_index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        sleep_condition.wait(lock, [&] { return stop || num_queued > 0 || own.num_pinned > 0; });
+        if (stop && num_queued == 0 && own.num_pinned == 0) {
+            break;
+        }
+    }
+}
+
+void TaskScheduler::parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    if (numa_local && current_scheduler != this) {
+        parallel_for_static(num_iterations, func);
+        return;
+    }
+    auto job = std::make_shared<ParallelForJob>(func, num_iterations);
+
+    // One helper task per other thread that may take part, spread over the workers other than the current one
+    const size_t num_helpers = std::min(num_iterations, workers.size() + 1) - 1;
+    const size_t first_worker = current_deque_index() + 1;
+    if (num_helpers > 0) {
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            num_queued += num_helpers;
+        }
+        for (size_t i = 0; i < num_helpers; ++i) {
+            push([job]() { job->run_iterations(); }, first_worker + i);
+        }
+        sleep_condition.notify_all();
+    }
+
+    job->run_iterations();
+
+    // The remaining iterations are running on other threads. Help with other tasks (e.g. those of parallel_for calls
+    // nested in these iterations) until they complete.
+    constexpr auto WAIT_TIME = std::chrono::microseconds(100);
+    help_until([&]() { return job->is_complete(); },
+               [&]() {
+                   std::unique_lock<std::mutex> lock(job->mutex);
+                   job->complete_condition.wait_for(lock, WAIT_TIME, [&]() { return job->is_complete(); });
+               });
+    job->rethrow_exception();
+}
+
+/**
+ * @brief Run iteration i on thread i % (num_workers() + 1), see the class description
+ */
+void TaskScheduler::parallel_for_static(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    auto job = std::make_shared<ParallelForJob>(func, num_iterations);
+
+    const size_t num_threads = std::min(num_iterations, workers.size() + 1);
+    if (num_threads > 1) {
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            for (size_t worker_index = 0; worker_index < num_threads - 1; ++worker_index) {
+                deques[worker_index]->num_pinned++;
+            }
+        }
+        for (size_t worker_index = 0; worker_index < num_threads - 1; ++worker_index) {
+            push([job, worker_index, num_threads]() { job->run_strided_iterations(worker_index + 1, num_threads); },
+                 worker_index,
+                 /*pinned=*/true);
+        }
+        sleep_condition.notify_all();
+    }
+
+    job->run_strided_iterations(0, num_threads);
+
+    // Help with other tasks (e.g. those of parallel_for calls nested in the iterations) until the workers are done
+    constexpr auto WAIT_TIME = std::chrono::microseconds(100);
+    help_until([&]() { return job->is_complete(); },
+               [&]() {
+                   std::unique_lock<std::mutex> lock(job->mutex);
+                   job->complete_condition.wait_for(lock, WAIT_TIME, [&]() { return job->is_complete(); });
+               });
+    job->rethrow_exception();
+}
+
+} // namespace bb
+
+#endif
@@ -0,0 +1,150 @@
+#pragma once
+
+#ifndef NO_MULTITHREADING
+
+#include "barretenberg/common/numa.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A work-stealing task scheduler
+ * @details Each worker thread owns a deque of tasks. A worker pushes and pops tasks at the back of its own deque and,
+ * when the deque is empty, steals tasks from the front of the other deques. Threads that are not workers of the
+ * scheduler submit their tasks to an extra injection deque that the workers steal from.
+ *
+ * A thread that waits for tasks (the caller of parallel_for or of wait) executes queued tasks while it waits, so tasks
+ * may themselves call parallel_for or spawn and wait for further tasks without exhausting the workers: nested
+ * parallelism runs on the same set of threads instead of serialising or deadlocking.
+ *
+ * Tasks may carry an affinity hint, the index of the worker whose deque they are pushed to. The hint only decides where
+ * a task starts out; any idle worker may steal it.
+ *
+ * Under the local NUMA policy (see numa.hpp) the workers, and the thread that creates the scheduler, are pinned to
+ * cores, and a parallel_for called from outside the workers runs iteration i on thread i % (num_workers() + 1), the
+ * calling thread being thread 0 and worker k thread k + 1. The helper tasks of such a loop are pinned to their workers
+ * rather than stolen, so that loops over the same chunks of memory access each chunk from the same core.
+ */
+class TaskScheduler {
+  public:
+    using Task = std::function<void()>;
+
+    static constexpr size_t NO_AFFINITY = std::numeric_limits<size_t>::max();
+
+    /**
+     * @param local_policy Whether to pin the threads and schedule top-level loops statically (see above)
+     */
+    explicit TaskScheduler(size_t num_workers, bool local_policy = numa_local_policy());
+    TaskScheduler(const TaskScheduler& other) = delete;
+    TaskScheduler(TaskScheduler&& other) = delete;
+    ~TaskScheduler();
+
+    TaskScheduler& operator=(const TaskScheduler& other) = delete;
+    TaskScheduler& operator=(TaskScheduler&& other) = delete;
+
+    /**
+     * @brief The scheduler behind parallel_for, with get_num_cpus() - 1 workers (the calling thread is the last one)
+     */
+    static TaskScheduler& get();
+
+    size_t num_workers() const { return workers.size(); }
+
+    /**
+     * @brief Queue a task, on the deque of the given worker if an affinity is given
+     */
+    void submit(Task task, size_t affinity = NO_AFFINITY);
+
+    /**
+     * @brief Run func(i) for i in [0, num_iterations) on the calling thread and the workers, and return once all
+     * iterations have completed
+     * @details May be called from within a task. Iterations are claimed dynamically, except for the loops of
+     * non-worker threads under the local NUMA policy, which are assigned statically (see above). If an iteration
+     * throws, the iterations that have not started yet are skipped and, once no other thread runs an iteration, the
+     * first exception is rethrown on the calling thread.
+     */
+    void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+    /**
+     * @brief Queue func as a task and return a future for its result
+     * @note A task waiting for the result of another task should use wait() rather than future.get(), so that the
+     * waiting worker keeps executing tasks.
+     */
+    template <typename Func>
+    std::future<std::invoke_result_t<Func>> spawn(Func&& func, size_t affinity = NO_AFFINITY)
+    {
+        using Result = std::invoke_result_t<Func>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+        std::future<Result> future = task->get_future();
+        submit([task]() { (*task)(); }, affinity);
+        return future;
+    }
+
+    /**
+     * @brief Execute queued tasks until the future is ready, then return its result
+     */
+    template <typename T> T wait(std::future<T>& future)
+    {
+        constexpr auto WAIT_TIME = std::chrono::microseconds(100);
+        help_until([&]() { return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; },
+                   [&]() { future.wait_for(WAIT_TIME); });
+        return future.get();
+    }
+
+  private:
+    struct QueuedTask {
+        Task task;
+        // Whether the task may only be run by the owner of its deque
+        bool pinned = false;
+    };
+
+    struct TaskDeque {
+        std::mutex mutex;
+        std::deque<QueuedTask> tasks;
+        std::atomic<size_t> num_pinned = 0;
+    };
+
+    const bool numa_local;
+    // One deque per worker, followed by the injection deque of the threads that are not workers
+    std::vector<std::unique_ptr<TaskDeque>> deques;
+    std::vector<std::thread> workers;
+    // The number of queued tasks that are not pinned
+    std::atomic<size_t> num_queued = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool stop = false;
+
+    size_t current_deque_index() const;
+    void push(Task task, size_t affinity, bool pinned = false);
+    void parallel_for_static(size_t num_iterations, const std::function<void(size_t)>& func);
+    bool run_one_task(size_t deque_index);
+    void worker_loop(size_t worker_index);
+
+    /**
+     * @brief Execute queued tasks until done() holds, calling wait() (which should block briefly) when there are none
+     */
+    template <typename Done, typename Wait> void help_until(const Done& done, const Wait& wait)
+    {
+        const size_t deque_index = current_deque_index();
+        while (!done()) {
+            if (!run_one_task(deque_index)) {
+                wait();
+            }
+        }
+    }
+};
+
+} // namespace bb
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef NO_MULTITHREADING
+#include "task_scheduler.hpp"
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace bb;
+
+namespace {
+constexpr size_t NUM_WORKERS = 3;
+
+// Count the iterations of a loop, checking that each one runs exactly once
+void check_each_iteration_runs_once(TaskScheduler& scheduler, size_t num_iterations)
+{
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+    scheduler.parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+    for (size_t i = 0; i < num_iterations; ++i) {
+        EXPECT_EQ(counts[i].load(), 1) << "iteration " << i;
+    }
+}
+} // namespace
+
+TEST(TaskScheduler, IterationCounts)
+{
+    TaskScheduler scheduler(NUM_WORKERS, /*local_policy=*/false);
+    for (size_t num_iterations : { 0UL, 1UL, 2UL, NUM_WORKERS + 1, 1000UL }) {
+        check_each_iteration_runs_once(scheduler, num_iterations);
+    }
+}
+
+TEST(TaskScheduler, NoWorkers)
+{
+    // All the work then happens on the calling thread, including tasks waited for
+    TaskScheduler scheduler(0, /*local_policy=*/false);
+    check_each_iteration_runs_once(scheduler, 100);
+    auto future = scheduler.spawn([]() { return 42; });
+    EXPECT_EQ(scheduler.wait(future), 42);
+}
+
+TEST(TaskScheduler, NestedParallelFor)
+{
+    TaskScheduler scheduler(NUM_WORKERS, /*local_policy=*/false);
+    constexpr size_t OUTER = 16;
+    constexpr size_t INNER = 64;
+    std::vector<std::atomic<size_t>> counts(OUTER * INNER);
+    scheduler.parallel_for(OUTER, [&](size_t i) {
+        scheduler.parallel_for(INNER, [&](size_t j) {
+            // A third level, which runs on whichever threads are free
+            scheduler.parallel_for(2, [&](size_t k) {
+                if (k == 0) {
+                    counts[i * INNER + j]++;
+                }
+            });
+        });
+    });
+    for (const auto& count : counts) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(TaskScheduler, ConcurrentCallers)
+{
+    TaskScheduler scheduler(NUM_WORKERS, /*local_policy=*/false);
+    constexpr size_t NUM_CALLERS = 4;
+    constexpr size_t NUM_ITERATIONS = 500;
+    std::vector<size_t> sums(NUM_CALLERS);
+    std::vector<std::thread> callers;
+    for (size_t caller = 0; caller < NUM_CALLERS; ++caller) {
+        callers.emplace_back([&, caller]() {
+            for (size_t round = 0; round < 10; ++round) {
+                std::vector<size_t> values(NUM_ITERATIONS);
+                scheduler.parallel_for(NUM_ITERATIONS, [&](size_t i) { values[i] = i + caller; });
+                sums[caller] += std::accumulate(values.begin(), values.end(), size_t(0));
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (size_t caller = 0; caller < NUM_CALLERS; ++caller) {
+        EXPECT_EQ(sums[caller], 10 * (NUM_ITERATIONS * (NUM_ITERATIONS - 1) / 2 + NUM_ITERATIONS * caller));
+    }
+}
+
+TEST(TaskScheduler, SpawnAndWait)
+{
+    TaskScheduler scheduler(NUM_WORKERS, /*local_policy=*/false);
+    // Tasks that wait for tasks they spawn, deeper than there are workers
+    std::function<size_t(size_t)> fibonacci = [&](size_t n) -> size_t {
+        if (n < 2) {
+            return n;
+        }
+        auto future = scheduler.spawn([&, n]() { return fibonacci(n - 1); });
+        const size_t other = fibonacci(n - 2);
+        return scheduler.wait(future) + other;
+    };
+    auto future = scheduler.spawn([&]() { return fibonacci(15); });
+    EXPECT_EQ(scheduler.wait(future), 610);
+
+    auto failing = scheduler.spawn([]() -> int { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(scheduler.wait(failing), std::runtime_error);
+}
+
+TEST(TaskScheduler, AffinityHint)
+{
+    TaskScheduler scheduler(NUM_WORKERS, /*local_policy=*/false);
+    // Hints beyond the number of workers wrap around, and every hinted task runs once
+    constexpr size_t NUM_TASKS = 4 * NUM_WORKERS + 1;
+    std::vector<std::future<size_t>> futures;
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        futures.push_back(scheduler.spawn([i]() { return i; }, /*affinity=*/i));
+    }
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        EXPECT_EQ(scheduler.wait(futures[i]), i);
+    }
+
+    // A task hinted to a worker that may be busy with a long task still runs
+    std::atomic<bool> started = false;
+    std::atomic<bool> release = false;
+    auto blocker = scheduler.spawn(
+        [&]() {
+            started = true;
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+        },
+        /*affinity=*/0);
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+    auto stolen = scheduler.spawn([]() { return 1; }, /*affinity=*/0);
+    EXPECT_EQ(scheduler.wait(stolen), 1);
+    release = true;
+    scheduler.wait(blocker);
+}
+
+TEST(TaskScheduler, Exceptions)
+{
+    TaskScheduler scheduler(NUM_WORKERS, /*local_policy=*/false);
+    for (size_t failing_iteration : { 0UL, 7UL, 99UL }) {
+        std::atomic<size_t> num_running = 0;
+        EXPECT_THROW(scheduler.parallel_for(100,
+                                            [&](size_t i) {
+                                                num_running++;
+                                                std::this_thread::sleep_for(std::chrono::microseconds(10));
+                                                num_running--;
+                                                if (i == failing_iteration) {
+                                                    throw std::runtime_error("iteration failed");
+                                                }
+                                            }),
+                     std::runtime_error);
+        // No iteration is still running once the exception reaches the caller
+        EXPECT_EQ(num_running.load(), 0);
+    }
+    // The scheduler remains usable
+    check_each_iteration_runs_once(scheduler, 100);
+}
+
+/**
+ * @brief Under the local NUMA policy, iteration i of a top-level loop runs on thread i % (num_workers() + 1), the
+ * calling thread being thread 0, and nested loops run as usual
+ */
+TEST(TaskScheduler, StaticScheduling)
+{
+    // The scheduler pins the thread that constructs it, so it runs on a thread of its own, leaving the affinity of the
+    // test thread, and so of the tests that follow, untouched.
+    std::thread test_thread([]() {
+        TaskScheduler scheduler(NUM_WORKERS, /*local_policy=*/true);
+        const size_t num_threads = scheduler.num_workers() + 1;
+        for (size_t round = 0; round < 3; ++round) {
+            constexpr size_t NUM_ITERATIONS = 40;
+            std::vector<std::thread::id> thread_ids(NUM_ITERATIONS);
+            std::vector<std::atomic<size_t>> nested_counts(NUM_ITERATIONS);
+            std::vector<int> num_allowed_cpus(NUM_ITERATIONS, 1);
+            scheduler.parallel_for(NUM_ITERATIONS, [&](size_t i) {
+                thread_ids[i] = std::this_thread::get_id();
+#ifdef __linux__
+                // The threads of the loop are pinned to a single CPU each
+                cpu_set_t cpu_set;
+                CPU_ZERO(&cpu_set);
+                if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0) {
+                    num_allowed_cpus[i] = CPU_COUNT(&cpu_set);
+                }
+#endif
+                scheduler.parallel_for(4, [&](size_t) { nested_counts[i]++; });
+            });
+            EXPECT_EQ(thread_ids[0], std::this_thread::get_id());
+            std::set<std::thread::id> distinct;
+            for (size_t i = 0; i < NUM_ITERATIONS; ++i) {
+                EXPECT_EQ(thread_ids[i], thread_ids[i % num_threads]) << "iteration " << i;
+                EXPECT_EQ(nested_counts[i].load(), 4);
+                EXPECT_EQ(num_allowed_cpus[i], 1) << "iteration " << i;
+                distinct.insert(thread_ids[i]);
+            }
+            EXPECT_EQ(distinct.size(), num_threads);
+        }
+
+        // Fewer iterations than threads, and exceptions
+        check_each_iteration_runs_once(scheduler, 0);
+        check_each_iteration_runs_once(scheduler, 1);
+        check_each_iteration_runs_once(scheduler, 2);
+        EXPECT_THROW(scheduler.parallel_for(10,
+                                            [](size_t i) {
+                                                if (i == 3) {
+                                                    throw std::runtime_error("iteration failed");
+                                                }
+                                            }),
+                     std::runtime_error);
+        check_each_iteration_runs_once(scheduler, 10);
+    });
+    test_thread.join();
+}
+#endif
@@ -34,6 +34,12 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the pools above run one flat iteration range at a time, so a parallel_for nested in another one
+ * (or called concurrently from two threads) either aborts or serialises. "work_stealing" keeps a deque of tasks per
+ * worker and has waiting threads execute queued tasks, which makes nested and concurrent calls run on the same
+ * workers. A flat loop is divided as in the other pools (the calling thread and the workers claim iterations from an
+ * atomic counter), so it is now the default.
  */
 
 namespace bb {
@@ -69,6 +75,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,8 +90,9 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
 #endif
 #endif
 }
@@ -6,15 +6,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
+#include <numeric>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -28,6 +33,7 @@
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 
 namespace bb::crypto::merkle_tree {
@@ -51,6 +57,7 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     using AppendCompletionCallback = std::function<void(TypedResponse<AddDataResponse>&)>;
     using MetaDataCallback = std::function<void(TypedResponse<TreeMetaResponse>&)>;
     using HashPathCallback = std::function<void(TypedResponse<GetSiblingPathResponse>&)>;
+    using HashPathsCallback = std::function<void(TypedResponse<GetSiblingPathsResponse>&)>;
     using FindLeafCallback = std::function<void(TypedResponse<FindLeafIndexResponse>&)>;
     using GetLeafCallback = std::function<void(TypedResponse<GetLeafResponse>&)>;
     using CommitCallback = std::function<void(TypedResponse<CommitResponse>&)>;
@@ -108,6 +115,30 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                           const HashPathCallback& on_completion,
                           bool includeUncommitted) const;
 
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root, in the order of the indices
+     * @details The indices are sorted so that the nodes on the shared prefixes of their paths are read once, and split
+     * into ranges that are walked concurrently on the thread pool
+     * @param indices The indices at which to read the sibling paths
+     * @param on_completion Callback to be called on completion
+     * @param includeUncommitted Whether to include uncommitted changes
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root, in the order of the indices
+     * @param indices The indices at which to read the sibling paths
+     * @param blockNumber The block number of the tree to use as a reference
+     * @param on_completion Callback to be called on completion
+     * @param includeUncommitted Whether to include uncommitted changes
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const block_number_t& blockNumber,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
     /**
      * @brief Get the subtree sibling path object
      *
@@ -219,6 +250,16 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
      */
     void commit(const CommitCallback& on_completion);
 
+    /**
+     * @brief Completes a block from the uncommitted changes, to be persisted with the next commit
+     */
+    void stage_block(const CommitCallback& on_completion);
+
+    /**
+     * @brief Commit the staged blocks to the backing store in a single write transaction
+     */
+    void commit_staged_blocks(const CommitCallback& on_completion);
+
     /**
      * @brief Rollback the uncommitted changes
      */
@@ -229,6 +270,15 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
      */
     uint32_t depth() const { return depth_; }
 
+    /**
+     * @brief Synchronous method to create a store holding a copy-on-write fork of the tree's uncommitted state, from
+     * which a new tree can be constructed. The tree must be a fork and no other operations may be in progress.
+     */
+    std::unique_ptr<Store> fork_uncommitted_store()
+    {
+        return std::make_unique<Store>(store_->get_name(), depth_, *store_);
+    }
+
     void remove_historic_block(const block_number_t& blockNumber, const RemoveHistoricBlockCallback& on_completion);
 
     void unwind_block(const block_number_t& blockNumber, const UnwindBlockCallback& on_completion);
@@ -261,6 +311,18 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                                                           const RequestContext& requestContext,
                                                           ReadTransaction& tx) const;
 
+    void get_sibling_paths_internal(const std::vector<index_t>& indices,
+                                    const RequestContext& requestContext,
+                                    const HashPathsCallback& on_completion) const;
+
+    void walk_sibling_paths(const std::optional<fr>& hash,
+                            uint32_t level,
+                            std::span<const size_t> positions,
+                            const std::vector<index_t>& indices,
+                            std::vector<fr_sibling_path>& paths,
+                            const RequestContext& requestContext,
+                            ReadTransaction& tx) const;
+
     std::optional<fr> find_leaf_hash(const index_t& leaf_index,
                                      const RequestContext& requestContext,
                                      ReadTransaction& tx,
@@ -271,6 +333,13 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    void hash_subtree(std::span<fr> hashes, uint32_t level, index_t index);
+
+    void hash_subtrees_in_parallel(std::span<fr> hashes, uint32_t level, index_t index, size_t num_subtrees);
+
+    // Appended batches below this size are hashed on the calling thread only
+    static constexpr size_t MIN_PARALLEL_SUBTREE_SIZE = 64;
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -420,6 +489,176 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_path(cons
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    auto job = [=, this]() {
+        RequestContext requestContext;
+        bool resolved = false;
+        // Only failures to resolve the root are reported here, the walk reports its own result
+        execute_and_report<GetSiblingPathsResponse>(
+            [&](TypedResponse<GetSiblingPathsResponse>&) {
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = store_->get_current_root(*tx, includeUncommitted);
+                resolved = true;
+            },
+            [&](TypedResponse<GetSiblingPathsResponse>& response) {
+                if (!response.success) {
+                    on_completion(response);
+                }
+            });
+        if (resolved) {
+            get_sibling_paths_internal(indices, requestContext, on_completion);
+        }
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const block_number_t& blockNumber,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    auto job = [=, this]() {
+        RequestContext requestContext;
+        bool resolved = false;
+        // Only failures to resolve the root are reported here, the walk reports its own result
+        execute_and_report<GetSiblingPathsResponse>(
+            [&](TypedResponse<GetSiblingPathsResponse>&) {
+                if (blockNumber == 0) {
+                    throw std::runtime_error("Unable to get sibling paths at block 0");
+                }
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                BlockPayload blockData;
+                if (!store_->get_block_data(blockNumber, blockData, *tx)) {
+                    throw std::runtime_error(
+                        format("Unable to get sibling paths at block ", blockNumber, ", failed to get block data."));
+                }
+                requestContext.blockNumber = blockNumber;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = blockData.root;
+                resolved = true;
+            },
+            [&](TypedResponse<GetSiblingPathsResponse>& response) {
+                if (!response.success) {
+                    on_completion(response);
+                }
+            });
+        if (resolved) {
+            get_sibling_paths_internal(indices, requestContext, on_completion);
+        }
+    };
+    workers_->enqueue(job);
+}
+
+/**
+ * @brief Walks the sorted indices in contiguous ranges, one job per range, and reports once all ranges are walked
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_internal(
+    const std::vector<index_t>& indices,
+    const RequestContext& requestContext,
+    const HashPathsCallback& on_completion) const
+{
+    struct State {
+        std::vector<index_t> indices;
+        // The positions of the indices, in increasing order of index
+        std::vector<size_t> positions;
+        std::vector<fr_sibling_path> paths;
+        std::atomic<size_t> remaining;
+        std::atomic_bool success{ true };
+        std::string message;
+    };
+    auto state = std::make_shared<State>();
+    state->indices = indices;
+    state->positions.resize(indices.size());
+    std::iota(state->positions.begin(), state->positions.end(), 0);
+    std::sort(state->positions.begin(), state->positions.end(), [&](size_t a, size_t b) {
+        return indices[a] < indices[b];
+    });
+    state->paths.resize(indices.size(), fr_sibling_path(depth_));
+
+    const size_t num_ranges = std::max<size_t>(std::min<size_t>(workers_->num_threads(), indices.size()), 1);
+    state->remaining = num_ranges;
+    for (size_t range = 0; range < num_ranges; ++range) {
+        const size_t start = range * indices.size() / num_ranges;
+        const size_t end = (range + 1) * indices.size() / num_ranges;
+        workers_->enqueue([=, this]() {
+            try {
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                walk_sibling_paths(requestContext.root,
+                                   0,
+                                   std::span<const size_t>(state->positions).subspan(start, end - start),
+                                   state->indices,
+                                   state->paths,
+                                   requestContext,
+                                   *tx);
+            } catch (std::exception& e) {
+                if (state->success.exchange(false)) {
+                    state->message = e.what();
+                }
+            }
+            if (state->remaining.fetch_sub(1) != 1) {
+                return;
+            }
+            TypedResponse<GetSiblingPathsResponse> response;
+            response.success = state->success;
+            if (response.success) {
+                response.inner.paths = std::move(state->paths);
+            } else {
+                response.message = state->message;
+            }
+            try {
+                on_completion(response);
+            } catch (std::exception&) {
+            }
+        });
+    }
+}
+
+/**
+ * @brief Writes the siblings at and below the given level of the paths to the given, sorted, positions, all of whose
+ * indices lie below the node with the given hash. Each node is read once, however many of the paths pass through it.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::walk_sibling_paths(const std::optional<fr>& hash,
+                                                                              uint32_t level,
+                                                                              std::span<const size_t> positions,
+                                                                              const std::vector<index_t>& indices,
+                                                                              std::vector<fr_sibling_path>& paths,
+                                                                              const RequestContext& requestContext,
+                                                                              ReadTransaction& tx) const
+{
+    if (level == depth_ || positions.empty()) {
+        return;
+    }
+    // An absent node is the root of an empty subtree, whose children are empty subtrees too
+    NodePayload nodePayload;
+    if (hash.has_value()) {
+        store_->get_node_by_hash(hash.value(), nodePayload, tx, requestContext.includeUncommitted);
+    }
+    const size_t path_index = depth_ - 1 - level;
+    const index_t mask = index_t(1) << path_index;
+    auto right_begin = std::partition_point(
+        positions.begin(), positions.end(), [&](size_t position) { return (indices[position] & mask) == 0; });
+    std::span<const size_t> left_positions(positions.begin(), right_begin);
+    std::span<const size_t> right_positions(right_begin, positions.end());
+
+    const fr& zero_hash = zero_hashes_[level + 1];
+    for (size_t position : left_positions) {
+        paths[position][path_index] = nodePayload.right.value_or(zero_hash);
+    }
+    for (size_t position : right_positions) {
+        paths[position][path_index] = nodePayload.left.value_or(zero_hash);
+    }
+    walk_sibling_paths(nodePayload.left, level + 1, left_positions, indices, paths, requestContext, tx);
+    walk_sibling_paths(nodePayload.right, level + 1, right_positions, indices, paths, requestContext, tx);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_block_numbers(
     const std::vector<index_t>& indices, const GetBlockForIndexCallback& on_completion) const
@@ -852,6 +1091,32 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit(const CommitCa
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::stage_block(const CommitCallback& on_completion)
+{
+    auto job = [=, this]() {
+        execute_and_report<CommitResponse>(
+            [=, this](TypedResponse<CommitResponse>& response) {
+                store_->stage_block(response.inner.meta, response.inner.stats);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit_staged_blocks(const CommitCallback& on_completion)
+{
+    auto job = [=, this]() {
+        execute_and_report<CommitResponse>(
+            [=, this](TypedResponse<CommitResponse>& response) {
+                store_->commit_staged_blocks(response.inner.meta, response.inner.stats);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::rollback(const RollbackCallback& on_completion)
 {
@@ -1025,23 +1290,28 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         }
     }
 
-    // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
-        index >>= 1;
-        --level;
-        // std::cout << "To INSERT " << number_to_insert << std::endl;
-        for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
+    // Hash the values as a sub tree and insert them. The batch is an aligned sub tree, as are equal sized slices of
+    // it, so large batches are split into one sub tree per worker, hashed concurrently and then merged at the top
+    size_t num_subtrees = 1;
+    while (num_subtrees * 2 <= workers_->num_threads() &&
+           number_to_insert / (num_subtrees * 2) >= MIN_PARALLEL_SUBTREE_SIZE) {
+        num_subtrees *= 2;
+    }
+    if (num_subtrees > 1) {
+        const size_t subtree_size = number_to_insert / num_subtrees;
+        hash_subtrees_in_parallel(hashes_local, level, index, num_subtrees);
+        for (size_t i = 1; i < num_subtrees; ++i) {
+            hashes_local[i] = hashes_local[i * subtree_size];
         }
+        const auto subtree_depth = static_cast<uint32_t>(numeric::get_msb(subtree_size));
+        number_to_insert = static_cast<uint32_t>(num_subtrees);
+        index >>= subtree_depth;
+        level -= subtree_depth;
     }
+    const uint32_t top_depth = numeric::get_msb(number_to_insert);
+    hash_subtree(std::span<fr>(hashes_local.data(), number_to_insert), level, index);
+    index >>= top_depth;
+    level -= top_depth;
 
     fr new_hash = hashes_local[0];
 
@@ -1086,4 +1356,80 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     store_->put_meta(meta);
 }
 
+/**
+ * @brief Hashes an aligned sub tree from its leaves up to its root, writing every node above the leaves to the store
+ * @param hashes The leaves of the sub tree, a power of 2 of them. On return the first element holds the sub tree root.
+ * @param level The level of the leaves
+ * @param index The index of the first leaf at that level
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_subtree(std::span<fr> hashes,
+                                                                        uint32_t level,
+                                                                        index_t index)
+{
+    size_t number_to_insert = hashes.size();
+    std::vector<fr> parents(number_to_insert / 2);
+    while (number_to_insert > 1) {
+        number_to_insert >>= 1;
+        index >>= 1;
+        --level;
+        // Hash the whole level at once, the children are still needed to write the nodes
+        HashingPolicy::hash_pairs(hashes.first(number_to_insert * 2), std::span(parents.data(), number_to_insert));
+        for (size_t i = 0; i < number_to_insert; ++i) {
+            store_->put_node_by_hash(parents[i], { .left = hashes[i * 2], .right = hashes[i * 2 + 1], .ref = 1 });
+            store_->put_cached_node_by_index(level, index + i, parents[i]);
+        }
+        std::copy(parents.begin(), parents.begin() + static_cast<std::ptrdiff_t>(number_to_insert), hashes.begin());
+    }
+}
+
+/**
+ * @brief Splits the leaves into num_subtrees equal sub trees and hashes them on the workers
+ * @details The calling thread is usually a worker itself, so rather than waiting on jobs that may be queued behind
+ * other blocked callers it claims sub trees alongside the helper jobs it enqueues. It only ever waits for sub trees
+ * already being hashed by a running worker. On return, the root of each sub tree is the first element of its slice.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_subtrees_in_parallel(std::span<fr> hashes,
+                                                                                     uint32_t level,
+                                                                                     index_t index,
+                                                                                     size_t num_subtrees)
+{
+    struct State {
+        std::atomic<size_t> next = 0;
+        Signal remaining;
+        std::mutex mtx;
+        std::exception_ptr error;
+
+        State(size_t num_subtrees)
+            : remaining(static_cast<uint32_t>(num_subtrees))
+        {}
+    };
+    auto state = std::make_shared<State>(num_subtrees);
+    const size_t subtree_size = hashes.size() / num_subtrees;
+
+    // Helper jobs may start after the caller has returned, they must only touch the hashes once they claim a sub tree
+    auto claim_subtrees = [=, this]() {
+        for (size_t subtree = state->next++; subtree < num_subtrees; subtree = state->next++) {
+            try {
+                const size_t offset = subtree * subtree_size;
+                hash_subtree(hashes.subspan(offset, subtree_size), level, index + offset);
+            } catch (...) {
+                std::unique_lock lock(state->mtx);
+                state->error = std::current_exception();
+            }
+            state->remaining.signal_decrement();
+        }
+    };
+    for (size_t i = 1; i < num_subtrees; ++i) {
+        workers_->enqueue(claim_subtrees);
+    }
+    claim_subtrees();
+    state->remaining.wait_for_level(0);
+
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
 } // namespace bb::crypto::merkle_tree
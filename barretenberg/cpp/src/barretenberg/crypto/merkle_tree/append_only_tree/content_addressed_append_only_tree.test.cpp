@@ -140,6 +140,39 @@ void check_historic_sibling_path(TreeType& tree,
     signal.wait_for_level();
 }
 
+void check_sibling_paths(TreeType& tree,
+                         const std::vector<index_t>& indices,
+                         const std::vector<fr_sibling_path>& expected_sibling_paths,
+                         bool includeUncommitted = true)
+{
+    Signal signal;
+    auto completion = [&](const TypedResponse<GetSiblingPathsResponse>& response) -> void {
+        EXPECT_TRUE(response.success);
+        EXPECT_EQ(response.inner.paths, expected_sibling_paths);
+        signal.signal_level();
+    };
+    tree.get_sibling_paths(indices, completion, includeUncommitted);
+    signal.wait_for_level();
+}
+
+void check_historic_sibling_paths(TreeType& tree,
+                                  const std::vector<index_t>& indices,
+                                  const std::vector<fr_sibling_path>& expected_sibling_paths,
+                                  block_number_t blockNumber,
+                                  bool expected_success = true)
+{
+    Signal signal;
+    auto completion = [&](const TypedResponse<GetSiblingPathsResponse>& response) -> void {
+        EXPECT_EQ(response.success, expected_success);
+        if (response.success) {
+            EXPECT_EQ(response.inner.paths, expected_sibling_paths);
+        }
+        signal.signal_level();
+    };
+    tree.get_sibling_paths(indices, blockNumber, completion, false);
+    signal.wait_for_level();
+}
+
 void commit_tree(TreeType& tree, bool expected_success = true)
 {
     Signal signal;
@@ -151,6 +184,28 @@ void commit_tree(TreeType& tree, bool expected_success = true)
     signal.wait_for_level();
 }
 
+void stage_block(TreeType& tree, bool expected_success = true)
+{
+    Signal signal;
+    TreeType::CommitCallback completion = [&](const TypedResponse<CommitResponse>& response) -> void {
+        EXPECT_EQ(response.success, expected_success);
+        signal.signal_level();
+    };
+    tree.stage_block(completion);
+    signal.wait_for_level();
+}
+
+void commit_staged_blocks(TreeType& tree, bool expected_success = true)
+{
+    Signal signal;
+    TreeType::CommitCallback completion = [&](const TypedResponse<CommitResponse>& response) -> void {
+        EXPECT_EQ(response.success, expected_success);
+        signal.signal_level();
+    };
+    tree.commit_staged_blocks(completion);
+    signal.wait_for_level();
+}
+
 void remove_historic_block(TreeType& tree, const block_number_t& blockNumber, bool expected_success = true)
 {
     Signal signal;
@@ -850,6 +905,38 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_varying_size_blocks)
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_hash_large_batches_on_multiple_workers)
+{
+    constexpr size_t depth = 14;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(8);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Batches that are split into sub trees of varying sizes, some of them too small to be hashed in parallel
+    std::vector<size_t> batchSize = { 1000, 4096, 2048, 130, 64 };
+    index_t expected_size = 0;
+
+    for (size_t size : batchSize) {
+        std::vector<fr> to_add;
+        for (size_t j = 0; j < size; ++j) {
+            to_add.push_back(fr::random_element());
+            memdb.update_element(expected_size + j, to_add.back());
+        }
+        add_values(tree, to_add);
+        expected_size += size;
+        check_size(tree, expected_size);
+        check_root(tree, memdb.root());
+        check_sibling_path(tree, 0, memdb.get_sibling_path(0));
+        check_sibling_path(tree, expected_size - size / 2, memdb.get_sibling_path(expected_size - size / 2));
+        check_sibling_path(tree, expected_size - 1, memdb.get_sibling_path(expected_size - 1));
+    }
+    commit_tree(tree);
+    check_root(tree, memdb.root(), false);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_retrieve_historic_sibling_paths)
 {
     constexpr size_t depth = 10;
@@ -898,6 +985,129 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_retrieve_historic_siblin
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_stage_blocks_and_commit_them_together)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(1);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+    const fr emptyRoot = memdb.root();
+
+    constexpr uint32_t num_groups = 3;
+    constexpr uint32_t blocks_per_group = 4;
+    constexpr uint32_t batch_size = 4;
+
+    std::vector<fr_sibling_path> historicPathsZeroIndex;
+    std::vector<fr_sibling_path> historicPathsMaxIndex;
+
+    uint32_t block = 0;
+    for (uint32_t group = 0; group < num_groups; group++) {
+        index_t committed_size = block * batch_size;
+        fr committed_root = memdb.root();
+        for (uint32_t i = 0; i < blocks_per_group; i++, block++) {
+            std::vector<fr> to_add;
+            for (size_t j = 0; j < batch_size; ++j) {
+                size_t ind = block * batch_size + j;
+                memdb.update_element(ind, VALUES[ind]);
+                to_add.push_back(VALUES[ind]);
+            }
+            add_values(tree, to_add);
+            if (i + 1 < blocks_per_group) {
+                stage_block(tree);
+            } else {
+                commit_tree(tree);
+            }
+            index_t expected_size = (block + 1) * batch_size;
+            check_size(tree, expected_size);
+            check_block_height(tree, block + 1);
+            check_root(tree, memdb.root());
+            historicPathsZeroIndex.push_back(memdb.get_sibling_path(0));
+            historicPathsMaxIndex.push_back(memdb.get_sibling_path(expected_size - 1));
+
+            if (i + 1 < blocks_per_group) {
+                // the staged blocks are not yet visible to readers of committed state
+                check_size(tree, committed_size, false);
+                check_root(tree, committed_root, false);
+
+                // a rollback only discards what was added since the last staged block
+                add_value(tree, VALUES[1000]);
+                rollback_tree(tree);
+                check_size(tree, expected_size);
+                check_root(tree, memdb.root());
+            }
+        }
+        check_size(tree, block * batch_size, false);
+        check_root(tree, memdb.root(), false);
+    }
+
+    // committing with nothing staged is a no-op
+    commit_staged_blocks(tree);
+    check_block_height(tree, block);
+
+    // every block is available historically, exactly as if they were committed one at a time
+    for (uint32_t i = 0; i < historicPathsZeroIndex.size(); i++) {
+        check_historic_sibling_path(tree, 0, historicPathsZeroIndex[i], i + 1);
+        index_t maxSizeAtBlock = ((i + 1) * batch_size) - 1;
+        check_historic_sibling_path(tree, maxSizeAtBlock, historicPathsMaxIndex[i], i + 1);
+    }
+
+    // and the node reference counts allow every block to be unwound
+    for (block_number_t blockNumber = block; blockNumber > 0; blockNumber--) {
+        unwind_block(tree, blockNumber);
+    }
+    check_size(tree, 0, false);
+    check_root(tree, emptyRoot, false);
+}
+
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_retrieve_multiple_sibling_paths)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(4);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Unsorted, with duplicates, paths that share most of their nodes and paths into the empty part of the tree
+    std::vector<index_t> indices = { 77, 0, 3, 2, 77, 1023, 150, 64, 63, 99, 100, 1, 512 };
+    auto expected_paths = [&]() {
+        std::vector<fr_sibling_path> paths;
+        for (index_t index : indices) {
+            paths.push_back(memdb.get_sibling_path(index));
+        }
+        return paths;
+    };
+
+    check_sibling_paths(tree, indices, expected_paths());
+    check_sibling_paths(tree, {}, {});
+
+    std::vector<fr> values;
+    for (size_t i = 0; i < 100; ++i) {
+        memdb.update_element(i, VALUES[i]);
+        values.push_back(VALUES[i]);
+    }
+    add_values(tree, values);
+    check_sibling_paths(tree, indices, expected_paths());
+    commit_tree(tree);
+    std::vector<fr_sibling_path> block_one_paths = expected_paths();
+
+    values.clear();
+    for (size_t i = 100; i < 200; ++i) {
+        memdb.update_element(i, VALUES[i]);
+        values.push_back(VALUES[i]);
+    }
+    add_values(tree, values);
+    check_sibling_paths(tree, indices, expected_paths());
+    check_sibling_paths(tree, indices, block_one_paths, false);
+    check_historic_sibling_paths(tree, indices, block_one_paths, 1);
+    check_historic_sibling_paths(tree, indices, {}, 0, false);
+    check_historic_sibling_paths(tree, indices, {}, 2, false);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, retrieves_historic_leaves)
 {
     constexpr size_t depth = 10;
@@ -2047,3 +2257,74 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_checkpoint_and_revert_fo
     revert_checkpoint_tree(tree, false);
     commit_checkpoint_tree(tree, false);
 }
+
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_fork_the_uncommitted_state_of_a_fork)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    ThreadPoolPtr pool = make_thread_pool(1);
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+    index_t index = 0;
+    auto add_to_tree = [&](TreeType& tree, index_t num_values) {
+        for (index_t i = 0; i < num_values; i++, index++) {
+            memdb.update_element(index, VALUES[index]);
+            add_value(tree, VALUES[index]);
+        }
+    };
+
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    TreeType tree(std::move(store), pool);
+    add_to_tree(tree, 4);
+    commit_tree(tree);
+    fr block1Root = memdb.root();
+
+    // the main tree's uncommitted state can't be forked
+    EXPECT_THROW(tree.fork_uncommitted_store(), std::runtime_error);
+
+    std::unique_ptr<Store> forkStore = std::make_unique<Store>(name, depth, 1, db);
+    TreeType fork(std::move(forkStore), pool);
+    add_to_tree(fork, 4);
+    fr forkRoot = memdb.root();
+
+    // the child starts from the fork's uncommitted state
+    TreeType child(fork.fork_uncommitted_store(), pool);
+    check_size(child, 8);
+    check_root(child, forkRoot);
+    check_sibling_path(child, 5, memdb.get_sibling_path(5));
+    check_size(child, 4, false);
+    check_root(child, block1Root, false);
+
+    // updates to the child are not seen by the fork
+    add_to_tree(child, 2);
+    fr childRoot = memdb.root();
+    check_size(child, 10);
+    check_root(child, childRoot);
+    check_size(fork, 8);
+    check_root(fork, forkRoot);
+
+    // and updates to the fork are not seen by the child
+    add_value(fork, VALUES[100]);
+    check_size(fork, 9);
+    check_root(child, childRoot);
+
+    // forks can be forked again
+    TreeType grandchild(child.fork_uncommitted_store(), pool);
+    check_root(grandchild, childRoot);
+
+    // rolling back the child returns it to the state it was forked from, leaving its own fork untouched
+    rollback_tree(child);
+    check_size(child, 8);
+    check_root(child, forkRoot);
+    check_root(grandchild, childRoot);
+
+    // rolling back the fork returns it to the committed state, leaving the child untouched
+    rollback_tree(fork);
+    check_size(fork, 4);
+    check_root(fork, block1Root);
+    check_root(child, forkRoot);
+
+    // a fork can't be forked while it has checkpoints
+    checkpoint_tree(child);
+    EXPECT_THROW(child.fork_uncommitted_store(), std::runtime_error);
+}
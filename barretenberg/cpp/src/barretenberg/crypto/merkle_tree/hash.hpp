@@ -14,6 +14,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -23,6 +24,13 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    static void hash_pairs(std::span<const fr> inputs, std::span<fr> outputs)
+    {
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            outputs[i] = hash_pair(inputs[2 * i], inputs[2 * i + 1]);
+        }
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -34,6 +42,15 @@ struct Poseidon2HashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    /**
+     * @brief Hashes each pair (inputs[2i], inputs[2i + 1]) into outputs[i], the outputs may alias the first half of
+     * the inputs
+     */
+    static void hash_pairs(std::span<const fr> inputs, std::span<fr> outputs)
+    {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(inputs, outputs);
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
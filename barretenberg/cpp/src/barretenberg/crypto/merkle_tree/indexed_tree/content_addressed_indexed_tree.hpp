@@ -196,6 +196,11 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
 
     void sparse_batch_update(const std::vector<std::pair<index_t, fr>>& hashes_at_level, uint32_t level);
 
+    fr hash_updated_nodes(std::vector<index_t> indices,
+                          std::unordered_map<index_t, fr> hashes,
+                          uint32_t level,
+                          uint32_t target_level);
+
     /**
      * @brief Adds or updates the given set of values in the tree
      * @param values The values to be added or updated
@@ -228,6 +233,44 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     void generate_insertions(const std::shared_ptr<std::vector<std::pair<LeafValueType, index_t>>>& values_to_be_sorted,
                              const InsertionGenerationCallback& completion);
 
+    // Batches are only split across workers in ranges of at least this many values
+    static constexpr size_t MIN_INSERTIONS_PER_WORKER = 32;
+
+    struct LowLeafSearchResult {
+        bool is_already_present = false;
+        index_t index = 0;
+        // The low leaf as it was before the batch
+        IndexedLeafValueType leaf;
+    };
+
+    // A contiguous range of the sorted values, and so a range of keys, whose insertions are generated by one worker
+    struct InsertionRange {
+        size_t start = 0;
+        size_t end = 0;
+        // The first and last non-empty values in the range
+        std::optional<size_t> first_value, last_value;
+        // The last non-empty value before the range and the first one after it
+        std::optional<size_t> previous_value, next_value;
+        size_t num_updates = 0;
+        // The position of the range's first low leaf update in the batch's updates
+        size_t updates_offset = 0;
+        index_t highest_index = 0;
+        std::optional<std::string> error;
+    };
+
+    struct InsertionGenerationState {
+        std::shared_ptr<std::vector<std::pair<LeafValueType, index_t>>> sorted_values;
+        TreeMeta meta;
+        std::vector<InsertionRange> ranges;
+        // One per sorted value
+        std::vector<LowLeafSearchResult> low_leaves;
+        std::atomic<size_t> remaining_ranges;
+        InsertionGenerationResponse response;
+    };
+
+    void find_low_leaves(InsertionGenerationState& state, InsertionRange& range);
+    void generate_low_leaf_updates(InsertionGenerationState& state, InsertionRange& range);
+
     struct InsertionUpdates {
         // On insertion, we always update a low leaf. If it's creating a new leaf, we need to update the pointer to
         // point to the new one, if it's an update to an existing leaf, we need to change its payload.
@@ -913,170 +956,308 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_insertions(
     const std::shared_ptr<std::vector<std::pair<LeafValueType, index_t>>>& values_to_be_sorted,
     const InsertionGenerationCallback& completion)
 {
-    execute_and_report<InsertionGenerationResponse>(
-        [=, this](TypedResponse<InsertionGenerationResponse>& response) {
-            // The first thing we do is sort the values into descending order but maintain knowledge of their
-            // orignal order
-            struct {
-                bool operator()(std::pair<LeafValueType, index_t>& a, std::pair<LeafValueType, index_t>& b) const
-                {
-                    uint256_t aValue = a.first.get_key();
-                    uint256_t bValue = b.first.get_key();
-                    return aValue == bValue ? a.second < b.second : aValue > bValue;
-                }
-            } comp;
-            std::sort(values_to_be_sorted->begin(), values_to_be_sorted->end(), comp);
+    auto report = [=](TypedResponse<InsertionGenerationResponse>& response) {
+        try {
+            completion(response);
+        } catch (std::exception&) {
+        }
+    };
+    auto report_error = [=](const std::string& message) {
+        TypedResponse<InsertionGenerationResponse> response;
+        response.success = false;
+        response.message = message;
+        report(response);
+    };
+
+    std::shared_ptr<InsertionGenerationState> state = std::make_shared<InsertionGenerationState>();
+    try {
+        // The first thing we do is sort the values into descending order but maintain knowledge of their
+        // orignal order
+        struct {
+            bool operator()(std::pair<LeafValueType, index_t>& a, std::pair<LeafValueType, index_t>& b) const
+            {
+                uint256_t aValue = a.first.get_key();
+                uint256_t bValue = b.first.get_key();
+                return aValue == bValue ? a.second < b.second : aValue > bValue;
+            }
+        } comp;
+        std::sort(values_to_be_sorted->begin(), values_to_be_sorted->end(), comp);
+
+        std::vector<std::pair<LeafValueType, index_t>>& values = *values_to_be_sorted;
+        state->sorted_values = values_to_be_sorted;
+
+        TreeMeta& meta = state->meta;
+        store_->get_meta(meta);
+        //  Ensure that the tree is not going to be overfilled
+        index_t new_total_size = values.size() + meta.size;
+        if (new_total_size > max_size_) {
+            throw std::runtime_error(format("Unable to insert values into tree ",
+                                            meta.name,
+                                            " new size: ",
+                                            new_total_size,
+                                            " max size: ",
+                                            max_size_));
+        }
 
-            std::vector<std::pair<LeafValueType, index_t>>& values = *values_to_be_sorted;
+        // Once sorted, duplicate keys are adjacent, ignoring any empty values between them
+        const LeafValueType* previous_value = nullptr;
+        for (const std::pair<LeafValueType, index_t>& value_pair : values) {
+            if (value_pair.first.is_empty()) {
+                continue;
+            }
+            if (previous_value != nullptr && previous_value->get_key() == value_pair.first.get_key()) {
+                throw std::runtime_error(format("Duplicate key not allowed in same batch, key value: ",
+                                                value_pair.first.get_key(),
+                                                ", tree: ",
+                                                meta.name));
+            }
+            previous_value = &value_pair.first;
+        }
 
-            // std::cout << "Generating insertions " << std::endl;
+        // Partition the sorted values into ranges of keys, one per worker
+        size_t num_ranges = std::max(static_cast<size_t>(1),
+                                     std::min(workers_->num_threads(), values.size() / MIN_INSERTIONS_PER_WORKER));
+        state->ranges.resize(num_ranges);
+        for (size_t i = 0; i < num_ranges; ++i) {
+            state->ranges[i].start = values.size() * i / num_ranges;
+            state->ranges[i].end = values.size() * (i + 1) / num_ranges;
+        }
+        state->low_leaves.resize(values.size());
+        state->remaining_ranges = num_ranges;
+        state->response.highest_index = 0;
+        state->response.low_leaf_updates = std::make_shared<std::vector<LeafUpdate>>();
+        state->response.leaves_to_append =
+            std::make_shared<std::vector<IndexedLeafValueType>>(values.size(), IndexedLeafValueType::empty());
+    } catch (std::exception& e) {
+        report_error(e.what());
+        return;
+    }
 
-            // Now that we have the sorted values we need to identify the leaves that need updating.
-            // This is performed sequentially and is stored in this 'leaf_update' struct
-            response.inner.highest_index = 0;
-            response.inner.low_leaf_updates = std::make_shared<std::vector<LeafUpdate>>();
-            response.inner.low_leaf_updates->reserve(values.size());
-            response.inner.leaves_to_append =
-                std::make_shared<std::vector<IndexedLeafValueType>>(values.size(), IndexedLeafValueType::empty());
-            index_t num_leaves_to_be_inserted = values.size();
-            std::set<uint256_t> unique_values;
+    // This is the final step, triggered once every range has generated its low leaf updates
+    auto on_updates_generated = [=]() {
+        for (const InsertionRange& range : state->ranges) {
+            if (range.error.has_value()) {
+                report_error(range.error.value());
+                return;
+            }
+            state->response.highest_index = std::max(state->response.highest_index, range.highest_index);
+        }
+        TypedResponse<InsertionGenerationResponse> response;
+        response.success = true;
+        response.inner = std::move(state->response);
+        report(response);
+    };
 
-            {
-                ReadTransactionPtr tx = store_->create_read_transaction();
-                TreeMeta meta;
-                store_->get_meta(meta);
-                RequestContext requestContext;
-                requestContext.includeUncommitted = true;
-                //  Ensure that the tree is not going to be overfilled
-                index_t new_total_size = num_leaves_to_be_inserted + meta.size;
-                if (new_total_size > max_size_) {
-                    throw std::runtime_error(format("Unable to insert values into tree ",
-                                                    meta.name,
-                                                    " new size: ",
-                                                    new_total_size,
-                                                    " max size: ",
-                                                    max_size_));
+    // This is triggered once every range has found its low leaves. Nothing has been written to the store yet, the
+    // ranges are linked together and then the updates are generated
+    auto on_low_leaves_found = [=, this]() {
+        std::vector<InsertionRange>& ranges = state->ranges;
+        size_t num_updates = 0;
+        std::optional<size_t> previous_value;
+        for (InsertionRange& range : ranges) {
+            // Report the error from the lowest range, which is the first one hit in key order
+            if (range.error.has_value()) {
+                report_error(range.error.value());
+                return;
+            }
+            range.updates_offset = num_updates;
+            num_updates += range.num_updates;
+            range.previous_value = previous_value;
+            previous_value = range.last_value.has_value() ? range.last_value : previous_value;
+        }
+        std::optional<size_t> next_value;
+        for (auto it = ranges.rbegin(); it != ranges.rend(); ++it) {
+            it->next_value = next_value;
+            next_value = it->first_value.has_value() ? it->first_value : next_value;
+        }
+        state->response.low_leaf_updates->resize(num_updates);
+
+        state->remaining_ranges = ranges.size();
+        for (InsertionRange& range : ranges) {
+            workers_->enqueue([=, this, &range]() {
+                generate_low_leaf_updates(*state, range);
+                if (state->remaining_ranges.fetch_sub(1) == 1) {
+                    on_updates_generated();
                 }
-                for (size_t i = 0; i < values.size(); ++i) {
-                    std::pair<LeafValueType, size_t>& value_pair = values[i];
-                    size_t index_into_appended_leaves = value_pair.second;
-                    index_t index_of_new_leaf = static_cast<index_t>(index_into_appended_leaves) + meta.size;
-                    if (value_pair.first.is_empty()) {
-                        continue;
-                    }
-                    fr value = value_pair.first.get_key();
-                    auto it = unique_values.insert(value);
-                    if (!it.second) {
-                        throw std::runtime_error(format(
-                            "Duplicate key not allowed in same batch, key value: ", value, ", tree: ", meta.name));
-                    }
+            });
+        }
+    };
 
-                    // This gives us the leaf that need updating
-                    index_t low_leaf_index = 0;
-                    bool is_already_present = false;
-
-                    requestContext.root = store_->get_current_root(*tx, true);
-                    std::tie(is_already_present, low_leaf_index) =
-                        store_->find_low_value(value_pair.first.get_key(), requestContext, *tx);
-                    // std::cout << "Found low leaf index " << low_leaf_index << std::endl;
-
-                    // Try and retrieve the leaf pre-image from the cache first.
-                    // If unsuccessful, derive from the tree and hash based lookup
-                    std::optional<IndexedLeafValueType> optional_low_leaf =
-                        store_->get_cached_leaf_by_index(low_leaf_index);
-                    IndexedLeafValueType low_leaf;
-
-                    if (optional_low_leaf.has_value()) {
-                        low_leaf = optional_low_leaf.value();
-                        // std::cout << "Found cached low leaf at index: " << low_leaf_index << " : " << low_leaf
-                        //           << std::endl;
-                    } else {
-                        // std::cout << "Looking for leaf at index " << low_leaf_index << std::endl;
-                        std::optional<fr> low_leaf_hash = find_leaf_hash(low_leaf_index, requestContext, *tx, true);
-
-                        if (!low_leaf_hash.has_value()) {
-                            // std::cout << "Failed to find low leaf" << std::endl;
-                            throw std::runtime_error(format("Unable to insert values into tree ",
-                                                            meta.name,
-                                                            ", failed to find low leaf at index ",
-                                                            low_leaf_index,
-                                                            ", current size: ",
-                                                            meta.size));
-                        }
-                        // std::cout << "Low leaf hash " << low_leaf_hash.value() << std::endl;
-
-                        std::optional<IndexedLeafValueType> low_leaf_option =
-                            store_->get_leaf_by_hash(low_leaf_hash.value(), *tx, true);
-
-                        if (!low_leaf_option.has_value()) {
-                            // std::cout << "No pre-image" << std::endl;
-                            throw std::runtime_error(format("Unable to insert values into tree ",
-                                                            meta.name,
-                                                            " failed to get leaf pre-image by hash for index ",
-                                                            low_leaf_index));
-                        }
-                        // std::cout << "Low leaf pre-image " << low_leaf_option.value() << std::endl;
-                        low_leaf = low_leaf_option.value();
-                    }
+    for (InsertionRange& range : state->ranges) {
+        workers_->enqueue([=, this, &range]() {
+            find_low_leaves(*state, range);
+            if (state->remaining_ranges.fetch_sub(1) == 1) {
+                on_low_leaves_found();
+            }
+        });
+    }
+}
 
-                    LeafUpdate low_update = {
-                        .leaf_index = low_leaf_index,
-                        .updated_leaf = IndexedLeafValueType::empty(),
-                        .original_leaf = low_leaf,
-                    };
-
-                    // Capture the index and original value of the 'low' leaf
-
-                    if (!is_already_present) {
-                        // Update the current leaf to point it to the new leaf
-                        IndexedLeafValueType new_leaf =
-                            IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextKey);
-
-                        low_leaf.nextIndex = index_of_new_leaf;
-                        low_leaf.nextKey = value;
-                        store_->set_leaf_key_at_index(index_of_new_leaf, new_leaf);
-
-                        // std::cout << "NEW LEAf TO BE INSERTED at index: " << index_of_new_leaf << " : " << new_leaf
-                        //           << std::endl;
-
-                        // std::cout << "Low leaf found at index " << low_leaf_index << " index of new leaf "
-                        //           << index_of_new_leaf << std::endl;
-
-                        store_->put_cached_leaf_by_index(low_leaf_index, low_leaf);
-                        // leaves_pre[low_leaf_index] = low_leaf;
-                        low_update.updated_leaf = low_leaf;
-
-                        // Update the set of leaves to append
-                        (*response.inner.leaves_to_append)[index_into_appended_leaves] = new_leaf;
-                    } else if (IndexedLeafValueType::is_updateable()) {
-                        // Update the current leaf's value, don't change it's link
-                        IndexedLeafValueType replacement_leaf =
-                            IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextKey);
-                        // IndexedLeafValueType empty_leaf = IndexedLeafValueType::empty();
-                        //  don't update the index for this empty leaf
-                        // std::cout << "Low leaf updated at index " << low_leaf_index << " index of new leaf "
-                        //           << index_of_new_leaf << std::endl;
-                        // store_->set_leaf_key_at_index(index_of_new_leaf, empty_leaf);
-                        store_->put_cached_leaf_by_index(low_leaf_index, replacement_leaf);
-                        low_update.updated_leaf = replacement_leaf;
-                        // The set of appended leaves already has an empty leaf in the slot at index
-                        // 'index_into_appended_leaves'
-                    } else {
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::find_low_leaves(InsertionGenerationState& state,
+                                                                        InsertionRange& range)
+{
+    try {
+        std::vector<std::pair<LeafValueType, index_t>>& values = *state.sorted_values;
+        const TreeMeta& meta = state.meta;
+        ReadTransactionPtr tx = store_->create_read_transaction();
+        RequestContext requestContext;
+        requestContext.includeUncommitted = true;
+        requestContext.root = store_->get_current_root(*tx, true);
+
+        // The values are in descending order, so every value's low leaf is one that existed before the batch. Values
+        // sharing a low leaf are adjacent, we only need to read it once
+        const LowLeafSearchResult* previous = nullptr;
+        for (size_t i = range.start; i < range.end; ++i) {
+            const LeafValueType& value = values[i].first;
+            if (value.is_empty()) {
+                continue;
+            }
+            if (!range.first_value.has_value()) {
+                range.first_value = i;
+            }
+            range.last_value = i;
+            range.num_updates++;
+
+            LowLeafSearchResult& low_leaf = state.low_leaves[i];
+            std::tie(low_leaf.is_already_present, low_leaf.index) =
+                store_->find_low_value(value.get_key(), requestContext, *tx);
+
+            if (previous != nullptr && previous->index == low_leaf.index) {
+                low_leaf.leaf = previous->leaf;
+            } else {
+                // Try and retrieve the leaf pre-image from the cache first.
+                // If unsuccessful, derive from the tree and hash based lookup
+                std::optional<IndexedLeafValueType> optional_low_leaf =
+                    store_->get_cached_leaf_by_index(low_leaf.index);
+
+                if (optional_low_leaf.has_value()) {
+                    low_leaf.leaf = optional_low_leaf.value();
+                } else {
+                    std::optional<fr> low_leaf_hash = find_leaf_hash(low_leaf.index, requestContext, *tx, true);
+
+                    if (!low_leaf_hash.has_value()) {
                         throw std::runtime_error(format("Unable to insert values into tree ",
                                                         meta.name,
-                                                        " leaf type ",
-                                                        IndexedLeafValueType::name(),
-                                                        " is not updateable and ",
-                                                        value_pair.first.get_key(),
-                                                        " is already present"));
+                                                        ", failed to find low leaf at index ",
+                                                        low_leaf.index,
+                                                        ", current size: ",
+                                                        meta.size));
                     }
-                    response.inner.highest_index = std::max(response.inner.highest_index, low_leaf_index);
 
-                    response.inner.low_leaf_updates->push_back(low_update);
+                    std::optional<IndexedLeafValueType> low_leaf_option =
+                        store_->get_leaf_by_hash(low_leaf_hash.value(), *tx, true);
+
+                    if (!low_leaf_option.has_value()) {
+                        throw std::runtime_error(format("Unable to insert values into tree ",
+                                                        meta.name,
+                                                        " failed to get leaf pre-image by hash for index ",
+                                                        low_leaf.index));
+                    }
+                    low_leaf.leaf = low_leaf_option.value();
                 }
             }
-        },
-        completion);
+
+            if (low_leaf.is_already_present && !IndexedLeafValueType::is_updateable()) {
+                throw std::runtime_error(format("Unable to insert values into tree ",
+                                                meta.name,
+                                                " leaf type ",
+                                                IndexedLeafValueType::name(),
+                                                " is not updateable and ",
+                                                value.get_key(),
+                                                " is already present"));
+            }
+            previous = &low_leaf;
+        }
+    } catch (std::exception& e) {
+        range.error = e.what();
+    }
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_low_leaf_updates(InsertionGenerationState& state,
+                                                                                  InsertionRange& range)
+{
+    try {
+        std::vector<std::pair<LeafValueType, index_t>>& values = *state.sorted_values;
+        std::vector<LeafUpdate>& low_leaf_updates = *state.response.low_leaf_updates;
+        std::vector<IndexedLeafValueType>& leaves_to_append = *state.response.leaves_to_append;
+        const TreeMeta& meta = state.meta;
+        size_t update_position = range.updates_offset;
+
+        // A low leaf shared by several values is updated by each of them in turn, only its final state is cached. It is
+        // written by whichever range holds the last value to update it
+        std::optional<size_t> previous_value = range.previous_value;
+        std::optional<std::pair<index_t, IndexedLeafValueType>> pending_low_leaf;
+        auto cache_pending_low_leaf = [&]() {
+            if (pending_low_leaf.has_value()) {
+                store_->put_cached_leaf_by_index(pending_low_leaf->first, pending_low_leaf->second);
+            }
+        };
+
+        for (size_t i = range.start; i < range.end; ++i) {
+            std::pair<LeafValueType, index_t>& value_pair = values[i];
+            if (value_pair.first.is_empty()) {
+                continue;
+            }
+            const LowLeafSearchResult& low_leaf_result = state.low_leaves[i];
+            size_t index_into_appended_leaves = value_pair.second;
+            index_t index_of_new_leaf = static_cast<index_t>(index_into_appended_leaves) + meta.size;
+            index_t low_leaf_index = low_leaf_result.index;
+            IndexedLeafValueType low_leaf = low_leaf_result.leaf;
+
+            // If the previous, larger value shares our low leaf then it was a new leaf that the low leaf now points to
+            if (previous_value.has_value() && state.low_leaves[previous_value.value()].index == low_leaf_index) {
+                const std::pair<LeafValueType, index_t>& previous_pair = values[previous_value.value()];
+                low_leaf.nextIndex = static_cast<index_t>(previous_pair.second) + meta.size;
+                low_leaf.nextKey = previous_pair.first.get_key();
+            }
+            previous_value = i;
+
+            if (pending_low_leaf.has_value() && pending_low_leaf->first != low_leaf_index) {
+                cache_pending_low_leaf();
+            }
+
+            // Capture the index and original value of the 'low' leaf
+            LeafUpdate low_update = {
+                .leaf_index = low_leaf_index,
+                .updated_leaf = IndexedLeafValueType::empty(),
+                .original_leaf = low_leaf,
+            };
+
+            if (!low_leaf_result.is_already_present) {
+                // Update the current leaf to point it to the new leaf
+                IndexedLeafValueType new_leaf =
+                    IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextKey);
+
+                low_leaf.nextIndex = index_of_new_leaf;
+                low_leaf.nextKey = value_pair.first.get_key();
+                store_->set_leaf_key_at_index(index_of_new_leaf, new_leaf);
+                low_update.updated_leaf = low_leaf;
+
+                // Update the set of leaves to append
+                leaves_to_append[index_into_appended_leaves] = new_leaf;
+            } else {
+                // Update the current leaf's value, don't change it's link
+                // The set of appended leaves already has an empty leaf in the slot at index
+                // 'index_into_appended_leaves'
+                low_update.updated_leaf = IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextKey);
+            }
+            pending_low_leaf = std::make_pair(low_leaf_index, low_update.updated_leaf);
+            range.highest_index = std::max(range.highest_index, low_leaf_index);
+
+            low_leaf_updates[update_position++] = low_update;
+        }
+
+        // Our last low leaf is only ours to cache if the next range doesn't continue updating it
+        if (pending_low_leaf.has_value() &&
+            (!range.next_value.has_value() ||
+             state.low_leaves[range.next_value.value()].index != pending_low_leaf->first)) {
+            cache_pending_low_leaf();
+        }
+    } catch (std::exception& e) {
+        range.error = e.what();
+    }
 }
 
 template <typename Store, typename HashingPolicy>
@@ -1133,6 +1314,7 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::update_leaf_and_hash_to_
         fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
 
         previous_sibling_path.emplace_back(is_right ? new_left_value : new_right_value);
+        // A single path, whose every hash depends on the one below: there is no batch for HashingPolicy::hash_pairs
         new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
         index >>= 1;
         --level;
@@ -1159,13 +1341,6 @@ template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
     const std::vector<std::pair<index_t, fr>>& hashes_at_level, uint32_t level)
 {
-    auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
-        fr value = fr::zero();
-
-        bool success = store_->get_cached_node_by_index(level, index, value);
-        // std::cout << "Getting node at " << level << " : " << index << " success " << success << std::endl;
-        return success ? std::optional<fr>(value) : std::nullopt;
-    };
     std::vector<index_t> indices;
     indices.reserve(hashes_at_level.size());
     std::unordered_map<index_t, fr> hashes;
@@ -1177,10 +1352,37 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
         indices.push_back(index);
         // std::cout << "index " << index << " hash " << hash << std::endl;
     }
+    hash_updated_nodes(std::move(indices), std::move(hashes), level, 0);
+}
+
+/**
+ * @brief Write the parents of the updated nodes at `level` (given by their indices and new hashes), then their parents
+ * and so on up to `target_level`, and return the hash last written
+ * @details The nodes of each level are hashed at once with HashingPolicy::hash_pairs.
+ */
+template <typename Store, typename HashingPolicy>
+fr ContentAddressedIndexedTree<Store, HashingPolicy>::hash_updated_nodes(std::vector<index_t> indices,
+                                                                         std::unordered_map<index_t, fr> hashes,
+                                                                         uint32_t level,
+                                                                         uint32_t target_level)
+{
+    auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
+        fr value = fr::zero();
+
+        bool success = store_->get_cached_node_by_index(level, index, value);
+        // std::cout << "Getting node at " << level << " : " << index << " success " << success << std::endl;
+        return success ? std::optional<fr>(value) : std::nullopt;
+    };
     std::unordered_set<index_t> unique_indices;
-    while (level > 0) {
+    std::vector<std::pair<std::optional<fr>, std::optional<fr>>> children;
+    std::vector<fr> child_values;
+    std::vector<fr> parent_hashes;
+    fr new_hash = fr::zero();
+    while (level > target_level) {
         std::vector<index_t> next_indices;
         std::unordered_map<index_t, fr> next_hashes;
+        children.clear();
+        child_values.clear();
         for (index_t index : indices) {
             index_t parent_index = index >> 1;
             auto it = unique_indices.insert(parent_index);
@@ -1189,22 +1391,29 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
             }
             next_indices.push_back(parent_index);
             bool is_right = static_cast<bool>(index & 0x01);
-            fr new_hash = hashes[index];
+            new_hash = hashes[index];
             std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
             std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
+            child_values.push_back(new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level]);
+            child_values.push_back(new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level]);
+            children.emplace_back(new_left_option, new_right_option);
+        }
 
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
+        // Hash every updated node of the level at once
+        parent_hashes.resize(next_indices.size());
+        HashingPolicy::hash_pairs(child_values, parent_hashes);
+        for (size_t i = 0; i < next_indices.size(); ++i) {
+            new_hash = parent_hashes[i];
+            store_->put_cached_node_by_index(level - 1, next_indices[i], new_hash);
+            store_->put_node_by_hash(new_hash, { .left = children[i].first, .right = children[i].second, .ref = 1 });
+            next_hashes[next_indices[i]] = new_hash;
         }
         indices = std::move(next_indices);
         hashes = std::move(next_hashes);
         unique_indices.clear();
         --level;
     }
+    return new_hash;
 }
 
 template <typename Store, typename HashingPolicy>
@@ -1214,13 +1423,6 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
     const uint32_t& root_level,
     const std::vector<LeafUpdate>& updates)
 {
-    auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
-        fr value = fr::zero();
-        // std::cout << "Getting node at " << level << " : " << index << std::endl;
-        bool success = store_->get_cached_node_by_index(level, index, value);
-        return success ? std::optional<fr>(value) : std::nullopt;
-    };
-
     uint32_t level = depth_;
 
     std::vector<index_t> indices;
@@ -1228,7 +1430,6 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
 
     fr new_hash = fr::zero();
 
-    std::unordered_set<index_t> unique_indices;
     std::unordered_map<index_t, fr> hashes;
     index_t end_index = start_index + num_leaves_to_be_inserted;
     // Insert the leaves
@@ -1261,35 +1462,8 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
         return std::make_pair(false, fr::zero());
     }
 
-    while (level > root_level) {
-        std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
-        for (index_t index : indices) {
-            index_t parent_index = index >> 1;
-            auto it = unique_indices.insert(parent_index);
-            if (!it.second) {
-                continue;
-            }
-            next_indices.push_back(parent_index);
-            bool is_right = static_cast<bool>(index & 0x01);
-            new_hash = hashes[index];
-            std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
-            std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-            // std::cout << "Created parent hash at level " << level - 1 << " index " << parent_index << " hash "
-            //           << new_hash << " left " << new_left_value << " right " << new_right_value << std::endl;
-        }
-        indices = std::move(next_indices);
-        hashes = std::move(next_hashes);
-        unique_indices.clear();
-        --level;
-    }
+    // The batch spans a single sub tree, so the last hash written is the root of the sub tree
+    new_hash = hash_updated_nodes(std::move(indices), std::move(hashes), level, root_level);
     // std::cout << "Returning hash " << new_hash << std::endl;
     return std::make_pair(true, new_hash);
 }
@@ -21,6 +21,8 @@
 #include <future>
 #include <memory>
 #include <optional>
+#include <random>
+#include <set>
 #include <stdexcept>
 #include <vector>
 
@@ -876,6 +878,74 @@ TEST_F(PersistedContentAddressedIndexedTreeTest, test_compare_batch_inserts_diff
     }
 }
 
+TEST_F(PersistedContentAddressedIndexedTreeTest, test_compare_public_data_witnesses_different_sized_thread_pools)
+{
+    auto& random_engine = numeric::get_randomness();
+    const uint32_t batch_size = 512;
+    const uint32_t num_batches = 4;
+    constexpr size_t depth = 16;
+
+    // Batches are generated in up to 1, 3 and 8 key ranges respectively
+    std::vector<std::unique_ptr<PublicDataTreeType>> trees;
+    for (uint32_t num_threads : { 1U, 3U, 8U }) {
+        std::string name = random_string();
+        std::filesystem::path directory = _directory;
+        directory.append(name);
+        std::filesystem::create_directories(directory);
+        LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, _mapSize, _maxReaders);
+        std::unique_ptr<PublicDataStore> store = std::make_unique<PublicDataStore>(name, depth, db);
+        trees.emplace_back(
+            std::make_unique<PublicDataTreeType>(std::move(store), make_thread_pool(num_threads), batch_size));
+    }
+
+    for (uint32_t i = 0; i < num_batches; i++) {
+        // Slots are drawn from a small range so that many writes share a low leaf or update an existing slot
+        std::set<uint64_t> slots;
+        while (slots.size() < batch_size) {
+            slots.insert(1 + (random_engine.get_random_uint64() % (batch_size * 4)));
+        }
+        std::vector<PublicDataLeafValue> batch;
+        for (uint64_t slot : slots) {
+            batch.emplace_back(slot, random_engine.get_random_uint64());
+        }
+        // Leave some empty values amongst the writes
+        for (uint32_t j = 0; j < batch_size; j += 16) {
+            batch[j] = PublicDataLeafValue(0, 0);
+        }
+        std::shuffle(batch.begin(), batch.end(), std::mt19937(i));
+
+        std::vector<std::shared_ptr<std::vector<LeafUpdateWitnessData<PublicDataLeafValue>>>> witnesses;
+        for (auto& tree : trees) {
+            Signal signal;
+            PublicDataTreeType::AddCompletionCallbackWithWitness completion =
+                [&](const TypedResponse<AddIndexedDataResponse<PublicDataLeafValue>>& response) {
+                    EXPECT_EQ(response.success, true);
+                    witnesses.push_back(response.inner.low_leaf_witness_data);
+                    signal.signal_level();
+                };
+            tree->add_or_update_values(batch, completion);
+            signal.wait_for_level();
+        }
+
+        for (size_t t = 1; t < trees.size(); t++) {
+            EXPECT_EQ(get_root(*trees[t]), get_root(*trees[0]));
+            ASSERT_EQ(witnesses[t]->size(), witnesses[0]->size());
+            for (size_t j = 0; j < witnesses[0]->size(); j++) {
+                EXPECT_EQ(witnesses[t]->at(j).leaf, witnesses[0]->at(j).leaf);
+                EXPECT_EQ(witnesses[t]->at(j).index, witnesses[0]->at(j).index);
+                EXPECT_EQ(witnesses[t]->at(j).path, witnesses[0]->at(j).path);
+            }
+        }
+
+        // Commit every other batch so that low leaves are found both in the cache and in the database
+        if (i % 2 == 1) {
+            for (auto& tree : trees) {
+                commit_tree(*tree);
+            }
+        }
+    }
+}
+
 TEST_F(PersistedContentAddressedIndexedTreeTest, reports_an_error_if_batch_contains_duplicate)
 {
     index_t current_size = 2;
@@ -7,6 +7,7 @@
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/node_cache.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/lmdblib/lmdb_db_transaction.hpp"
@@ -57,6 +58,7 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
 LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders)
     : LMDBStoreBase(directory, mapSizeKb, maxNumReaders, 5)
     , _name(std::move(name))
+    , _nodeCacheId(NodeCache::next_store_id())
 {
 
     {
@@ -109,6 +111,8 @@ void LMDBTreeStore::get_stats(TreeDBStats& stats, ReadTransaction& tx)
     stats.leafIndicesDBStats = _leafKeyToIndexDatabase->get_stats(tx);
     stats.nodesDBStats = _nodeDatabase->get_stats(tx);
     stats.blockIndicesDBStats = _indexToBlockDatabase->get_stats(tx);
+    stats.nodeCacheHits = _nodeCacheHits;
+    stats.nodeCacheMisses = _nodeCacheMisses;
 }
 
 void LMDBTreeStore::write_block_data(const block_number_t& blockNumber,
@@ -282,6 +286,7 @@ void LMDBTreeStore::decrement_node_reference_count(const fr& nodeHash, NodePaylo
     if (--nodeData.ref == 0) {
         // std::cout << "Deleting node at " << nodeHash << std::endl;
         tx.delete_value(nodeHash, *_nodeDatabase);
+        NodeCache::get().erase(_nodeCacheId, nodeHash);
         return;
     }
     // std::cout << "Updating node at " << nodeHash << " ref is now " << nodeData.ref << std::endl;
@@ -315,20 +320,30 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
 
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
+    // A node's children are determined by its hash, only its reference count and existence change over time. Entries
+    // are evicted as nodes are written or deleted. A read racing with such a write may re-insert the previous version,
+    // whose children are still correct and whose existence only matters for blocks that are being removed.
+    if (NodeCache::get().lookup(_nodeCacheId, nodeHash, nodeData)) {
+        _nodeCacheHits++;
+        return true;
+    }
+    _nodeCacheMisses++;
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
+    // decoded straight out of the map, the view is not used beyond this point
+    ValueView data;
+    bool success = tx.get_value_view<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_record(data, nodeData);
+        NodeCache::get().insert(_nodeCacheId, nodeHash, nodeData);
     }
     return success;
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    NodeCache::get().erase(_nodeCacheId, nodeHash);
+    std::vector<uint8_t> encoded;
+    encode_record(nodeData, encoded);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
@@ -8,6 +8,7 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/record_codec.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -19,8 +20,10 @@
 #include "barretenberg/serialize/msgpack_impl.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "lmdb.h"
+#include <atomic>
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <ostream>
 #include <stdexcept>
 #include <string>
@@ -66,6 +69,26 @@ struct NodePayload {
     }
 };
 
+template <> struct record_codec::FixedWidth<NodePayload> {
+    static constexpr size_t SIZE = 2 * FixedWidth<std::optional<fr>>::SIZE + FixedWidth<uint64_t>::SIZE;
+    static void write(const NodePayload& value, uint8_t* dst)
+    {
+        FixedWidth<std::optional<fr>>::write(value.left, dst);
+        dst += FixedWidth<std::optional<fr>>::SIZE;
+        FixedWidth<std::optional<fr>>::write(value.right, dst);
+        dst += FixedWidth<std::optional<fr>>::SIZE;
+        FixedWidth<uint64_t>::write(value.ref, dst);
+    }
+    static void read(const uint8_t* src, NodePayload& value)
+    {
+        FixedWidth<std::optional<fr>>::read(src, value.left);
+        src += FixedWidth<std::optional<fr>>::SIZE;
+        FixedWidth<std::optional<fr>>::read(src, value.right);
+        src += FixedWidth<std::optional<fr>>::SIZE;
+        FixedWidth<uint64_t>::read(src, value.ref);
+    }
+};
+
 struct BlockIndexPayload {
     std::vector<block_number_t> blockNumbers;
 
@@ -162,6 +185,8 @@ struct BlockIndexPayload {
 /**
  * Creates an abstraction against a collection of LMDB databases within a single environment used to store merkle tree
  * data
+ * Node reads are served from the process-wide NodeCache where possible. Writing or deleting a node evicts it from the
+ * cache, so that the reference counts read back are those of the database.
  */
 
 class LMDBTreeStore : public LMDBStoreBase {
@@ -238,6 +263,10 @@ class LMDBTreeStore : public LMDBStoreBase {
 
     void delete_all_leaf_keys_before_or_equal_index(const index_t& index, WriteTransaction& tx);
 
+    template <typename T> static void encode_record(const T& value, std::vector<uint8_t>& buffer);
+
+    template <typename T> static void decode_record(std::span<const uint8_t> data, T& value);
+
   private:
     std::string _name;
     LMDBDatabase::Ptr _blockDatabase;
@@ -245,6 +274,9 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBDatabase::Ptr _leafKeyToIndexDatabase;
     LMDBDatabase::Ptr _leafHashToPreImageDatabase;
     LMDBDatabase::Ptr _indexToBlockDatabase;
+    uint64_t _nodeCacheId;
+    std::atomic<uint64_t> _nodeCacheHits = 0;
+    std::atomic<uint64_t> _nodeCacheMisses = 0;
 
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
 };
@@ -259,10 +291,11 @@ template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
-    bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
+    // decoded straight out of the map, the view is not used beyond this point
+    ValueView data;
+    bool success = tx.template get_value_view<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+        decode_record(data, leafData);
     }
     return success;
 }
@@ -270,9 +303,8 @@ bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, Tx
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, leafData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    encode_record(leafData, encoded);
     FrKeyType key(leafHash);
     tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
 }
@@ -280,11 +312,41 @@ void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafD
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
+    // decoded straight out of the map, the view is not used beyond this point
+    ValueView data;
+    bool success = tx.template get_value_view<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_record(data, nodeData);
     }
     return success;
 }
+
+/**
+ * @brief Encodes nodes and leaf pre-images with the fixed width record codec, other types with msgpack
+ */
+template <typename T> void LMDBTreeStore::encode_record(const T& value, std::vector<uint8_t>& buffer)
+{
+    if constexpr (record_codec::FixedWidthEncodable<T>) {
+        record_codec::encode(value, buffer);
+    } else {
+        msgpack::sbuffer packed;
+        msgpack::pack(packed, value);
+        buffer.assign(packed.data(), packed.data() + packed.size());
+    }
+}
+
+/**
+ * @brief Decodes a record written by encode_record, or a msgpack encoded record written before the fixed width codec
+ * was introduced. Those are re-encoded whenever they are next written.
+ */
+template <typename T> void LMDBTreeStore::decode_record(std::span<const uint8_t> data, T& value)
+{
+    if constexpr (record_codec::FixedWidthEncodable<T>) {
+        if (record_codec::is_fixed_width(data)) {
+            record_codec::decode(data, value);
+            return;
+        }
+    }
+    msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(value);
+}
 } // namespace bb::crypto::merkle_tree
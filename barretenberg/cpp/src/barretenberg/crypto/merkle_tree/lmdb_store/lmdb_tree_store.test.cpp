@@ -13,6 +13,7 @@
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/crypto/merkle_tree/fixtures.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/record_codec.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/lmdblib/lmdb_helpers.hpp"
@@ -275,6 +276,120 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_nodes)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, nodes_and_leaves_are_stored_as_fixed_width_records)
+{
+    NodePayload nodePayload{ .left = VALUES[4], .right = std::nullopt, .ref = 4 };
+    std::vector<uint8_t> encoded;
+    LMDBTreeStore::encode_record(nodePayload, encoded);
+    EXPECT_TRUE(record_codec::is_fixed_width(encoded));
+    EXPECT_EQ(encoded.size(), record_codec::HEADER_SIZE + record_codec::FixedWidth<NodePayload>::SIZE);
+    NodePayload readBack;
+    LMDBTreeStore::decode_record(encoded, readBack);
+    EXPECT_EQ(readBack, nodePayload);
+
+    IndexedLeaf<PublicDataLeafValue> leaf(PublicDataLeafValue(VALUES[0], VALUES[1]), 3, VALUES[2]);
+    LMDBTreeStore::encode_record(leaf, encoded);
+    EXPECT_TRUE(record_codec::is_fixed_width(encoded));
+    IndexedLeaf<PublicDataLeafValue> leafReadBack;
+    LMDBTreeStore::decode_record(encoded, leafReadBack);
+    EXPECT_EQ(leafReadBack, leaf);
+}
+
+TEST_F(LMDBTreeStoreTest, can_read_records_written_with_msgpack)
+{
+    // Databases written before the fixed width records hold msgpack encoded nodes and leaves
+    NodePayload nodePayload{ .left = std::nullopt, .right = VALUES[5], .ref = 2 };
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, nodePayload);
+    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    EXPECT_FALSE(record_codec::is_fixed_width(encoded));
+    NodePayload readBack;
+    LMDBTreeStore::decode_record(encoded, readBack);
+    EXPECT_EQ(readBack, nodePayload);
+
+    IndexedLeaf<NullifierLeafValue> leaf(NullifierLeafValue(VALUES[0]), 3, VALUES[2]);
+    msgpack::sbuffer leafBuffer;
+    msgpack::pack(leafBuffer, leaf);
+    encoded.assign(leafBuffer.data(), leafBuffer.data() + leafBuffer.size());
+    EXPECT_FALSE(record_codec::is_fixed_width(encoded));
+    IndexedLeaf<NullifierLeafValue> leafReadBack;
+    LMDBTreeStore::decode_record(encoded, leafReadBack);
+    EXPECT_EQ(leafReadBack, leaf);
+}
+
+TEST_F(LMDBTreeStoreTest, node_reads_are_cached)
+{
+    NodePayload nodePayload;
+    nodePayload.left = VALUES[4];
+    nodePayload.right = VALUES[5];
+    nodePayload.ref = 1;
+    bb::fr key = VALUES[6];
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(key, nodePayload, *transaction);
+        transaction->commit();
+    }
+
+    auto read_node = [&](const bb::fr& hash, NodePayload& readBack) {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        return store.read_node(hash, readBack, *transaction);
+    };
+    auto get_stats = [&]() {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        TreeDBStats stats;
+        store.get_stats(stats, *transaction);
+        return stats;
+    };
+
+    NodePayload readBack;
+    EXPECT_TRUE(read_node(key, readBack));
+    EXPECT_TRUE(read_node(key, readBack));
+    EXPECT_EQ(readBack, nodePayload);
+    EXPECT_FALSE(read_node(VALUES[9], readBack));
+    TreeDBStats stats = get_stats();
+    EXPECT_EQ(stats.nodeCacheHits, 1);
+    EXPECT_EQ(stats.nodeCacheMisses, 2);
+
+    // Updating the reference count evicts the node
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.increment_node_reference_count(key, *transaction);
+        transaction->commit();
+    }
+    EXPECT_TRUE(read_node(key, readBack));
+    EXPECT_EQ(readBack.ref, 2);
+    EXPECT_TRUE(read_node(key, readBack));
+    stats = get_stats();
+    EXPECT_EQ(stats.nodeCacheHits, 2);
+    EXPECT_EQ(stats.nodeCacheMisses, 3);
+
+    // As does deleting it
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        NodePayload nodeData;
+        store.decrement_node_reference_count(key, nodeData, *transaction);
+        store.decrement_node_reference_count(key, nodeData, *transaction);
+        transaction->commit();
+    }
+    EXPECT_FALSE(read_node(key, readBack));
+
+    // Another store does not see the nodes cached by the first
+    std::string otherDirectory = _directory + "/other";
+    std::filesystem::create_directories(otherDirectory);
+    LMDBTreeStore otherStore(otherDirectory, "DB2", _mapSize, _maxReaders);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(key, nodePayload, *transaction);
+        transaction->commit();
+    }
+    EXPECT_TRUE(read_node(key, readBack));
+    {
+        LMDBReadTransaction::Ptr transaction = otherStore.create_read_transaction();
+        EXPECT_FALSE(otherStore.read_node(key, readBack, *transaction));
+    }
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
 {
     PublicDataLeafValue leafData;
@@ -0,0 +1,96 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "barretenberg/crypto/merkle_tree/lmdb_store/node_cache.hpp"
+#include <atomic>
+
+namespace bb::crypto::merkle_tree {
+
+NodeCache::NodeCache(size_t capacity)
+    : shardCapacity_((capacity + NUM_SHARDS - 1) / NUM_SHARDS)
+{}
+
+NodeCache& NodeCache::get()
+{
+    static NodeCache cache(DEFAULT_CAPACITY);
+    return cache;
+}
+
+uint64_t NodeCache::next_store_id()
+{
+    static std::atomic<uint64_t> nextId = 0;
+    return nextId++;
+}
+
+NodeCache::Shard& NodeCache::get_shard(const Key& key)
+{
+    // The low bits of the hash pick the bucket within the shard, use the high bits to pick the shard
+    return shards_[(KeyHash{}(key) >> 48) % NUM_SHARDS];
+}
+
+bool NodeCache::lookup(uint64_t storeId, const fr& nodeHash, NodePayload& nodeData)
+{
+    if (shardCapacity_ == 0) {
+        return false;
+    }
+    Key key{ storeId, nodeHash };
+    Shard& shard = get_shard(key);
+    std::unique_lock lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        return false;
+    }
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    nodeData = it->second->second;
+    return true;
+}
+
+void NodeCache::insert(uint64_t storeId, const fr& nodeHash, const NodePayload& nodeData)
+{
+    if (shardCapacity_ == 0) {
+        return;
+    }
+    Key key{ storeId, nodeHash };
+    Shard& shard = get_shard(key);
+    std::unique_lock lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        it->second->second = nodeData;
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        return;
+    }
+    if (shard.entries.size() == shardCapacity_) {
+        shard.index.erase(shard.entries.back().first);
+        shard.entries.pop_back();
+    }
+    shard.entries.emplace_front(key, nodeData);
+    shard.index[key] = shard.entries.begin();
+}
+
+void NodeCache::erase(uint64_t storeId, const fr& nodeHash)
+{
+    Key key{ storeId, nodeHash };
+    Shard& shard = get_shard(key);
+    std::unique_lock lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        return;
+    }
+    shard.entries.erase(it->second);
+    shard.index.erase(it);
+}
+
+size_t NodeCache::size() const
+{
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+        std::unique_lock lock(shard.mutex);
+        total += shard.entries.size();
+    }
+    return total;
+}
+
+} // namespace bb::crypto::merkle_tree
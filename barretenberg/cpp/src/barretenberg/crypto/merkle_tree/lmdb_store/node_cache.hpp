@@ -0,0 +1,92 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A bounded, thread-safe cache of the decoded nodes read from the node databases of the tree stores
+ * @details A single instance (see get()) sits below every LMDBTreeStore of the process, and hence below every fork of
+ * every tree, so that the nodes near the roots, which every read walks through, are decoded once rather than once per
+ * read. Entries are keyed by the node hash and by the id of the store they were read from, as the same node may
+ * exist in one store but not in another. The least recently used entries are evicted once the cache is full.
+ *
+ * The cache is split into shards, each with its own lock, so that concurrent readers rarely contend.
+ */
+class NodeCache {
+  public:
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 16;
+    static constexpr size_t NUM_SHARDS = 16;
+
+    /**
+     * @param capacity The number of nodes held, split evenly between the shards (rounding up), 0 disabling the cache
+     */
+    explicit NodeCache(size_t capacity);
+    NodeCache(const NodeCache& other) = delete;
+    NodeCache(NodeCache&& other) = delete;
+    NodeCache& operator=(const NodeCache& other) = delete;
+    NodeCache& operator=(NodeCache&& other) = delete;
+    ~NodeCache() = default;
+
+    /**
+     * @brief The cache shared by the tree stores, holding up to DEFAULT_CAPACITY nodes
+     */
+    static NodeCache& get();
+
+    /**
+     * @brief Returns a store id that has not been returned before
+     */
+    static uint64_t next_store_id();
+
+    /**
+     * @brief Copies the node into nodeData and marks it as most recently used, if it is cached
+     */
+    bool lookup(uint64_t storeId, const fr& nodeHash, NodePayload& nodeData);
+
+    void insert(uint64_t storeId, const fr& nodeHash, const NodePayload& nodeData);
+
+    void erase(uint64_t storeId, const fr& nodeHash);
+
+    size_t size() const;
+
+  private:
+    struct Key {
+        uint64_t storeId;
+        fr nodeHash;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept
+        {
+            return std::hash<fr>{}(key.nodeHash) ^ (key.storeId * 0x9e3779b97f4a7c15ULL);
+        }
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        // Most recently used first
+        std::list<std::pair<Key, NodePayload>> entries;
+        std::unordered_map<Key, std::list<std::pair<Key, NodePayload>>::iterator, KeyHash> index;
+    };
+
+    size_t shardCapacity_;
+    std::array<Shard, NUM_SHARDS> shards_;
+
+    Shard& get_shard(const Key& key);
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,125 @@
+#include "barretenberg/crypto/merkle_tree/lmdb_store/node_cache.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+NodePayload make_node(const fr& left, const fr& right, uint64_t ref)
+{
+    NodePayload node;
+    node.left = left;
+    node.right = right;
+    node.ref = ref;
+    return node;
+}
+} // namespace
+
+TEST(NodeCacheTest, can_insert_lookup_and_erase)
+{
+    NodeCache cache(NodeCache::NUM_SHARDS * 4);
+    NodePayload node = make_node(VALUES[0], VALUES[1], 1);
+    NodePayload readBack;
+    EXPECT_FALSE(cache.lookup(0, VALUES[2], readBack));
+
+    cache.insert(0, VALUES[2], node);
+    EXPECT_TRUE(cache.lookup(0, VALUES[2], readBack));
+    EXPECT_EQ(readBack, node);
+    EXPECT_EQ(cache.size(), 1);
+
+    // Inserting again replaces the entry
+    node.ref = 2;
+    cache.insert(0, VALUES[2], node);
+    EXPECT_TRUE(cache.lookup(0, VALUES[2], readBack));
+    EXPECT_EQ(readBack.ref, 2);
+    EXPECT_EQ(cache.size(), 1);
+
+    cache.erase(0, VALUES[2]);
+    EXPECT_FALSE(cache.lookup(0, VALUES[2], readBack));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(NodeCacheTest, keeps_the_stores_apart)
+{
+    NodeCache cache(NodeCache::NUM_SHARDS * 4);
+    NodePayload node = make_node(VALUES[0], VALUES[1], 1);
+    NodePayload readBack;
+    cache.insert(0, VALUES[2], node);
+    EXPECT_FALSE(cache.lookup(1, VALUES[2], readBack));
+
+    cache.insert(1, VALUES[2], node);
+    cache.erase(0, VALUES[2]);
+    EXPECT_FALSE(cache.lookup(0, VALUES[2], readBack));
+    EXPECT_TRUE(cache.lookup(1, VALUES[2], readBack));
+}
+
+TEST(NodeCacheTest, evicts_the_least_recently_used_nodes)
+{
+    // A single node per shard, so that every insertion into a full shard evicts the node it holds
+    NodeCache cache(NodeCache::NUM_SHARDS);
+    std::vector<fr> hashes;
+    for (size_t i = 0; i < NodeCache::NUM_SHARDS * 8; i++) {
+        hashes.push_back(fr::random_element());
+        cache.insert(0, hashes.back(), make_node(VALUES[0], VALUES[1], i));
+    }
+    EXPECT_LE(cache.size(), NodeCache::NUM_SHARDS);
+
+    // The most recent node is always present
+    NodePayload readBack;
+    EXPECT_TRUE(cache.lookup(0, hashes.back(), readBack));
+    EXPECT_EQ(readBack.ref, hashes.size() - 1);
+}
+
+TEST(NodeCacheTest, lookup_refreshes_a_node)
+{
+    // Two nodes per shard. A node that is looked up after every insertion is never the least recently used one.
+    NodeCache cache(NodeCache::NUM_SHARDS * 2);
+    fr hot = fr::random_element();
+    cache.insert(0, hot, make_node(VALUES[0], VALUES[1], 0));
+    NodePayload readBack;
+    for (size_t i = 0; i < NodeCache::NUM_SHARDS * 8; i++) {
+        cache.insert(0, fr::random_element(), make_node(VALUES[0], VALUES[1], 1));
+        EXPECT_TRUE(cache.lookup(0, hot, readBack));
+    }
+    EXPECT_EQ(readBack.ref, 0);
+}
+
+TEST(NodeCacheTest, can_be_disabled)
+{
+    NodeCache cache(0);
+    NodePayload readBack;
+    cache.insert(0, VALUES[2], make_node(VALUES[0], VALUES[1], 1));
+    EXPECT_FALSE(cache.lookup(0, VALUES[2], readBack));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(NodeCacheTest, can_be_used_from_multiple_threads)
+{
+    NodeCache cache(1024);
+    constexpr size_t NUM_NODES = 4096;
+    std::vector<fr> hashes(NUM_NODES);
+    for (auto& hash : hashes) {
+        hash = fr::random_element();
+    }
+    parallel_for(8, [&](size_t thread) {
+        NodePayload readBack;
+        for (size_t i = 0; i < NUM_NODES; i++) {
+            const size_t index = (i * 7 + thread * 131) % NUM_NODES;
+            if (cache.lookup(thread % 2, hashes[index], readBack)) {
+                EXPECT_EQ(readBack.ref, index);
+            } else {
+                cache.insert(thread % 2, hashes[index], make_node(VALUES[0], VALUES[1], index));
+            }
+            if (i % 5 == 0) {
+                cache.erase(thread % 2, hashes[index]);
+            }
+        }
+    });
+    EXPECT_LE(cache.size(), 1024);
+}
@@ -0,0 +1,187 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief A fixed-layout binary encoding for the fixed-shape records of the tree stores: nodes and leaf pre-images
+ * @details Every record starts with a 2 byte header, RECORD_TAG followed by RECORD_VERSION, and is followed by its
+ * fields in declaration order at fixed offsets:
+ *
+ * - fr: the 32 bytes of the canonical value, least significant limb first, as the store serialises its keys
+ * - uint64_t: 8 bytes, little endian
+ * - std::optional<fr>: a presence byte followed by the 32 bytes of the value, zero when absent
+ *
+ * A record can therefore be decoded in place from the pointer LMDB hands out, without an intermediate copy. RECORD_TAG
+ * is the one byte msgpack never emits, which tells these records apart from the msgpack encoded records written by
+ * earlier versions, so those can still be read and are re-encoded whenever they are next written.
+ *
+ * The migration is one way: software that predates these records cannot read them. The world state therefore stores
+ * them from schema version 2 on (WORLD_STATE_DB_VERSION in yarn-project/world-state), which upgrades version 1
+ * databases in place and makes older nodes reset the database instead of failing to decode it. Changing the layout of
+ * a record requires a new RECORD_VERSION, which readers must keep decoding, and a new schema version.
+ */
+namespace bb::crypto::merkle_tree::record_codec {
+
+constexpr uint8_t RECORD_TAG = 0xc1;
+constexpr uint8_t RECORD_VERSION = 1;
+constexpr size_t HEADER_SIZE = 2;
+
+/**
+ * @brief Specialised for each type with a fixed width encoding, providing its SIZE and how to write and read it
+ */
+template <typename T> struct FixedWidth;
+
+template <typename T>
+concept FixedWidthEncodable = requires(const T& value, T& out, uint8_t* dst, const uint8_t* src) {
+    { FixedWidth<T>::SIZE } -> std::convertible_to<size_t>;
+    FixedWidth<T>::write(value, dst);
+    FixedWidth<T>::read(src, out);
+};
+
+template <> struct FixedWidth<uint64_t> {
+    static constexpr size_t SIZE = sizeof(uint64_t);
+    static void write(const uint64_t& value, uint8_t* dst)
+    {
+        for (size_t i = 0; i < SIZE; ++i) {
+            dst[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+    static void read(const uint8_t* src, uint64_t& value)
+    {
+        value = 0;
+        for (size_t i = 0; i < SIZE; ++i) {
+            value |= static_cast<uint64_t>(src[i]) << (8 * i);
+        }
+    }
+};
+
+template <> struct FixedWidth<fr> {
+    static constexpr size_t SIZE = 32;
+    static void write(const fr& value, uint8_t* dst)
+    {
+        const uint256_t canonical(value);
+        for (size_t i = 0; i < 4; ++i) {
+            FixedWidth<uint64_t>::write(canonical.data[i], dst + i * sizeof(uint64_t));
+        }
+    }
+    static void read(const uint8_t* src, fr& value)
+    {
+        uint256_t canonical;
+        for (size_t i = 0; i < 4; ++i) {
+            FixedWidth<uint64_t>::read(src + i * sizeof(uint64_t), canonical.data[i]);
+        }
+        value = fr(canonical);
+    }
+};
+
+template <> struct FixedWidth<std::optional<fr>> {
+    static constexpr size_t SIZE = 1 + FixedWidth<fr>::SIZE;
+    static void write(const std::optional<fr>& value, uint8_t* dst)
+    {
+        dst[0] = static_cast<uint8_t>(value.has_value());
+        FixedWidth<fr>::write(value.value_or(fr::zero()), dst + 1);
+    }
+    static void read(const uint8_t* src, std::optional<fr>& value)
+    {
+        if (src[0] == 0) {
+            value = std::nullopt;
+            return;
+        }
+        fr present;
+        FixedWidth<fr>::read(src + 1, present);
+        value = present;
+    }
+};
+
+template <> struct FixedWidth<NullifierLeafValue> {
+    static constexpr size_t SIZE = FixedWidth<fr>::SIZE;
+    static void write(const NullifierLeafValue& value, uint8_t* dst) { FixedWidth<fr>::write(value.nullifier, dst); }
+    static void read(const uint8_t* src, NullifierLeafValue& value) { FixedWidth<fr>::read(src, value.nullifier); }
+};
+
+template <> struct FixedWidth<PublicDataLeafValue> {
+    static constexpr size_t SIZE = 2 * FixedWidth<fr>::SIZE;
+    static void write(const PublicDataLeafValue& value, uint8_t* dst)
+    {
+        FixedWidth<fr>::write(value.slot, dst);
+        FixedWidth<fr>::write(value.value, dst + FixedWidth<fr>::SIZE);
+    }
+    static void read(const uint8_t* src, PublicDataLeafValue& value)
+    {
+        FixedWidth<fr>::read(src, value.slot);
+        FixedWidth<fr>::read(src + FixedWidth<fr>::SIZE, value.value);
+    }
+};
+
+template <typename LeafType>
+    requires FixedWidthEncodable<LeafType>
+struct FixedWidth<IndexedLeaf<LeafType>> {
+    static constexpr size_t SIZE = FixedWidth<LeafType>::SIZE + FixedWidth<uint64_t>::SIZE + FixedWidth<fr>::SIZE;
+    static void write(const IndexedLeaf<LeafType>& value, uint8_t* dst)
+    {
+        FixedWidth<LeafType>::write(value.leaf, dst);
+        dst += FixedWidth<LeafType>::SIZE;
+        FixedWidth<uint64_t>::write(value.nextIndex, dst);
+        dst += FixedWidth<uint64_t>::SIZE;
+        FixedWidth<fr>::write(value.nextKey, dst);
+    }
+    static void read(const uint8_t* src, IndexedLeaf<LeafType>& value)
+    {
+        FixedWidth<LeafType>::read(src, value.leaf);
+        src += FixedWidth<LeafType>::SIZE;
+        FixedWidth<uint64_t>::read(src, value.nextIndex);
+        src += FixedWidth<uint64_t>::SIZE;
+        FixedWidth<fr>::read(src, value.nextKey);
+    }
+};
+
+/**
+ * @brief Whether the data is a record in this encoding, rather than a record written by an earlier version
+ */
+inline bool is_fixed_width(std::span<const uint8_t> data)
+{
+    return !data.empty() && data[0] == RECORD_TAG;
+}
+
+template <FixedWidthEncodable T> void encode(const T& value, std::vector<uint8_t>& buffer)
+{
+    buffer.resize(HEADER_SIZE + FixedWidth<T>::SIZE);
+    buffer[0] = RECORD_TAG;
+    buffer[1] = RECORD_VERSION;
+    FixedWidth<T>::write(value, buffer.data() + HEADER_SIZE);
+}
+
+/**
+ * @brief Decodes a record in this encoding, throwing if it is of another version or of the wrong size
+ */
+template <FixedWidthEncodable T> void decode(std::span<const uint8_t> data, T& value)
+{
+    if (data.size() < HEADER_SIZE || !is_fixed_width(data)) {
+        throw std::runtime_error("Unable to decode record, not a fixed width record");
+    }
+    if (data[1] != RECORD_VERSION) {
+        throw std::runtime_error(format("Unable to decode record of version ", static_cast<uint32_t>(data[1])));
+    }
+    if (data.size() != HEADER_SIZE + FixedWidth<T>::SIZE) {
+        throw std::runtime_error(format("Unable to decode record of size ", data.size()));
+    }
+    FixedWidth<T>::read(data.data() + HEADER_SIZE, value);
+}
+
+} // namespace bb::crypto::merkle_tree::record_codec
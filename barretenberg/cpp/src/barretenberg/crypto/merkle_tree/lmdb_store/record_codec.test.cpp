@@ -0,0 +1,79 @@
+#include "barretenberg/crypto/merkle_tree/lmdb_store/record_codec.hpp"
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+template <typename T> T round_trip(const T& value)
+{
+    std::vector<uint8_t> buffer;
+    record_codec::encode(value, buffer);
+    EXPECT_EQ(buffer.size(), record_codec::HEADER_SIZE + record_codec::FixedWidth<T>::SIZE);
+    EXPECT_TRUE(record_codec::is_fixed_width(buffer));
+    T decoded;
+    record_codec::decode(buffer, decoded);
+    return decoded;
+}
+} // namespace
+
+TEST(RecordCodecTest, can_encode_and_decode_fields)
+{
+    EXPECT_EQ(round_trip(VALUES[0]), VALUES[0]);
+    EXPECT_EQ(round_trip(fr::zero()), fr::zero());
+    EXPECT_EQ(round_trip(fr(-1)), fr(-1));
+    EXPECT_EQ(round_trip(std::numeric_limits<uint64_t>::max()), std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(round_trip(std::optional<fr>(VALUES[1])), std::optional<fr>(VALUES[1]));
+    EXPECT_EQ(round_trip(std::optional<fr>(fr::zero())), std::optional<fr>(fr::zero()));
+    EXPECT_EQ(round_trip(std::optional<fr>()), std::nullopt);
+}
+
+TEST(RecordCodecTest, can_encode_and_decode_leaves)
+{
+    IndexedLeaf<NullifierLeafValue> nullifier(NullifierLeafValue(VALUES[0]), 7, VALUES[1]);
+    EXPECT_EQ(round_trip(nullifier), nullifier);
+
+    IndexedLeaf<PublicDataLeafValue> publicData(PublicDataLeafValue(VALUES[2], VALUES[3]), 1ULL << 40, VALUES[4]);
+    EXPECT_EQ(round_trip(publicData), publicData);
+    EXPECT_EQ(round_trip(publicData.leaf), publicData.leaf);
+}
+
+TEST(RecordCodecTest, encodes_fields_in_canonical_little_endian_form)
+{
+    std::vector<uint8_t> buffer;
+    record_codec::encode(fr(0x0102), buffer);
+    std::vector<uint8_t> expected(record_codec::HEADER_SIZE + 32, 0);
+    expected[0] = record_codec::RECORD_TAG;
+    expected[1] = record_codec::RECORD_VERSION;
+    expected[2] = 0x02;
+    expected[3] = 0x01;
+    EXPECT_EQ(buffer, expected);
+}
+
+TEST(RecordCodecTest, rejects_records_it_can_not_decode)
+{
+    std::vector<uint8_t> buffer;
+    record_codec::encode(VALUES[0], buffer);
+    fr decoded;
+
+    std::vector<uint8_t> otherVersion = buffer;
+    otherVersion[1] = record_codec::RECORD_VERSION + 1;
+    EXPECT_THROW(record_codec::decode(otherVersion, decoded), std::runtime_error);
+
+    std::vector<uint8_t> truncated(buffer.begin(), buffer.end() - 1);
+    EXPECT_THROW(record_codec::decode(truncated, decoded), std::runtime_error);
+
+    std::vector<uint8_t> untagged = buffer;
+    untagged[0] = 0x83;
+    EXPECT_FALSE(record_codec::is_fixed_width(untagged));
+    EXPECT_THROW(record_codec::decode(untagged, decoded), std::runtime_error);
+    EXPECT_FALSE(record_codec::is_fixed_width({}));
+}
@@ -56,6 +56,13 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                                     uint32_t levels,
                                     const index_t& referenceBlockNumber,
                                     PersistedStoreType::SharedPtr dataStore);
+    /**
+     * @brief Creates a fork of the uncommitted state of another fork
+     * @details The parent's uncommitted data becomes an immutable snapshot that both stores read through, so this
+     * takes constant time and the new fork starts with the parent's cache warm. Like checkpoint, it assumes no reads or
+     * writes of the parent's uncommitted state are in progress. Throws if the parent has active checkpoints.
+     */
+    ContentAddressedCachedTreeStore(std::string name, uint32_t levels, ContentAddressedCachedTreeStore& parent);
     ~ContentAddressedCachedTreeStore() = default;
 
     ContentAddressedCachedTreeStore() = delete;
@@ -147,10 +154,29 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                                                 ReadTransaction& tx) const;
 
     /**
-     * @brief Commits the uncommitted data to the underlying store
+     * @brief Commits the uncommitted data to the underlying store, as a new block following any staged blocks
      */
     void commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats);
 
+    /**
+     * @brief Completes a block from the uncommitted data without persisting it. The block is persisted together with
+     * any other staged blocks by the next call to commit_block or commit_staged_blocks, in a single write transaction.
+     * @details Staged blocks are part of the uncommitted state. They are not visible to reads of committed state or of
+     * historic blocks until they are persisted and are lost if the process exits before then. A rollback only discards
+     * the changes made since the last staged block.
+     */
+    void stage_block(TreeMeta& finalMeta, TreeDBStats& dbStats);
+
+    /**
+     * @brief Persists the staged blocks, discarding any uncommitted data beyond the last of them
+     */
+    void commit_staged_blocks(TreeMeta& finalMeta, TreeDBStats& dbStats);
+
+    /**
+     * @brief Returns the number of blocks staged but not yet persisted
+     */
+    size_t num_staged_blocks() const { return stagedBlocks_.size(); }
+
     /**
      * @brief Commits the initial state of uncommitted data to the underlying store
      */
@@ -202,6 +228,8 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
         std::string name_;
         uint32_t depth_;
         std::optional<BlockPayload> initialised_from_block_;
+        // The uncommitted state of the fork this fork was created from, if any
+        typename Cache::ConstSharedPtr initialised_from_snapshot_;
     };
     ForkConstantData forkConstantData_;
     mutable std::mutex mtx_;
@@ -210,6 +238,9 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     Cache cache_;
 
+    // The meta data of the tree at the end of each staged block, the cache holds a checkpoint at the last of them
+    std::vector<TreeMeta> stagedBlocks_;
+
     void initialise();
 
     void initialise_from_block(const block_number_t& blockNumber);
@@ -220,6 +251,10 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_meta(TreeMeta& m, WriteTransaction& tx);
 
+    void persist_staged_blocks(TreeMeta& finalMeta);
+
+    void discard_cache();
+
     void persist_node(const std::optional<fr>& optional_hash, uint32_t level, WriteTransaction& tx);
 
     void remove_node(const std::optional<fr>& optional_hash,
@@ -267,6 +302,38 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
     initialise_from_block(referenceBlockNumber);
 }
 
+template <typename LeafValueType>
+ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(std::string name,
+                                                                                uint32_t levels,
+                                                                                ContentAddressedCachedTreeStore& parent)
+    : forkConstantData_{ .name_ = (std::move(name)), .depth_ = levels }
+    , dataStore_(parent.dataStore_)
+    , cache_(levels)
+{
+    if (!parent.forkConstantData_.initialised_from_block_.has_value()) {
+        throw std::runtime_error(
+            format("Unable to fork the uncommitted state of the main tree. Tree name: ", forkConstantData_.name_));
+    }
+    if (forkConstantData_.name_ != parent.forkConstantData_.name_ ||
+        forkConstantData_.depth_ != parent.forkConstantData_.depth_) {
+        throw std::runtime_error(format("Inconsistent tree meta data when forking ",
+                                        parent.forkConstantData_.name_,
+                                        " with depth ",
+                                        parent.forkConstantData_.depth_,
+                                        " as ",
+                                        forkConstantData_.name_,
+                                        " with depth ",
+                                        forkConstantData_.depth_));
+    }
+    forkConstantData_.initialised_from_block_ = parent.forkConstantData_.initialised_from_block_;
+    {
+        // Accessing the parent's cache under a lock
+        std::unique_lock lock(parent.mtx_);
+        forkConstantData_.initialised_from_snapshot_ = parent.cache_.snapshot();
+    }
+    cache_ = Cache(forkConstantData_.initialised_from_snapshot_);
+}
+
 // Much Like the commit/rollback/set finalised/remove historic blocks apis
 // These 3 apis (checkpoint/revert_checkpoint/commit_checkpoint) all assume they are not called
 // during the process of reading/writing uncommitted state
@@ -624,7 +691,7 @@ fr ContentAddressedCachedTreeStore<LeafValueType>::get_current_root(ReadTransact
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
 {
-    const std::map<uint256_t, index_t>& indices = cache_.get_indices();
+    const typename Cache::LeafKeyIndex& indices = cache_.get_indices();
     for (const auto& idx : indices) {
         FrKeyType key = idx.first;
         dataStore_->write_leaf_index(key, idx.second, tx);
@@ -660,64 +727,93 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
                 format("Unable to commit genesis data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
         }
     }
-    // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
-    rollback();
+    // discarding the cache destroys all cache stores and also refreshes the cached meta_ from persisted state
+    discard_cache();
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats)
 {
-    bool dataPresent = false;
-    TreeMeta meta;
+    stage_block(finalMeta, dbStats);
+    commit_staged_blocks(finalMeta, dbStats);
+}
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::stage_block(TreeMeta& finalMeta, TreeDBStats& dbStats)
+{
     // We don't allow commits using images/forks
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Committing a fork is forbidden");
     }
+    TreeMeta meta;
     get_meta(meta);
-    NodePayload rootPayload;
-    dataPresent = cache_.get_node(meta.root, rootPayload);
-    {
-        WriteTransactionPtr tx = create_write_transaction();
-        try {
-            if (dataPresent) {
-                // std::cout << "Persisting data for block " << uncommittedMeta.unfinalisedBlockHeight + 1 << std::endl;
-                // Persist the leaf indices
-                persist_leaf_indices(*tx);
-            }
+    ++meta.unfinalisedBlockHeight;
+    if (meta.oldestHistoricBlock == 0) {
+        meta.oldestHistoricBlock = 1;
+    }
+    put_meta(meta);
+    stagedBlocks_.push_back(meta);
+
+    // The cache only ever holds a single checkpoint at the last staged block, a rollback reverts to it
+    if (stagedBlocks_.size() > 1) {
+        cache_.commit();
+    }
+    cache_.checkpoint();
+    finalMeta = meta;
+    extract_db_stats(dbStats);
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::commit_staged_blocks(TreeMeta& finalMeta, TreeDBStats& dbStats)
+{
+    if (stagedBlocks_.empty()) {
+        get_meta(finalMeta);
+    } else {
+        persist_staged_blocks(finalMeta);
+    }
+
+    // discarding the cache destroys all cache stores and also refreshes the cached meta_ from persisted state
+    discard_cache();
+
+    extract_db_stats(dbStats);
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_staged_blocks(TreeMeta& finalMeta)
+{
+    WriteTransactionPtr tx = create_write_transaction();
+    try {
+        // The leaf indices are only ever added to, those of the last staged block are a superset of the others
+        persist_leaf_indices(*tx);
+        for (const TreeMeta& staged : stagedBlocks_) {
             // If we are commiting a block, we need to persist the root, since the new block "references" this root
             // However, if the root is the empty root we can't persist it, since it's not a real node and doesn't have
             // nodes beneath it. We coujld store a 'dummy' node to represent it but then we have to work around the
             // absence of a real tree elsewhere. So, if the tree is completely empty we do not store any node data, the
             // only issue is this needs to be recognised when we unwind or remove historic blocks i.e. there will be no
             // node date to remove for these blocks
-            if (dataPresent || meta.size > 0) {
-                persist_node(std::optional<fr>(meta.root), 0, *tx);
-            }
-            ++meta.unfinalisedBlockHeight;
-            if (meta.oldestHistoricBlock == 0) {
-                meta.oldestHistoricBlock = 1;
+            // Nodes shared with an earlier staged block have already been written in this transaction, so only have
+            // their reference count incremented, exactly as if the blocks were committed one at a time
+            NodePayload rootPayload;
+            if (cache_.get_node(staged.root, rootPayload) || staged.size > 0) {
+                persist_node(std::optional<fr>(staged.root), 0, *tx);
             }
-            // std::cout << "New root " << uncommittedMeta.root << std::endl;
-            BlockPayload block{ .size = meta.size, .blockNumber = meta.unfinalisedBlockHeight, .root = meta.root };
-            dataStore_->write_block_data(meta.unfinalisedBlockHeight, block, *tx);
+            BlockPayload block{
+                .size = staged.size, .blockNumber = staged.unfinalisedBlockHeight, .root = staged.root
+            };
+            dataStore_->write_block_data(block.blockNumber, block, *tx);
             dataStore_->write_block_index_data(block.blockNumber, block.size, *tx);
-
-            meta.committedSize = meta.size;
-            persist_meta(meta, *tx);
-            tx->commit();
-        } catch (std::exception& e) {
-            tx->try_abort();
-            throw std::runtime_error(
-                format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
         }
-    }
-    finalMeta = meta;
-
-    // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
-    rollback();
 
-    extract_db_stats(dbStats);
+        finalMeta = stagedBlocks_.back();
+        finalMeta.committedSize = finalMeta.size;
+        persist_meta(finalMeta, *tx);
+        tx->commit();
+    } catch (std::exception& e) {
+        tx->try_abort();
+        throw std::runtime_error(
+            format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
+    }
 }
 
 template <typename LeafValueType>
@@ -783,6 +879,23 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::rollback()
 {
+    if (!stagedBlocks_.empty()) {
+        // Only discard the changes made since the last staged block
+        cache_.revert();
+        cache_.checkpoint();
+        return;
+    }
+    discard_cache();
+}
+
+template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::discard_cache()
+{
+    stagedBlocks_.clear();
+    if (forkConstantData_.initialised_from_snapshot_ != nullptr) {
+        // We were forked from uncommitted state, that is the state we return to
+        cache_ = Cache(forkConstantData_.initialised_from_snapshot_);
+        return;
+    }
     // Extract the committed meta data and destroy the cache
     cache_.reset(forkConstantData_.depth_);
     {
@@ -8,6 +8,7 @@
 #include "./tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/sorted_block_map.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
@@ -31,15 +32,26 @@ namespace bb::crypto::merkle_tree {
 // Stores all of the penidng updates to a mekle tree indexed for optimal retrieval
 // Also stores a journal of inverse changes to the cache, enabling checkpoints and
 // and subsequent commit/revert operations
+// A cache can be layered on top of an immutable snapshot of another cache's updates. Reads fall through to the snapshot
+// when the cache has no entry of its own, writes only ever go to the top layer
 template <typename LeafValueType> class ContentAddressedCache {
   public:
     using LeafType = LeafValueType;
     using IndexedLeafValueType = IndexedLeaf<LeafValueType>;
     using SharedPtr = std::shared_ptr<ContentAddressedCache>;
     using UniquePtr = std::unique_ptr<ContentAddressedCache>;
+    using ConstSharedPtr = std::shared_ptr<const ContentAddressedCache>;
+    using LeafKeyIndex = SortedBlockMap<uint256_t, index_t>;
+
+    // Beyond this many layers a new snapshot is flattened into one, bounding the cost of reads that fall through
+    static constexpr size_t MAX_SNAPSHOT_LAYERS = 8;
 
     ContentAddressedCache() = delete;
     ContentAddressedCache(uint32_t depth);
+    /**
+     * @brief Creates an empty cache layered on top of the given snapshot, starting from the snapshot's meta data
+     */
+    ContentAddressedCache(ConstSharedPtr snapshot);
     ~ContentAddressedCache() = default;
     ContentAddressedCache(const ContentAddressedCache& other) = default;
     ContentAddressedCache& operator=(const ContentAddressedCache& other) = default;
@@ -52,6 +64,16 @@ template <typename LeafValueType> class ContentAddressedCache {
     void commit();
 
     void reset(uint32_t depth);
+
+    /**
+     * @brief Moves the updates held by this cache into an immutable snapshot and layers the cache on top of it
+     * @details This is constant time unless the snapshot needs flattening. The contents of the cache as seen by reads
+     * do not change. The snapshot can be shared with other caches. Throws if the cache has active checkpoints, as they
+     * could no longer be reverted. Every layer adds a lookup to the reads of this cache that miss its top layer, until
+     * the layers are flattened beyond MAX_SNAPSHOT_LAYERS
+     */
+    ConstSharedPtr snapshot();
+
     std::pair<bool, index_t> find_low_value(const uint256_t& new_leaf_key,
                                             const uint256_t& retrieved_value,
                                             const index_t& db_index) const;
@@ -74,7 +96,8 @@ template <typename LeafValueType> class ContentAddressedCache {
     std::optional<fr> get_node_by_index(uint32_t level, const index_t& index) const;
     void put_node_by_index(uint32_t level, const index_t& index, const fr& node);
 
-    const std::map<uint256_t, index_t>& get_indices() const { return indices_; }
+    // The leaf key indices of the top layer only, the caches that are persisted are never layered
+    const LeafKeyIndex& get_indices() const { return indices_; }
 
     bool is_equivalent_to(const ContentAddressedCache& other) const;
 
@@ -89,12 +112,13 @@ template <typename LeafValueType> class ContentAddressedCache {
         // Captures the cache's leaf pre-images at the time of checkpoint. Again, if the leaf does not exist in the
         // cache, the optional will == nullopt
         std::unordered_map<index_t, std::optional<IndexedLeafValueType>> leaf_pre_image_by_index_;
-        // Captures the addition of new leaf keys into the indices_ cache
-        std::vector<uint256_t> new_leaf_keys_;
+        // The position in the cache's log of new leaf keys at the time of checkpoint
+        size_t new_leaf_keys_start_;
 
-        Journal(TreeMeta meta)
+        Journal(TreeMeta meta, size_t new_leaf_keys_start)
             : meta_(std::move(meta))
             , nodes_by_index_(meta_.depth + 1, std::unordered_map<index_t, std::optional<fr>>())
+            , new_leaf_keys_start_(new_leaf_keys_start)
         {}
     };
     // This is a mapping between the node hash and it's payload (children and ref count) for every node in the tree,
@@ -104,7 +128,7 @@ template <typename LeafValueType> class ContentAddressedCache {
 
     // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to the
     // index in the tree
-    std::map<uint256_t, index_t> indices_;
+    LeafKeyIndex indices_;
 
     // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
     // commiting updates
@@ -117,6 +141,17 @@ template <typename LeafValueType> class ContentAddressedCache {
 
     // The currently active journals
     std::vector<Journal> journals_;
+
+    // An undo log of the leaf keys added to indices_ while there are active journals, each journal owns the keys from
+    // its starting position onwards. Shared by all journals so that committing a checkpoint doesn't copy them
+    std::vector<uint256_t> new_leaf_keys_;
+
+    // The snapshot this cache is layered on, if any, and the number of layers including this one
+    ConstSharedPtr snapshot_;
+    size_t num_layers_ = 1;
+
+    bool is_empty() const;
+    void flatten();
 };
 
 template <typename LeafValueType> ContentAddressedCache<LeafValueType>::ContentAddressedCache(uint32_t depth)
@@ -124,9 +159,18 @@ template <typename LeafValueType> ContentAddressedCache<LeafValueType>::ContentA
     reset(depth);
 }
 
+template <typename LeafValueType>
+ContentAddressedCache<LeafValueType>::ContentAddressedCache(ConstSharedPtr snapshot)
+{
+    reset(static_cast<uint32_t>(snapshot->nodes_by_index_.size() - 1));
+    meta_ = snapshot->get_meta();
+    num_layers_ = snapshot->num_layers_ + 1;
+    snapshot_ = std::move(snapshot);
+}
+
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::checkpoint()
 {
-    journals_.emplace_back(Journal(meta_));
+    journals_.emplace_back(Journal(meta_, new_leaf_keys_.size()));
 }
 
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::revert()
@@ -167,9 +211,10 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::rev
     }
 
     // Remove any newly added leaf keys
-    for (const auto& key : journal.new_leaf_keys_) {
-        indices_.erase(key);
+    for (size_t i = journal.new_leaf_keys_start_; i < new_leaf_keys_.size(); ++i) {
+        indices_.erase(new_leaf_keys_[i]);
     }
+    new_leaf_keys_.resize(journal.new_leaf_keys_start_);
 
     // We need to restore the meta data
     meta_ = std::move(journal.meta_);
@@ -183,11 +228,12 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
     }
 
     // We need to iterate over the nodes and leaves and merge them into the previous checkpoint if there is one
-    // We also need to append any newly added leaf keys to the previous checkpoint
-    // If there is no previous checkpoint then we just destroy the journal as the cache will be correct
+    // Newly added leaf keys are already owned by the previous checkpoint, as they follow its start in the log
+    // If there is no previous checkpoint then we just destroy the journal and the log as the cache will be correct
 
     if (journals_.size() == 1) {
         journals_.clear();
+        new_leaf_keys_.clear();
         return;
     }
 
@@ -216,11 +262,6 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
         }
     }
 
-    // Add our newly appended leaf keys to those of the previous journal
-    previous_journal.new_leaf_keys_.insert(previous_journal.new_leaf_keys_.end(),
-                                           current_journal.new_leaf_keys_.cbegin(),
-                                           current_journal.new_leaf_keys_.cend());
-
     // We don't restore the meta here. We are committing, so the primary cached meta is correct
     journals_.pop_back();
 }
@@ -228,11 +269,62 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::reset(uint32_t depth)
 {
     nodes_ = std::unordered_map<fr, NodePayload>();
-    indices_ = std::map<uint256_t, index_t>();
+    indices_ = LeafKeyIndex();
     leaves_ = std::unordered_map<fr, IndexedLeafValueType>();
     nodes_by_index_ = std::vector<std::unordered_map<index_t, fr>>(depth + 1, std::unordered_map<index_t, fr>());
     leaf_pre_image_by_index_ = std::unordered_map<index_t, IndexedLeafValueType>();
     journals_ = std::vector<Journal>();
+    new_leaf_keys_ = std::vector<uint256_t>();
+    snapshot_ = nullptr;
+    num_layers_ = 1;
+}
+
+template <typename LeafValueType>
+typename ContentAddressedCache<LeafValueType>::ConstSharedPtr ContentAddressedCache<LeafValueType>::snapshot()
+{
+    if (!journals_.empty()) {
+        throw std::runtime_error("Unable to snapshot a cache with active checkpoints");
+    }
+    // Nothing has been written since the last snapshot, it can be shared as it is
+    if (snapshot_ != nullptr && is_empty()) {
+        return snapshot_;
+    }
+    auto depth = static_cast<uint32_t>(nodes_by_index_.size() - 1);
+    auto frozen = std::make_shared<ContentAddressedCache>(std::move(*this));
+    if (frozen->num_layers_ > MAX_SNAPSHOT_LAYERS) {
+        frozen->flatten();
+    }
+    reset(depth);
+    meta_ = frozen->get_meta();
+    num_layers_ = frozen->num_layers_ + 1;
+    snapshot_ = frozen;
+    return frozen;
+}
+
+template <typename LeafValueType> bool ContentAddressedCache<LeafValueType>::is_empty() const
+{
+    for (const auto& level : nodes_by_index_) {
+        if (!level.empty()) {
+            return false;
+        }
+    }
+    return nodes_.empty() && indices_.empty() && leaves_.empty() && leaf_pre_image_by_index_.empty();
+}
+
+template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::flatten()
+{
+    // Walk down from the nearest layer, an insert never overwrites so the most recent value of every entry is retained
+    for (const ContentAddressedCache* layer = snapshot_.get(); layer != nullptr; layer = layer->snapshot_.get()) {
+        nodes_.insert(layer->nodes_.begin(), layer->nodes_.end());
+        indices_.insert(layer->indices_.begin(), layer->indices_.end());
+        leaves_.insert(layer->leaves_.begin(), layer->leaves_.end());
+        for (size_t i = 0; i < nodes_by_index_.size(); ++i) {
+            nodes_by_index_[i].insert(layer->nodes_by_index_[i].begin(), layer->nodes_by_index_[i].end());
+        }
+        leaf_pre_image_by_index_.insert(layer->leaf_pre_image_by_index_.begin(), layer->leaf_pre_image_by_index_.end());
+    }
+    snapshot_ = nullptr;
+    num_layers_ = 1;
 }
 
 template <typename LeafValueType>
@@ -287,45 +379,41 @@ std::pair<bool, index_t> ContentAddressedCache<LeafValueType>::find_low_value(co
                                                                               const uint256_t& retrieved_value,
                                                                               const index_t& db_index) const
 {
-    if (indices_.empty()) {
-        return std::make_pair(new_leaf_key == retrieved_value, db_index);
-    }
     // At this stage, we have been asked to include uncommitted and the value was not exactly found in the db
-    auto it = indices_.lower_bound(new_leaf_key);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        // we need to return the larger of the db value or the cached value
-
-        return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
-    }
-
-    if (it->first == new_leaf_key) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
-    }
-    // the iterator points to the element immediately larger than the requested value
     // We need to return the highest value from
-    // 1. The next lowest cached value, if there is one
+    // 1. The next lowest cached value of any layer, if there is one
     // 2. The value retrieved from the db
-    if (it == indices_.begin()) {
-        // No cached lower value, return the db index
-        return std::make_pair(false, db_index);
+    uint256_t low_value = retrieved_value;
+    index_t low_index = db_index;
+    for (const ContentAddressedCache* layer = this; layer != nullptr; layer = layer->snapshot_.get()) {
+        const auto* entry = layer->indices_.find_less_or_equal(new_leaf_key);
+        if (entry == nullptr) {
+            // No cached lower value in this layer
+            continue;
+        }
+        if (entry->first == new_leaf_key) {
+            // the value is already present
+            return std::make_pair(true, entry->second);
+        }
+        // entry is the value immediately less than that requested
+        if (entry->first > low_value) {
+            low_value = entry->first;
+            low_index = entry->second;
+        }
     }
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    return std::make_pair(low_value == new_leaf_key, low_index);
 }
 
 template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_leaf_preimage_by_hash(const fr& leaf_hash,
                                                                      IndexedLeafValueType& leaf_pre_image) const
 {
-    typename std::unordered_map<fr, IndexedLeafValueType>::const_iterator it = leaves_.find(leaf_hash);
-    if (it != leaves_.end()) {
-        leaf_pre_image = it->second;
-        return true;
+    for (const ContentAddressedCache* layer = this; layer != nullptr; layer = layer->snapshot_.get()) {
+        auto it = layer->leaves_.find(leaf_hash);
+        if (it != layer->leaves_.end()) {
+            leaf_pre_image = it->second;
+            return true;
+        }
     }
     return false;
 }
@@ -341,11 +429,12 @@ template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_leaf_by_index(const index_t& index,
                                                              IndexedLeafValueType& leaf_pre_image) const
 {
-    typename std::unordered_map<index_t, IndexedLeafValueType>::const_iterator it =
-        leaf_pre_image_by_index_.find(index);
-    if (it != leaf_pre_image_by_index_.end()) {
-        leaf_pre_image = it->second;
-        return true;
+    for (const ContentAddressedCache* layer = this; layer != nullptr; layer = layer->snapshot_.get()) {
+        auto it = layer->leaf_pre_image_by_index_.find(index);
+        if (it != layer->leaf_pre_image_by_index_.end()) {
+            leaf_pre_image = it->second;
+            return true;
+        }
     }
     return false;
 }
@@ -382,22 +471,27 @@ template <typename LeafValueType>
 void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t& index, const fr& leaf_key)
 {
     uint256_t key = uint256_t(leaf_key);
-    auto result = indices_.insert({ key, index });
-    if (result.second && !journals_.empty()) {
-        // The insertion took place, if we have a current journal then we need to add to the newly inserted leaf keys
-        Journal& journal = journals_.back();
-        journal.new_leaf_keys_.emplace_back(key);
+    // An existing key is never overwritten, that includes the keys of the snapshot
+    if (snapshot_ != nullptr && snapshot_->get_leaf_key_index(leaf_key).has_value()) {
+        return;
+    }
+    bool inserted = indices_.insert({ key, index });
+    if (inserted && !journals_.empty()) {
+        // The insertion took place, if we have a current journal then we need to log the newly inserted leaf key
+        new_leaf_keys_.emplace_back(key);
     }
 }
 
 template <typename LeafValueType>
 std::optional<index_t> ContentAddressedCache<LeafValueType>::get_leaf_key_index(const fr& leaf_key) const
 {
-    auto it = indices_.find(uint256_t(leaf_key));
-    if (it == indices_.end()) {
-        return std::nullopt;
+    for (const ContentAddressedCache* layer = this; layer != nullptr; layer = layer->snapshot_.get()) {
+        const auto* entry = layer->indices_.find(uint256_t(leaf_key));
+        if (entry != nullptr) {
+            return entry->second;
+        }
     }
-    return it->second;
+    return std::nullopt;
 }
 
 template <typename LeafValueType>
@@ -409,22 +503,26 @@ void ContentAddressedCache<LeafValueType>::put_node(const fr& node_hash, const N
 template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_node(const fr& node_hash, NodePayload& node) const
 {
-    auto it = nodes_.find(node_hash);
-    if (it == nodes_.end()) {
-        return false;
+    for (const ContentAddressedCache* layer = this; layer != nullptr; layer = layer->snapshot_.get()) {
+        auto it = layer->nodes_.find(node_hash);
+        if (it != layer->nodes_.end()) {
+            node = it->second;
+            return true;
+        }
     }
-    node = it->second;
-    return true;
+    return false;
 }
 
 template <typename LeafValueType>
 std::optional<fr> ContentAddressedCache<LeafValueType>::get_node_by_index(uint32_t level, const index_t& index) const
 {
-    auto it = nodes_by_index_[level].find(index);
-    if (it == nodes_by_index_[level].end()) {
-        return std::nullopt;
+    for (const ContentAddressedCache* layer = this; layer != nullptr; layer = layer->snapshot_.get()) {
+        auto it = layer->nodes_by_index_[level].find(index);
+        if (it != layer->nodes_by_index_[level].end()) {
+            return it->second;
+        }
     }
-    return it->second;
+    return std::nullopt;
 }
 
 template <typename LeafValueType>
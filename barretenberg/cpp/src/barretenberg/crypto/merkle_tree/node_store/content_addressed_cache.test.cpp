@@ -550,3 +550,80 @@ TEST_F(ContentAddressedCacheTest, reverts_remove_all_deeper_commits_2)
         reverts_remove_all_deeper_commits_2(max_index, depth, num_levels);
     }
 }
+
+TEST_F(ContentAddressedCacheTest, can_layer_caches_on_a_shared_snapshot)
+{
+    CacheType parent = create_cache(10);
+    auto make_leaf = [](uint64_t key) { return IndexedLeafType(LeafValueType(fr(key), fr(1)), 0, fr::zero()); };
+    fr node_hash_1 = fr::random_element();
+    parent.put_node_by_index(5, 2, node_hash_1);
+    parent.put_leaf_by_index(1, make_leaf(10));
+    parent.update_leaf_key_index(1, fr(10));
+    parent.put_leaf_by_index(3, make_leaf(30));
+    parent.update_leaf_key_index(3, fr(30));
+
+    CacheType child(parent.snapshot());
+    EXPECT_EQ(child.get_meta(), parent.get_meta());
+
+    // both caches read the snapshot
+    EXPECT_EQ(parent.get_node_by_index(5, 2).value(), node_hash_1);
+    EXPECT_EQ(child.get_node_by_index(5, 2).value(), node_hash_1);
+    EXPECT_EQ(child.get_leaf_key_index(fr(30)).value(), 3);
+
+    // but the writes of one are not seen by the other
+    fr node_hash_2 = fr::random_element();
+    fr node_hash_3 = fr::random_element();
+    child.put_node_by_index(5, 2, node_hash_2);
+    parent.put_node_by_index(5, 2, node_hash_3);
+    EXPECT_EQ(child.get_node_by_index(5, 2).value(), node_hash_2);
+    EXPECT_EQ(parent.get_node_by_index(5, 2).value(), node_hash_3);
+
+    child.put_leaf_by_index(5, make_leaf(20));
+    child.update_leaf_key_index(5, fr(20));
+    IndexedLeafType leaf;
+    EXPECT_TRUE(child.get_leaf_by_index(1, leaf));
+    EXPECT_EQ(leaf, make_leaf(10));
+    EXPECT_FALSE(parent.get_leaf_by_index(5, leaf));
+
+    // the low leaf is found across the layers
+    EXPECT_EQ(child.find_low_value(25, 0, 0), std::make_pair(false, index_t(5)));
+    EXPECT_EQ(parent.find_low_value(25, 0, 0), std::make_pair(false, index_t(1)));
+    EXPECT_EQ(child.find_low_value(30, 0, 0), std::make_pair(true, index_t(3)));
+    EXPECT_EQ(child.find_low_value(35, 32, 9), std::make_pair(false, index_t(9)));
+
+    // existing keys are not overwritten, including those of the snapshot
+    child.update_leaf_key_index(7, fr(10));
+    EXPECT_EQ(child.get_leaf_key_index(fr(10)).value(), 1);
+
+    // reverting a checkpoint restores the values of the snapshot
+    child.checkpoint();
+    child.put_leaf_by_index(1, make_leaf(11));
+    child.revert();
+    EXPECT_TRUE(child.get_leaf_by_index(1, leaf));
+    EXPECT_EQ(leaf, make_leaf(10));
+
+    // a cache can't be snapshotted while it has checkpoints
+    child.checkpoint();
+    EXPECT_THROW(child.snapshot(), std::runtime_error);
+}
+
+TEST_F(ContentAddressedCacheTest, flattens_deep_snapshots)
+{
+    CacheType cache = create_cache(10);
+    std::vector<CacheType> children;
+    for (uint64_t i = 0; i < 2 * CacheType::MAX_SNAPSHOT_LAYERS; i++) {
+        cache.put_node_by_index(10, i, fr(i));
+        cache.put_node_by_index(10, 0, fr(100 + i));
+        children.emplace_back(cache.snapshot());
+    }
+    // a snapshot without any writes since the previous one is shared as it is
+    CacheType::ConstSharedPtr snapshot = cache.snapshot();
+    EXPECT_EQ(cache.snapshot(), snapshot);
+
+    for (uint64_t i = 0; i < children.size(); i++) {
+        EXPECT_EQ(children[i].get_node_by_index(10, 0), fr(100 + i));
+        for (uint64_t j = 1; j < children.size(); j++) {
+            EXPECT_EQ(children[i].get_node_by_index(10, j), j <= i ? std::optional<fr>(fr(j)) : std::nullopt);
+        }
+    }
+}
@@ -0,0 +1,226 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief An ordered map of unique keys held as a sequence of sorted blocks of contiguous entries
+ * @details Entries are split across blocks of at most MaxBlockSize entries, each block holding a contiguous range of
+ * keys. The largest key of every block is kept in a separate vector, so a lookup is a binary search over those keys
+ * followed by a binary search within a single block. Both are searches over contiguous memory, unlike the pointer
+ * chasing of a node based tree. Inserts and erases shift the entries of one block, a full block is split in two and an
+ * empty block is removed.
+ */
+template <typename Key, typename Value, size_t MaxBlockSize = 256> class SortedBlockMap {
+  public:
+    using value_type = std::pair<Key, Value>;
+
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SortedBlockMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() = default;
+        const_iterator(const SortedBlockMap* map, size_t block, size_t entry)
+            : map_(map)
+            , block_(block)
+            , entry_(entry)
+        {}
+
+        reference operator*() const { return map_->blocks_[block_][entry_]; }
+        pointer operator->() const { return &map_->blocks_[block_][entry_]; }
+        const_iterator& operator++()
+        {
+            if (++entry_ == map_->blocks_[block_].size()) {
+                ++block_;
+                entry_ = 0;
+            }
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator current = *this;
+            ++(*this);
+            return current;
+        }
+        bool operator==(const const_iterator& other) const
+        {
+            return block_ == other.block_ && entry_ == other.entry_;
+        }
+
+      private:
+        const SortedBlockMap* map_ = nullptr;
+        size_t block_ = 0;
+        size_t entry_ = 0;
+    };
+
+    SortedBlockMap() = default;
+    ~SortedBlockMap() = default;
+    SortedBlockMap(const SortedBlockMap& other) = default;
+    SortedBlockMap(SortedBlockMap&& other) noexcept = default;
+    SortedBlockMap& operator=(const SortedBlockMap& other) = default;
+    SortedBlockMap& operator=(SortedBlockMap&& other) noexcept = default;
+
+    // Maps are equal if they hold the same entries, regardless of how they are split into blocks
+    bool operator==(const SortedBlockMap& other) const
+    {
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0, 0); }
+    const_iterator end() const { return const_iterator(this, blocks_.size(), 0); }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void clear()
+    {
+        blocks_.clear();
+        max_keys_.clear();
+        size_ = 0;
+    }
+
+    /**
+     * @brief Inserts the entry if the key is not already present
+     * @return Whether the entry was inserted
+     */
+    bool insert(const value_type& entry);
+
+    /**
+     * @brief Inserts all of the entries in the range whose keys are not already present
+     */
+    template <typename Iterator> void insert(Iterator first, Iterator last)
+    {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Removes the entry with the given key, if present
+     * @return Whether an entry was removed
+     */
+    bool erase(const Key& key);
+
+    /**
+     * @brief Returns the entry with the given key, nullptr if not present
+     */
+    const value_type* find(const Key& key) const;
+
+    /**
+     * @brief Returns the entry with the largest key less than or equal to the given key, nullptr if there is none
+     */
+    const value_type* find_less_or_equal(const Key& key) const;
+
+  private:
+    std::vector<std::vector<value_type>> blocks_;
+    // The largest key of each block
+    std::vector<Key> max_keys_;
+    size_t size_ = 0;
+
+    static bool entry_less_than_key(const value_type& entry, const Key& key) { return entry.first < key; }
+    static bool key_less_than_entry(const Key& key, const value_type& entry) { return key < entry.first; }
+
+    // The first block whose largest key is >= key, blocks_.size() if there is none
+    size_t find_block(const Key& key) const
+    {
+        return static_cast<size_t>(std::lower_bound(max_keys_.begin(), max_keys_.end(), key) - max_keys_.begin());
+    }
+};
+
+template <typename Key, typename Value, size_t MaxBlockSize>
+bool SortedBlockMap<Key, Value, MaxBlockSize>::insert(const value_type& entry)
+{
+    if (blocks_.empty()) {
+        blocks_.emplace_back().reserve(MaxBlockSize);
+        blocks_.back().push_back(entry);
+        max_keys_.push_back(entry.first);
+        size_ = 1;
+        return true;
+    }
+    // A key larger than any present goes at the end of the last block
+    size_t block_index = std::min(find_block(entry.first), blocks_.size() - 1);
+    std::vector<value_type>& block = blocks_[block_index];
+    auto it = std::lower_bound(block.begin(), block.end(), entry.first, entry_less_than_key);
+    if (it != block.end() && it->first == entry.first) {
+        return false;
+    }
+    block.insert(it, entry);
+    max_keys_[block_index] = block.back().first;
+    ++size_;
+
+    if (block.size() > MaxBlockSize) {
+        // Split the block, moving its upper half into a new block following it
+        std::vector<value_type> upper;
+        upper.reserve(MaxBlockSize);
+        auto middle = block.begin() + static_cast<std::ptrdiff_t>(block.size() / 2);
+        upper.assign(std::make_move_iterator(middle), std::make_move_iterator(block.end()));
+        block.erase(middle, block.end());
+        max_keys_[block_index] = block.back().first;
+        max_keys_.insert(max_keys_.begin() + static_cast<std::ptrdiff_t>(block_index + 1), upper.back().first);
+        blocks_.insert(blocks_.begin() + static_cast<std::ptrdiff_t>(block_index + 1), std::move(upper));
+    }
+    return true;
+}
+
+template <typename Key, typename Value, size_t MaxBlockSize>
+bool SortedBlockMap<Key, Value, MaxBlockSize>::erase(const Key& key)
+{
+    size_t block_index = find_block(key);
+    if (block_index == blocks_.size()) {
+        return false;
+    }
+    std::vector<value_type>& block = blocks_[block_index];
+    auto it = std::lower_bound(block.begin(), block.end(), key, entry_less_than_key);
+    if (it == block.end() || it->first != key) {
+        return false;
+    }
+    block.erase(it);
+    --size_;
+    if (block.empty()) {
+        blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(block_index));
+        max_keys_.erase(max_keys_.begin() + static_cast<std::ptrdiff_t>(block_index));
+    } else {
+        max_keys_[block_index] = block.back().first;
+    }
+    return true;
+}
+
+template <typename Key, typename Value, size_t MaxBlockSize>
+auto SortedBlockMap<Key, Value, MaxBlockSize>::find(const Key& key) const -> const value_type*
+{
+    const value_type* entry = find_less_or_equal(key);
+    return entry != nullptr && entry->first == key ? entry : nullptr;
+}
+
+template <typename Key, typename Value, size_t MaxBlockSize>
+auto SortedBlockMap<Key, Value, MaxBlockSize>::find_less_or_equal(const Key& key) const -> const value_type*
+{
+    size_t block_index = find_block(key);
+    if (block_index == blocks_.size()) {
+        // The key is larger than any present, the largest entry is the last of the last block
+        return blocks_.empty() ? nullptr : &blocks_.back().back();
+    }
+    const std::vector<value_type>& block = blocks_[block_index];
+    auto it = std::upper_bound(block.begin(), block.end(), key, key_less_than_entry);
+    if (it != block.begin()) {
+        return &*(it - 1);
+    }
+    // Every entry of this block is larger than the key, the entry we want is the last of the previous block
+    return block_index == 0 ? nullptr : &blocks_[block_index - 1].back();
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,102 @@
+#include "barretenberg/crypto/merkle_tree/node_store/sorted_block_map.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstdint>
+#include <map>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+// A small block size so that the tests split and remove plenty of blocks
+using MapType = SortedBlockMap<uint256_t, uint64_t, 4>;
+using ReferenceMapType = std::map<uint256_t, uint64_t>;
+
+void check_equal(const MapType& map, const ReferenceMapType& reference)
+{
+    EXPECT_EQ(map.size(), reference.size());
+    EXPECT_EQ(map.empty(), reference.empty());
+    std::vector<std::pair<uint256_t, uint64_t>> entries(map.begin(), map.end());
+    std::vector<std::pair<uint256_t, uint64_t>> expected(reference.begin(), reference.end());
+    EXPECT_EQ(entries, expected);
+}
+
+void check_find_less_or_equal(const MapType& map, const ReferenceMapType& reference, const uint256_t& key)
+{
+    const auto* entry = map.find_less_or_equal(key);
+    auto it = reference.upper_bound(key);
+    if (it == reference.begin()) {
+        EXPECT_EQ(entry, nullptr);
+        return;
+    }
+    --it;
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->first, it->first);
+    EXPECT_EQ(entry->second, it->second);
+}
+
+TEST(SortedBlockMapTest, is_empty_when_created)
+{
+    MapType map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(1), nullptr);
+    EXPECT_EQ(map.find_less_or_equal(1), nullptr);
+    EXPECT_FALSE(map.erase(1));
+}
+
+TEST(SortedBlockMapTest, does_not_overwrite_existing_keys)
+{
+    MapType map;
+    EXPECT_TRUE(map.insert({ 10, 1 }));
+    EXPECT_FALSE(map.insert({ 10, 2 }));
+    EXPECT_EQ(map.find(10)->second, 1);
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST(SortedBlockMapTest, finds_the_entry_less_than_or_equal)
+{
+    MapType map;
+    for (uint64_t i = 1; i <= 20; i++) {
+        map.insert({ i * 10, i });
+    }
+    EXPECT_EQ(map.find_less_or_equal(5), nullptr);
+    EXPECT_EQ(map.find_less_or_equal(10)->second, 1);
+    EXPECT_EQ(map.find_less_or_equal(15)->second, 1);
+    EXPECT_EQ(map.find_less_or_equal(199)->second, 19);
+    EXPECT_EQ(map.find_less_or_equal(1000)->second, 20);
+    EXPECT_EQ(map.find(15), nullptr);
+    EXPECT_EQ(map.find(150)->second, 15);
+}
+
+TEST(SortedBlockMapTest, matches_an_ordered_map)
+{
+    MapType map;
+    ReferenceMapType reference;
+    // Keys are drawn from a small range so that inserts collide and erases hit
+    for (uint64_t i = 0; i < 20000; i++) {
+        uint256_t key = random_engine.get_random_uint64() % 500;
+        switch (random_engine.get_random_uint64() % 3) {
+        case 0:
+            EXPECT_EQ(map.insert({ key, i }), reference.insert({ key, i }).second);
+            break;
+        case 1:
+            EXPECT_EQ(map.erase(key), reference.erase(key) == 1);
+            break;
+        default:
+            check_find_less_or_equal(map, reference, key);
+            EXPECT_EQ(map.find(key) != nullptr, reference.contains(key));
+            break;
+        }
+    }
+    check_equal(map, reference);
+
+    MapType copy = map;
+    EXPECT_EQ(copy, map);
+    copy.erase(copy.begin()->first);
+    EXPECT_NE(copy, map);
+
+    map.clear();
+    check_equal(map, {});
+}
@@ -55,6 +55,17 @@ struct GetSiblingPathResponse {
     GetSiblingPathResponse& operator=(GetSiblingPathResponse&& other) noexcept = default;
 };
 
+struct GetSiblingPathsResponse {
+    std::vector<fr_sibling_path> paths;
+
+    GetSiblingPathsResponse() = default;
+    ~GetSiblingPathsResponse() = default;
+    GetSiblingPathsResponse(const GetSiblingPathsResponse& other) = default;
+    GetSiblingPathsResponse(GetSiblingPathsResponse&& other) noexcept = default;
+    GetSiblingPathsResponse& operator=(const GetSiblingPathsResponse& other) = default;
+    GetSiblingPathsResponse& operator=(GetSiblingPathsResponse&& other) noexcept = default;
+};
+
 template <typename LeafType> struct LeafUpdateWitnessData {
     IndexedLeaf<LeafType> leaf;
     index_t index;
@@ -73,6 +73,9 @@ struct TreeDBStats {
     DBStats leafPreimagesDBStats;
     DBStats leafIndicesDBStats;
     DBStats blockIndicesDBStats;
+    // Reads of the nodes DB served by, and missing, the process-wide node cache
+    uint64_t nodeCacheHits = 0;
+    uint64_t nodeCacheMisses = 0;
 
     TreeDBStats() = default;
     TreeDBStats(uint64_t mapSize, uint64_t physicalFileSize)
@@ -105,14 +108,17 @@ struct TreeDBStats {
                    nodesDBStats,
                    leafPreimagesDBStats,
                    leafIndicesDBStats,
-                   blockIndicesDBStats)
+                   blockIndicesDBStats,
+                   nodeCacheHits,
+                   nodeCacheMisses)
 
     bool operator==(const TreeDBStats& other) const
     {
         return mapSize == other.mapSize && physicalFileSize == other.physicalFileSize &&
                blocksDBStats == other.blocksDBStats && nodesDBStats == other.nodesDBStats &&
                leafPreimagesDBStats == other.leafPreimagesDBStats && leafIndicesDBStats == other.leafIndicesDBStats &&
-               blockIndicesDBStats == other.blockIndicesDBStats;
+               blockIndicesDBStats == other.blockIndicesDBStats && nodeCacheHits == other.nodeCacheHits &&
+               nodeCacheMisses == other.nodeCacheMisses;
     }
 
     TreeDBStats& operator=(TreeDBStats&& other) noexcept
@@ -125,6 +131,8 @@ struct TreeDBStats {
             leafPreimagesDBStats = std::move(other.leafPreimagesDBStats);
             leafIndicesDBStats = std::move(other.leafIndicesDBStats);
             blockIndicesDBStats = std::move(other.blockIndicesDBStats);
+            nodeCacheHits = other.nodeCacheHits;
+            nodeCacheMisses = other.nodeCacheMisses;
         }
         return *this;
     }
@@ -136,7 +144,8 @@ struct TreeDBStats {
         os << "Map Size: " << stats.mapSize << ", Physical File Size: " << stats.physicalFileSize << " Blocks DB "
            << stats.blocksDBStats << ", Nodes DB " << stats.nodesDBStats << ", Leaf Pre-images DB "
            << stats.leafPreimagesDBStats << ", Leaf Indices DB " << stats.leafIndicesDBStats << ", Block Indices DB "
-           << stats.blockIndicesDBStats;
+           << stats.blockIndicesDBStats << ", Node Cache Hits " << stats.nodeCacheHits << ", Node Cache Misses "
+           << stats.nodeCacheMisses;
         return os;
     }
 };
@@ -6,6 +6,9 @@
 
 #include "poseidon2.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace bb::crypto {
 /**
  * @brief Hashes a vector of field elements
@@ -16,6 +19,38 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_internal(input);
 }
 
+/**
+ * @brief Hashes each pair of elements (inputs[2i], inputs[2i + 1]) into outputs[i]
+ * @details Each pair is hashed as the sponge would: the pair is absorbed into the rate of a state whose capacity holds
+ * the IV for an input of length 2, and the first element of the permuted state is squeezed out. The states are built
+ * and permuted in chunks, reading the inputs of a chunk before writing its outputs, so the outputs may alias the
+ * first half of the inputs.
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const typename Poseidon2<Params>::FF> inputs,
+                                   std::span<typename Poseidon2<Params>::FF> outputs)
+{
+    using Permutation = Poseidon2Permutation<Params>;
+    constexpr size_t CHUNK_SIZE = 16 * Permutation::BATCH_LANES;
+    const FF iv = static_cast<uint256_t>(2) << 64;
+
+    std::array<typename Permutation::State, CHUNK_SIZE> states;
+    for (size_t start = 0; start < outputs.size(); start += CHUNK_SIZE) {
+        const size_t count = std::min(CHUNK_SIZE, outputs.size() - start);
+        for (size_t i = 0; i < count; ++i) {
+            auto& state = states[i];
+            state.fill(FF::zero());
+            state[0] = inputs[2 * (start + i)];
+            state[1] = inputs[2 * (start + i) + 1];
+            state[Params::t - 1] = iv;
+        }
+        Permutation::permutation_batch(std::span(states.data(), count));
+        for (size_t i = 0; i < count; ++i) {
+            outputs[start + i] = states[i][0];
+        }
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
@@ -10,6 +10,9 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+#include <vector>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -23,6 +26,11 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes each pair of elements (inputs[2i], inputs[2i + 1]) into outputs[i], permuting several pairs at a
+     * time. The outputs may alias the first half of the inputs.
+     */
+    static void hash_pairs(std::span<const FF> inputs, std::span<FF> outputs);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
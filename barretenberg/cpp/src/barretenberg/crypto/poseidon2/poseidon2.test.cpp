@@ -46,6 +46,31 @@ TEST(Poseidon2, HashConsistencyCheck)
     EXPECT_EQ(result, expected);
 }
 
+TEST(Poseidon2, HashPairsMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // More pairs than are permuted in one chunk, and not a multiple of the batch size
+    constexpr size_t num_pairs = 203;
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+    std::vector<fr> expected(num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        expected[i] = Poseidon2::hash({ inputs[2 * i], inputs[2 * i + 1] });
+    }
+
+    std::vector<fr> outputs(num_pairs);
+    Poseidon2::hash_pairs(inputs, outputs);
+    EXPECT_EQ(outputs, expected);
+
+    // Hashing in place, as when hashing the levels of a tree
+    Poseidon2::hash_pairs(inputs, std::span(inputs.data(), num_pairs));
+    inputs.resize(num_pairs);
+    EXPECT_EQ(inputs, expected);
+}
+
 TEST(Poseidon2, HashBufferConsistencyCheck)
 {
     // 31 byte inputs because hash_buffer slicing is only injective with 31 bytes, as it slices 31 bytes for each field
@@ -13,6 +13,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::crypto {
 
@@ -166,5 +167,67 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    // The number of independent states permutation_batch interleaves
+    static constexpr size_t BATCH_LANES = 4;
+
+    /**
+     * @brief Applies the permutation to each of the given states in place
+     * @details The states are permuted BATCH_LANES at a time, with every step of a round applied to each state before
+     * the next step. Most rounds are partial rounds, whose single s-box is a chain of dependent multiplications;
+     * running the chains of independent states side by side lets them overlap in the pipeline rather than stall on
+     * their own results. The remaining states are permuted one at a time.
+     */
+    static void permutation_batch(std::span<State> states)
+    {
+        size_t i = 0;
+        for (; i + BATCH_LANES <= states.size(); i += BATCH_LANES) {
+            permutation_lanes<BATCH_LANES>(&states[i]);
+        }
+        for (; i < states.size(); ++i) {
+            states[i] = permutation(states[i]);
+        }
+    }
+
+  private:
+    template <size_t lanes> static void permutation_lanes(State* states)
+    {
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            matrix_multiplication_external(states[lane]);
+        }
+
+        const auto external_round = [&](size_t round) {
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                add_round_constants(states[lane], round_constants[round]);
+                apply_sbox(states[lane]);
+                matrix_multiplication_external(states[lane]);
+            }
+        };
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            external_round(i);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            std::array<FF, lanes> powers;
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                states[lane][0] += round_constants[i][0];
+                powers[lane] = states[lane][0].sqr();
+            }
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                powers[lane] = powers[lane].sqr();
+            }
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                states[lane][0] *= powers[lane];
+                matrix_multiplication_internal(states[lane]);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            external_round(i);
+        }
+    }
 };
 } // namespace bb::crypto
@@ -59,3 +59,23 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, BatchMatchesSinglePermutations)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Enough states to fill several batches and leave a remainder
+    std::vector<Permutation::State> states(3 * Permutation::BATCH_LANES + 1);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    std::vector<Permutation::State> expected;
+    for (const auto& state : states) {
+        expected.push_back(Permutation::permutation(state));
+    }
+
+    Permutation::permutation_batch(states);
+    EXPECT_EQ(states, expected);
+}
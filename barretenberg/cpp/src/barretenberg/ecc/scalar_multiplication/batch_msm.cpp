@@ -0,0 +1,196 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "./batch_msm.hpp"
+#include "./runtime_states.hpp"
+
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <algorithm>
+
+namespace bb::scalar_multiplication {
+
+std::vector<std::vector<MSMWorkUnit>> get_batch_msm_work_units(std::span<const size_t> msm_sizes, size_t num_threads)
+{
+    size_t total_num_scalars = 0;
+    for (const size_t size : msm_sizes) {
+        total_num_scalars += size;
+    }
+    num_threads = std::max(num_threads, 1UL);
+    // round up so that the last thread never receives more than the others
+    const size_t scalars_per_thread = (total_num_scalars + num_threads - 1) / num_threads;
+
+    std::vector<std::vector<MSMWorkUnit>> work_units(num_threads);
+    size_t thread_idx = 0;
+    size_t thread_capacity = scalars_per_thread;
+    for (size_t msm_idx = 0; msm_idx < msm_sizes.size(); ++msm_idx) {
+        size_t start = 0;
+        while (start < msm_sizes[msm_idx]) {
+            if (thread_capacity == 0) {
+                ++thread_idx;
+                thread_capacity = scalars_per_thread;
+            }
+            const size_t end = std::min(msm_sizes[msm_idx], start + thread_capacity);
+            work_units[thread_idx].push_back({ msm_idx, start, end });
+            thread_capacity -= end - start;
+            start = end;
+        }
+    }
+    return work_units;
+}
+
+template <typename Curve>
+typename Curve::Element signed_window_msm_single_thread(std::span<const std::array<uint64_t, 2>> scalars,
+                                                        const typename Curve::AffineElement* points,
+                                                        const size_t scalar_bits,
+                                                        const size_t window_bits)
+{
+    using Element = typename Curve::Element;
+
+    Element result;
+    result.self_set_infinity();
+    if (scalars.empty()) {
+        return result;
+    }
+
+    // The signed windows must cover bit scalar_bits, so that the top digit absorbs the final carry
+    const size_t num_buckets = 1UL << (window_bits - 1);
+    const size_t num_rounds = (scalar_bits + window_bits) / window_bits;
+    std::vector<Element> buckets(num_buckets);
+
+    for (size_t round = num_rounds - 1; round < num_rounds; --round) {
+        for (size_t i = 0; (i < window_bits) && (round != num_rounds - 1); ++i) {
+            result.self_dbl();
+        }
+        for (auto& bucket : buckets) {
+            bucket.self_set_infinity();
+        }
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            const int64_t digit = get_signed_window_digit(scalars[i], round * window_bits, window_bits);
+            if (digit > 0) {
+                buckets[static_cast<size_t>(digit - 1)] += points[i];
+            } else if (digit < 0) {
+                buckets[static_cast<size_t>(-digit - 1)] -= points[i];
+            }
+        }
+
+        // ∑ⱼ (j + 1)⋅bucket[j] via a running sum
+        Element running_sum;
+        running_sum.self_set_infinity();
+        Element round_sum;
+        round_sum.self_set_infinity();
+        for (size_t j = num_buckets - 1; j < num_buckets; --j) {
+            running_sum += buckets[j];
+            round_sum += running_sum;
+        }
+        result += round_sum;
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element msm_single_thread(std::span<const typename Curve::ScalarField> scalars,
+                                          const typename Curve::AffineElement* point_table)
+{
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_scalars = scalars.size();
+
+    // Entry 2i multiplies point_table[2i] and entry 2i + 1 multiplies its endomorphism image point_table[2i + 1]
+    std::vector<std::array<uint64_t, 2>> split_scalars(2 * num_scalars);
+    for (size_t i = 0; i < num_scalars; ++i) {
+        const Fr scalar = scalars[i].from_montgomery_form();
+        Fr k1;
+        Fr k2;
+        Fr::split_into_endomorphism_scalars(scalar, k1, k2);
+        split_scalars[2 * i] = { k1.data[0], k1.data[1] };
+        split_scalars[2 * i + 1] = { k2.data[0], k2.data[1] };
+    }
+
+    // The bucket array is private to the calling thread, so we cap its size to keep it cache-resident
+    const size_t window_bits = std::min(get_optimal_bucket_width(num_scalars) + 1, MAX_SIGNED_WINDOW_BITS);
+    return signed_window_msm_single_thread<Curve>(split_scalars, point_table, ENDOMORPHISM_SCALAR_BITS, window_bits);
+}
+
+template <typename Curve>
+std::vector<typename Curve::AffineElement> batch_multi_scalar_mul(
+    std::span<const std::span<const typename Curve::AffineElement>> point_tables,
+    std::span<const PolynomialSpan<const typename Curve::ScalarField>> scalars)
+{
+    PROFILE_THIS();
+    using Element = typename Curve::Element;
+
+    const size_t num_msms = scalars.size();
+    BB_ASSERT_EQ(point_tables.size(), num_msms);
+
+    std::vector<size_t> msm_sizes;
+    msm_sizes.reserve(num_msms);
+    size_t total_num_scalars = 0;
+    for (size_t i = 0; i < num_msms; ++i) {
+        BB_ASSERT_LTE(scalars[i].end_index() * 2, point_tables[i].size(), "Point table too small for MSM.");
+        msm_sizes.emplace_back(scalars[i].size());
+        total_num_scalars += scalars[i].size();
+    }
+
+    // A thread should have enough scalars to amortise the bucket accumulation of its partial MSMs
+    constexpr size_t MIN_SCALARS_PER_THREAD = 1 << 7;
+    const size_t num_threads = calculate_num_threads(total_num_scalars, MIN_SCALARS_PER_THREAD);
+    const auto work_units = get_batch_msm_work_units(msm_sizes, num_threads);
+
+    std::vector<std::vector<Element>> thread_results(work_units.size());
+    parallel_for(work_units.size(), [&](size_t thread_idx) {
+        thread_results[thread_idx].reserve(work_units[thread_idx].size());
+        for (const auto& unit : work_units[thread_idx]) {
+            const auto& msm_scalars = scalars[unit.msm_index];
+            const auto* point_table = &point_tables[unit.msm_index][2 * (msm_scalars.start_index + unit.start)];
+            thread_results[thread_idx].emplace_back(
+                msm_single_thread<Curve>(msm_scalars.span.subspan(unit.start, unit.end - unit.start), point_table));
+        }
+    });
+
+    // Combine the partial results of MSMs that were split across threads
+    std::vector<Element> results(num_msms);
+    for (auto& result : results) {
+        result.self_set_infinity();
+    }
+    for (size_t thread_idx = 0; thread_idx < work_units.size(); ++thread_idx) {
+        for (size_t i = 0; i < work_units[thread_idx].size(); ++i) {
+            results[work_units[thread_idx][i].msm_index] += thread_results[thread_idx][i];
+        }
+    }
+
+    std::vector<typename Curve::AffineElement> affine_results;
+    affine_results.reserve(num_msms);
+    for (const auto& result : results) {
+        affine_results.emplace_back(result);
+    }
+    return affine_results;
+}
+
+template curve::BN254::Element signed_window_msm_single_thread<curve::BN254>(
+    std::span<const std::array<uint64_t, 2>> scalars,
+    const curve::BN254::AffineElement* points,
+    size_t scalar_bits,
+    size_t window_bits);
+template curve::BN254::Element msm_single_thread<curve::BN254>(std::span<const curve::BN254::ScalarField> scalars,
+                                                               const curve::BN254::AffineElement* point_table);
+template std::vector<curve::BN254::AffineElement> batch_multi_scalar_mul<curve::BN254>(
+    std::span<const std::span<const curve::BN254::AffineElement>> point_tables,
+    std::span<const PolynomialSpan<const curve::BN254::ScalarField>> scalars);
+
+template curve::Grumpkin::Element signed_window_msm_single_thread<curve::Grumpkin>(
+    std::span<const std::array<uint64_t, 2>> scalars,
+    const curve::Grumpkin::AffineElement* points,
+    size_t scalar_bits,
+    size_t window_bits);
+template curve::Grumpkin::Element msm_single_thread<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField> scalars, const curve::Grumpkin::AffineElement* point_table);
+template std::vector<curve::Grumpkin::AffineElement> batch_multi_scalar_mul<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::AffineElement>> point_tables,
+    std::span<const PolynomialSpan<const curve::Grumpkin::ScalarField>> scalars);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,122 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+// Upper bound on the bit length of the scalars produced by Fr::split_into_endomorphism_scalars
+constexpr size_t ENDOMORPHISM_SCALAR_BITS = 128;
+// Largest window used by the single-threaded bucket method (2^15 projective buckets, ~3MB)
+constexpr size_t MAX_SIGNED_WINDOW_BITS = 16;
+
+/**
+ * @brief A contiguous range [start, end) of the scalars of a single MSM within a batch
+ * @details Work units are the granularity at which the MSMs of a batch are distributed across threads. A thread
+ * processes each of its work units with a single-threaded bucket method, so no synchronisation is needed between the
+ * threads until the partial results are summed.
+ */
+struct MSMWorkUnit {
+    size_t msm_index;
+    size_t start;
+    size_t end;
+};
+
+/**
+ * @brief Distribute the scalars of a batch of MSMs evenly over the given number of threads
+ * @details The MSMs are laid out end to end and cut into num_threads contiguous slices of (roughly) equal size. An MSM
+ * may therefore be split across several threads, and a thread may receive pieces of several MSMs.
+ *
+ * @param msm_sizes The number of scalars in each MSM of the batch
+ * @param num_threads
+ * @return std::vector<std::vector<MSMWorkUnit>> The work units to be processed by each thread
+ */
+std::vector<std::vector<MSMWorkUnit>> get_batch_msm_work_units(std::span<const size_t> msm_sizes, size_t num_threads);
+
+/**
+ * @brief Extract the signed (Booth-recoded) digit of width `bits` at `bit_offset` from a 128-bit endomorphism scalar
+ * @details The digit is read from bits [bit_offset - 1, bit_offset + bits) of the scalar, where bit -1 is taken to be
+ * zero. The resulting digits lie in [-2^{bits-1}, 2^{bits-1}] and satisfy k = ∑ᵢ dᵢ⋅2^{bits⋅i} as long as the top
+ * digit covers bit ENDOMORPHISM_SCALAR_BITS. Unlike the WNAF used by pippenger, each digit is independent of the others,
+ * so no carry has to be stored between rounds.
+ */
+inline int64_t get_signed_window_digit(const std::array<uint64_t, 2>& scalar, size_t bit_offset, size_t bits)
+{
+    // read num_bits (< 64) bits starting at `offset`, treating bits beyond the top of the scalar as zero
+    const auto get_bits = [&scalar](size_t offset, size_t num_bits) -> uint64_t {
+        if (offset >= ENDOMORPHISM_SCALAR_BITS) {
+            return 0;
+        }
+        const size_t limb = offset >> 6;
+        const size_t shift = offset & 63;
+        uint64_t result = scalar[limb] >> shift;
+        if (shift != 0 && limb == 0) {
+            result |= scalar[1] << (64 - shift);
+        }
+        return result & ((1ULL << num_bits) - 1);
+    };
+    const uint64_t raw = (bit_offset == 0) ? get_bits(0, bits) << 1 : get_bits(bit_offset - 1, bits + 1);
+    return static_cast<int64_t>((raw >> 1) + (raw & 1)) - static_cast<int64_t>((raw >> bits) << bits);
+}
+
+/**
+ * @brief Compute ∑ᵢ kᵢ⋅Pᵢ on the calling thread for scalars kᵢ of at most scalar_bits bits
+ * @details Buckets are accumulated in projective coordinates with mixed additions, one round per signed window of
+ * window_bits bits (2^{window_bits-1} buckets).
+ *
+ * @param scalars Scalars in non-Montgomery form, as two little-endian 64-bit limbs
+ * @param points points[i] is multiplied by scalars[i]
+ * @param scalar_bits Upper bound on the bit length of the scalars
+ * @param window_bits
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element signed_window_msm_single_thread(std::span<const std::array<uint64_t, 2>> scalars,
+                                                        const typename Curve::AffineElement* points,
+                                                        size_t scalar_bits,
+                                                        size_t window_bits);
+
+/**
+ * @brief Compute ∑ᵢ sᵢ⋅Pᵢ on the calling thread using the bucket method over signed windows
+ * @details Each scalar is split via the curve endomorphism into two ~128-bit scalars, which multiply the raw point
+ * and its endomorphism image respectively, and the result is computed with signed_window_msm_single_thread. Mixed
+ * additions have no incomplete-addition edge cases, so the method may be used with arbitrary input points.
+ *
+ * @param scalars
+ * @param point_table Pippenger point table: point_table[2i] is Pᵢ and point_table[2i + 1] its endomorphism image
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element msm_single_thread(std::span<const typename Curve::ScalarField> scalars,
+                                          const typename Curve::AffineElement* point_table);
+
+/**
+ * @brief Compute a batch of MSMs inside a single parallel region
+ * @details Calling pippenger once per MSM incurs the full WNAF computation, bucket sort and thread fan-out/fan-in for
+ * every MSM. When a prover round commits to many small-to-medium polynomials this synchronisation dominates. Here the
+ * scalars of all MSMs are distributed evenly over the threads (see get_batch_msm_work_units) and every thread
+ * computes its partial MSMs independently, so all cores are kept busy for the duration of the batch.
+ *
+ * @param point_tables For each MSM, a pippenger point table indexed so that point_tables[i][2j] is the base point
+ * for the coefficient j of scalars[i]
+ * @param scalars For each MSM, the scalars to be multiplied (entries outside of the span are implicitly zero)
+ * @return std::vector<Curve::AffineElement> The result of each MSM
+ */
+template <typename Curve>
+std::vector<typename Curve::AffineElement> batch_multi_scalar_mul(
+    std::span<const std::span<const typename Curve::AffineElement>> point_tables,
+    std::span<const PolynomialSpan<const typename Curve::ScalarField>> scalars);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,178 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "./classified_msm.hpp"
+#include "./batch_msm.hpp"
+#include "./scalar_multiplication.hpp"
+
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+template <typename Curve>
+typename Curve::Element small_scalar_msm(std::span<const uint64_t> scalars,
+                                         std::span<const typename Curve::AffineElement> points)
+{
+    PROFILE_THIS();
+    using Element = typename Curve::Element;
+
+    BB_ASSERT_EQ(scalars.size(), points.size());
+    constexpr size_t MIN_SMALL_SCALARS_PER_THREAD = 1 << 8;
+    const size_t num_scalars = scalars.size();
+    const size_t num_threads = calculate_num_threads(num_scalars, MIN_SMALL_SCALARS_PER_THREAD);
+    const size_t scalars_per_thread = (num_scalars + num_threads - 1) / num_threads;
+
+    std::vector<Element> thread_results(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(num_scalars, thread_idx * scalars_per_thread);
+        const size_t end = std::min(num_scalars, start + scalars_per_thread);
+        std::vector<std::array<uint64_t, 2>> thread_scalars;
+        thread_scalars.reserve(end - start);
+        for (size_t i = start; i < end; ++i) {
+            thread_scalars.push_back({ scalars[i], 0 });
+        }
+        const size_t window_bits = std::min(get_optimal_bucket_width(end - start) + 1, MAX_SIGNED_WINDOW_BITS);
+        thread_results[thread_idx] = signed_window_msm_single_thread<Curve>(
+            thread_scalars, points.data() + start, SMALL_SCALAR_BITS, window_bits);
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (const auto& thread_result : thread_results) {
+        result += thread_result;
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_with_scalar_classification(
+    PolynomialSpan<const typename Curve::ScalarField> scalars,
+    std::span<const typename Curve::AffineElement> points,
+    pippenger_runtime_state<Curve>& state)
+{
+    PROFILE_THIS();
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // Percentage of full-width scalars beyond which we hand the whole MSM to pippenger
+    constexpr size_t FULL_SCALAR_THRESHOLD = 75;
+
+    const size_t num_scalars = scalars.size();
+    BB_ASSERT_LTE(2 * scalars.end_index(), points.size());
+    const AffineElement* point_table = &points[2 * scalars.start_index];
+
+    // Classify the scalars in a single pass, recording the indices of each class per thread
+    struct ThreadClassification {
+        std::vector<size_t> one_indices;
+        std::vector<size_t> small_indices;
+        std::vector<uint64_t> small_values;
+        std::vector<size_t> full_indices;
+    };
+    const size_t num_threads = calculate_num_threads(num_scalars);
+    const size_t scalars_per_thread = (num_scalars + num_threads - 1) / num_threads;
+    std::vector<ThreadClassification> classifications(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        auto& classification = classifications[thread_idx];
+        const size_t start = std::min(num_scalars, thread_idx * scalars_per_thread);
+        const size_t end = std::min(num_scalars, start + scalars_per_thread);
+        for (size_t i = start; i < end; ++i) {
+            if (scalars.span[i].is_zero()) {
+                continue;
+            }
+            const Fr value = scalars.span[i].from_montgomery_form();
+            const bool is_small =
+                (value.data[1] | value.data[2] | value.data[3]) == 0 && value.data[0] < (1ULL << SMALL_SCALAR_BITS);
+            if (!is_small) {
+                classification.full_indices.emplace_back(i);
+            } else if (value.data[0] == 1) {
+                classification.one_indices.emplace_back(i);
+            } else {
+                classification.small_indices.emplace_back(i);
+                classification.small_values.emplace_back(value.data[0]);
+            }
+        }
+    });
+
+    // Compute the offset of each thread's contribution to the gathered inputs of each class
+    std::vector<size_t> one_offsets(num_threads + 1, 0);
+    std::vector<size_t> small_offsets(num_threads + 1, 0);
+    std::vector<size_t> full_offsets(num_threads + 1, 0);
+    for (size_t i = 0; i < num_threads; ++i) {
+        one_offsets[i + 1] = one_offsets[i] + classifications[i].one_indices.size();
+        small_offsets[i + 1] = small_offsets[i] + classifications[i].small_indices.size();
+        full_offsets[i + 1] = full_offsets[i] + classifications[i].full_indices.size();
+    }
+    const size_t num_ones = one_offsets[num_threads];
+    const size_t num_small = small_offsets[num_threads];
+    const size_t num_full = full_offsets[num_threads];
+
+    if (num_full * 100 > FULL_SCALAR_THRESHOLD * num_scalars) {
+        return pippenger_unsafe<Curve>(scalars, points, state);
+    }
+
+    // Gather the inputs of each class into contiguous memory
+    std::vector<AffineElement> one_points(num_ones);
+    std::vector<uint64_t> small_scalars(num_small);
+    std::vector<AffineElement> small_points(num_small);
+    std::vector<Fr> full_scalars(num_full);
+    std::vector<AffineElement> full_points(2 * num_full);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const auto& classification = classifications[thread_idx];
+        for (size_t j = 0; j < classification.one_indices.size(); ++j) {
+            one_points[one_offsets[thread_idx] + j] = point_table[2 * classification.one_indices[j]];
+        }
+        for (size_t j = 0; j < classification.small_indices.size(); ++j) {
+            small_scalars[small_offsets[thread_idx] + j] = classification.small_values[j];
+            small_points[small_offsets[thread_idx] + j] = point_table[2 * classification.small_indices[j]];
+        }
+        for (size_t j = 0; j < classification.full_indices.size(); ++j) {
+            const size_t idx = classification.full_indices[j];
+            const size_t offset = full_offsets[thread_idx] + j;
+            full_scalars[offset] = scalars.span[idx];
+            // Save both the raw srs point and the precomputed endomorphism point from the point table
+            full_points[2 * offset] = point_table[2 * idx];
+            full_points[2 * offset + 1] = point_table[2 * idx + 1];
+        }
+    });
+
+    Element result;
+    result.self_set_infinity();
+    if (num_ones == 1) {
+        result += one_points[0];
+    } else if (num_ones > 1) {
+        result += BatchedAffineAddition<Curve>::add_in_place(one_points, { num_ones })[0];
+    }
+    if (num_small > 0) {
+        result += small_scalar_msm<Curve>(small_scalars, small_points);
+    }
+    if (num_full > 0) {
+        result += pippenger_unsafe<Curve>({ 0, full_scalars }, full_points, state);
+    }
+    return result;
+}
+
+template curve::BN254::Element small_scalar_msm<curve::BN254>(std::span<const uint64_t> scalars,
+                                                              std::span<const curve::BN254::AffineElement> points);
+template curve::BN254::Element pippenger_unsafe_with_scalar_classification<curve::BN254>(
+    PolynomialSpan<const curve::BN254::ScalarField> scalars,
+    std::span<const curve::BN254::AffineElement> points,
+    pippenger_runtime_state<curve::BN254>& state);
+
+template curve::Grumpkin::Element small_scalar_msm<curve::Grumpkin>(
+    std::span<const uint64_t> scalars, std::span<const curve::Grumpkin::AffineElement> points);
+template curve::Grumpkin::Element pippenger_unsafe_with_scalar_classification<curve::Grumpkin>(
+    PolynomialSpan<const curve::Grumpkin::ScalarField> scalars,
+    std::span<const curve::Grumpkin::AffineElement> points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+} // namespace bb::scalar_multiplication
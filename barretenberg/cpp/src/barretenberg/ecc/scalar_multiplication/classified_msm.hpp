@@ -0,0 +1,52 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "./runtime_states.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace bb::scalar_multiplication {
+
+// Scalars below 2^SMALL_SCALAR_BITS are handled by small_scalar_msm rather than the full-width pippenger
+constexpr size_t SMALL_SCALAR_BITS = 16;
+
+/**
+ * @brief Compute ∑ᵢ kᵢ⋅Pᵢ for scalars kᵢ < 2^SMALL_SCALAR_BITS (given in non-Montgomery form)
+ * @details The points are split evenly across threads, and each thread runs the signed-window bucket method over
+ * SMALL_SCALAR_BITS bits only, i.e. one or two rounds rather than the ~10 rounds needed for a 254-bit scalar.
+ */
+template <typename Curve>
+typename Curve::Element small_scalar_msm(std::span<const uint64_t> scalars,
+                                         std::span<const typename Curve::AffineElement> points);
+
+/**
+ * @brief MSM for polynomials dominated by zero, one and small coefficients (selectors, lookup read counts and tags)
+ * @details In a single pass, each scalar is classified as zero, one, small (< 2^SMALL_SCALAR_BITS) or full, and the
+ * indices of each class are recorded. Zeros are skipped, points with a unit scalar are simply summed with batched
+ * affine additions, small scalars go to small_scalar_msm, and only the full scalars are handed to pippenger. If most
+ * scalars are full, the classification is discarded and the whole MSM is handed to pippenger instead, to avoid the
+ * copy of the inputs.
+ *
+ * Like pippenger_unsafe, this assumes the points are linearly independent (e.g. SRS points).
+ *
+ * @param scalars
+ * @param points Pippenger point table, indexed so that points[2j] is the base point for coefficient j
+ * @param state
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_with_scalar_classification(
+    PolynomialSpan<const typename Curve::ScalarField> scalars,
+    std::span<const typename Curve::AffineElement> points,
+    pippenger_runtime_state<Curve>& state);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,151 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "./fixed_base_msm.hpp"
+#include "./owned_buckets_pippenger.hpp"
+
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <array>
+#include <limits>
+
+namespace bb::scalar_multiplication {
+
+template <typename Curve>
+FixedBaseTable<Curve> compute_fixed_base_table(std::span<const typename Curve::AffineElement> point_table,
+                                               const size_t num_points,
+                                               const size_t window_bits,
+                                               const size_t depth)
+{
+    PROFILE_THIS();
+    using Element = typename Curve::Element;
+    using Fq = typename Curve::BaseField;
+
+    BB_ASSERT_LTE(2 * num_points, point_table.size());
+    // Bucket indices are stored in 31 bits of a schedule entry
+    BB_ASSERT_LT(window_bits, 32UL);
+    // Schedule entries address the points of a pass with 32 bits
+    BB_ASSERT_LTE(2 * num_points * depth, static_cast<size_t>(std::numeric_limits<uint32_t>::max()));
+
+    FixedBaseTable<Curve> table;
+    table.num_points = num_points;
+    table.window_bits = window_bits;
+    table.depth = depth;
+    table.points.resize(2 * num_points * depth);
+    if (depth == 0 || num_points == 0) {
+        return table;
+    }
+    std::copy_n(point_table.begin(), 2 * num_points, table.points.begin());
+
+    const Fq beta = Fq::cube_root_of_unity();
+    const size_t num_threads = calculate_num_threads(num_points);
+    const size_t points_per_thread = (num_points + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(num_points, thread_idx * points_per_thread);
+        const size_t end = std::min(num_points, start + points_per_thread);
+        std::vector<Element> shifted_points(end - start);
+        for (size_t j = start; j < end; ++j) {
+            shifted_points[j - start] = Element(point_table[2 * j]);
+        }
+        for (size_t row = 1; row < depth; ++row) {
+            for (auto& point : shifted_points) {
+                for (size_t i = 0; i < window_bits; ++i) {
+                    point.self_dbl();
+                }
+            }
+            Element::batch_normalize(shifted_points.data(), shifted_points.size());
+            auto* row_points = &table.points[row * 2 * num_points];
+            for (size_t j = start; j < end; ++j) {
+                const auto& point = shifted_points[j - start];
+                row_points[2 * j] = { point.x, point.y };
+                row_points[2 * j + 1] = { beta * point.x, -point.y };
+            }
+        }
+    });
+    return table;
+}
+
+template <typename Curve>
+typename Curve::Element fixed_base_msm(const FixedBaseTable<Curve>& table,
+                                       PolynomialSpan<const typename Curve::ScalarField> scalars)
+{
+    PROFILE_THIS();
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    BB_ASSERT_LTE(scalars.end_index(), table.num_points, "Fixed-base table too small for MSM.");
+    BB_ASSERT_GT(table.depth, 0UL);
+
+    Element result;
+    result.self_set_infinity();
+    const size_t num_scalars = scalars.size();
+    if (num_scalars == 0) {
+        return result;
+    }
+    const size_t num_split_scalars = 2 * num_scalars;
+
+    // Entry 2i multiplies the point at index 2(start_index + i) of a row and entry 2i + 1 its endomorphism image
+    std::vector<std::array<uint64_t, 2>> split_scalars(num_split_scalars);
+    parallel_for_heuristic(
+        num_scalars,
+        [&](size_t i) {
+            const Fr scalar = scalars.span[i].from_montgomery_form();
+            Fr k1;
+            Fr k2;
+            Fr::split_into_endomorphism_scalars(scalar, k1, k2);
+            split_scalars[2 * i] = { k1.data[0], k1.data[1] };
+            split_scalars[2 * i + 1] = { k2.data[0], k2.data[1] };
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST * 4);
+
+    const size_t bits = table.window_bits;
+    const size_t num_windows = get_fixed_base_num_windows(bits);
+    const size_t num_passes = (num_windows + table.depth - 1) / table.depth;
+    const size_t row_size = 2 * table.num_points;
+    const size_t point_offset = 2 * scalars.start_index;
+    OwnedBucketAccumulator<Curve> accumulator(1UL << (bits - 1), /*handle_edge_cases=*/false);
+    const size_t num_threads = accumulator.get_num_threads();
+    const size_t points_per_thread = (num_split_scalars + num_threads - 1) / num_threads;
+
+    // result = ∑ₚ 2^{bits⋅depth⋅p}⋅(pass sum p), where pass p covers the windows [p⋅depth, (p + 1)⋅depth)
+    for (size_t pass = num_passes - 1; pass < num_passes; --pass) {
+        for (size_t i = 0; (i < bits * table.depth) && (pass != num_passes - 1); ++i) {
+            result.self_dbl();
+        }
+        const size_t first_window = pass * table.depth;
+        const size_t end_window = std::min(num_windows, first_window + table.depth);
+        result += accumulator.accumulate(table.points.data(), [&](size_t producer, auto& schedules) {
+            const size_t start = std::min(num_split_scalars, producer * points_per_thread);
+            const size_t end = std::min(num_split_scalars, start + points_per_thread);
+            for (size_t window = first_window; window < end_window; ++window) {
+                const size_t row_offset = (window - first_window) * row_size + point_offset;
+                for (size_t i = start; i < end; ++i) {
+                    const int64_t digit = get_signed_window_digit(split_scalars[i], window * bits, bits);
+                    if (digit == 0) {
+                        continue;
+                    }
+                    const size_t bucket = static_cast<size_t>(digit > 0 ? digit : -digit) - 1;
+                    schedules[accumulator.get_owner(bucket)].push_back(
+                        make_owned_bucket_entry(row_offset + i, digit < 0, bucket));
+                }
+            }
+        });
+    }
+    return result;
+}
+
+template FixedBaseTable<curve::BN254> compute_fixed_base_table<curve::BN254>(
+    std::span<const curve::BN254::AffineElement> point_table, size_t num_points, size_t window_bits, size_t depth);
+template curve::BN254::Element fixed_base_msm<curve::BN254>(const FixedBaseTable<curve::BN254>& table,
+                                                            PolynomialSpan<const curve::BN254::ScalarField> scalars);
+
+template FixedBaseTable<curve::Grumpkin> compute_fixed_base_table<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::AffineElement> point_table, size_t num_points, size_t window_bits, size_t depth);
+template curve::Grumpkin::Element fixed_base_msm<curve::Grumpkin>(
+    const FixedBaseTable<curve::Grumpkin>& table, PolynomialSpan<const curve::Grumpkin::ScalarField> scalars);
+
+} // namespace bb::scalar_multiplication
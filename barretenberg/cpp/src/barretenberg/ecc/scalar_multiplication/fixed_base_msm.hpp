@@ -0,0 +1,120 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "./batch_msm.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+// Window width of the fixed-base tables; the buckets are shared by all windows, so we can afford a wide window
+constexpr size_t FIXED_BASE_DEFAULT_WINDOW_BITS = 16;
+
+// Below this many scalars, setting up and reducing the 2^15 buckets of a fixed-base MSM costs more than the doublings
+// it saves, and pippenger is faster (pippenger_bench puts the crossover between 2^12 and 2^13 points)
+constexpr size_t FIXED_BASE_MIN_MSM_SIZE = 1UL << 13;
+
+/**
+ * @brief Parameters of the optional fixed-base precomputation of a prover CRS
+ * @details A table row holds 2 * num_points affine elements, and the table depth (number of rows) is the largest that
+ * fits in memory_budget bytes, up to the number of windows of an endomorphism scalar. A num_points of zero disables
+ * the precomputation.
+ */
+struct FixedBaseTableConfig {
+    size_t num_points = 0;
+    size_t window_bits = FIXED_BASE_DEFAULT_WINDOW_BITS;
+    size_t memory_budget = 0;
+};
+
+/**
+ * @brief Shifted copies of a prefix of the SRS points, for fixed-base MSMs
+ * @details Row w of the table is a pippenger point table of the points 2^{window_bits⋅w}⋅Gⱼ, i.e. row w holds
+ * 2^{window_bits⋅w}⋅Gⱼ at index 2j and its endomorphism image at index 2j + 1.
+ */
+template <typename Curve> struct FixedBaseTable {
+    using AffineElement = typename Curve::AffineElement;
+
+    size_t num_points = 0;
+    size_t window_bits = 0;
+    size_t depth = 0;
+    std::vector<AffineElement> points;
+
+    std::span<const AffineElement> get_row(size_t row) const
+    {
+        return { &points[row * 2 * num_points], 2 * num_points };
+    }
+
+    static size_t get_row_size(size_t num_points) { return 2 * num_points * sizeof(AffineElement); }
+};
+
+/**
+ * @brief The number of signed windows of width window_bits needed to cover an endomorphism scalar
+ */
+inline size_t get_fixed_base_num_windows(size_t window_bits)
+{
+    return (ENDOMORPHISM_SCALAR_BITS + window_bits) / window_bits;
+}
+
+/**
+ * @brief The depth of the largest fixed-base table over num_points points that fits in memory_budget bytes
+ * @details The depth never exceeds the number of windows, at which point an MSM needs no doublings at all. A depth of
+ * zero means that not even a single row fits in the budget.
+ */
+template <typename Curve>
+size_t get_fixed_base_table_depth(size_t num_points, size_t window_bits, size_t memory_budget)
+{
+    if (num_points == 0) {
+        return 0;
+    }
+    return std::min(get_fixed_base_num_windows(window_bits),
+                    memory_budget / FixedBaseTable<Curve>::get_row_size(num_points));
+}
+
+/**
+ * @brief Compute the fixed-base table of the first num_points points of a pippenger point table
+ * @details Row 0 is a copy of the point table, and row w + 1 is obtained from row w with window_bits doublings per
+ * point (batch normalised).
+ *
+ * @param point_table Pippenger point table: point_table[2j] is Gⱼ and point_table[2j + 1] its endomorphism image
+ * @param num_points
+ * @param window_bits
+ * @param depth
+ * @return FixedBaseTable<Curve>
+ */
+template <typename Curve>
+FixedBaseTable<Curve> compute_fixed_base_table(std::span<const typename Curve::AffineElement> point_table,
+                                               size_t num_points,
+                                               size_t window_bits,
+                                               size_t depth);
+
+/**
+ * @brief Compute ∑ᵢ kᵢ⋅Gᵢ against the precomputed fixed-base table
+ * @details The scalars are split via the endomorphism and recoded into signed windows of table.window_bits bits.
+ * Digit w of a scalar selects its point from row w of the table, so the contributions of all windows covered by the
+ * table go into the same set of buckets (see OwnedBucketAccumulator) and are reduced once, with no doublings in
+ * between. Pippenger instead needs one bucket reduction per window plus window_bits doublings between windows. If the
+ * table is shallower than the number of windows, the windows are processed in passes of table.depth windows, with
+ * window_bits⋅depth doublings between passes.
+ *
+ * Like pippenger_unsafe, this assumes the table points are linearly independent (e.g. SRS points).
+ *
+ * @param table
+ * @param scalars Must satisfy scalars.end_index() <= table.num_points
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element fixed_base_msm(const FixedBaseTable<Curve>& table,
+                                       PolynomialSpan<const typename Curve::ScalarField> scalars);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,243 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "./owned_buckets_pippenger.hpp"
+#include "./batch_msm.hpp"
+#include "./runtime_states.hpp"
+#include "./scalar_multiplication.hpp"
+
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+template <typename Curve>
+OwnedBucketAccumulator<Curve>::OwnedBucketAccumulator(const size_t num_buckets, const bool handle_edge_cases)
+    : num_buckets(num_buckets)
+    , num_threads(std::max(1UL, std::min(get_num_cpus(), num_buckets)))
+    , buckets_per_thread((num_buckets + num_threads - 1) / num_threads)
+    , handle_edge_cases(handle_edge_cases)
+    , schedules(num_threads, std::vector<std::vector<uint64_t>>(num_threads))
+    , buckets(num_buckets)
+    , thread_states(num_threads)
+{}
+
+template <typename Curve> void OwnedBucketAccumulator<Curve>::flush_addition_batch(ThreadState& state)
+{
+    if (state.batch_size == 0) {
+        return;
+    }
+    const size_t num_points = 2 * state.batch_size;
+    if (handle_edge_cases) {
+        add_affine_points_with_edge_cases<Curve>(state.addition_pairs.data(), num_points, state.scratch_space.data());
+    } else {
+        add_affine_points<Curve>(state.addition_pairs.data(), num_points, state.scratch_space.data());
+    }
+    // add_affine_points writes the sum of pair j to index (num_points / 2) + j
+    for (size_t j = 0; j < state.batch_size; ++j) {
+        const size_t bucket = state.addition_buckets[j];
+        buckets[bucket] = state.addition_pairs[state.batch_size + j];
+        state.bucket_in_batch[bucket - state.first_bucket] = 0;
+    }
+    state.batch_size = 0;
+}
+
+template <typename Curve>
+void OwnedBucketAccumulator<Curve>::accumulate_entry(ThreadState& state,
+                                                     const AffineElement* point_table,
+                                                     const uint64_t entry)
+{
+    const size_t bucket = entry & 0x7fffffffU;
+    const bool negate = ((entry >> 31) & 1U) != 0;
+    const auto& point = point_table[entry >> 32];
+    const size_t local_bucket = bucket - state.first_bucket;
+
+    if (state.bucket_occupied[local_bucket] == 0) {
+        buckets[bucket] = negate ? -point : point;
+        state.bucket_occupied[local_bucket] = 1;
+        return;
+    }
+    // The bucket is the output of an addition in the current batch; it must wait for the next batch
+    if (state.bucket_in_batch[local_bucket] != 0) {
+        state.deferred_entries.push_back(entry);
+        return;
+    }
+    state.addition_pairs[2 * state.batch_size] = buckets[bucket];
+    state.addition_pairs[2 * state.batch_size + 1] = negate ? -point : point;
+    state.addition_buckets[state.batch_size] = static_cast<uint32_t>(bucket);
+    state.bucket_in_batch[local_bucket] = 1;
+    if (++state.batch_size == OWNED_BUCKETS_ADDITION_BATCH_SIZE) {
+        flush_addition_batch(state);
+    }
+}
+
+/**
+ * @brief Compute ∑ⱼ (j + 1)⋅bucket[j] over the bucket range owned by a thread
+ */
+template <typename Curve> typename Curve::Element OwnedBucketAccumulator<Curve>::reduce(ThreadState& state)
+{
+    using Fr = typename Curve::ScalarField;
+
+    Element running_sum;
+    running_sum.self_set_infinity();
+    Element accumulator;
+    accumulator.self_set_infinity();
+    for (size_t bucket = state.end_bucket - 1; bucket + 1 > state.first_bucket; --bucket) {
+        if (state.bucket_occupied[bucket - state.first_bucket] != 0) {
+            running_sum += buckets[bucket];
+        }
+        accumulator += running_sum;
+    }
+    // The loop weights bucket j by (j - first_bucket + 1); add the missing first_bucket⋅bucket[j] terms
+    if (state.first_bucket > 0) {
+        accumulator += running_sum * Fr(static_cast<uint64_t>(state.first_bucket));
+    }
+    std::fill(state.bucket_occupied.begin(), state.bucket_occupied.end(), 0);
+    return accumulator;
+}
+
+template <typename Curve>
+typename Curve::Element OwnedBucketAccumulator<Curve>::accumulate(const AffineElement* point_table,
+                                                                   const ScheduleProducer& producer)
+{
+    // Bucketing phase: each thread distributes its share of the entries to the threads owning their buckets
+    parallel_for(num_threads, [&](size_t producer_idx) {
+        for (auto& schedule : schedules[producer_idx]) {
+            schedule.clear();
+        }
+        producer(producer_idx, schedules[producer_idx]);
+    });
+
+    // Accumulation phase: each thread adds the points addressed to it into the buckets it owns
+    std::vector<Element> thread_sums(num_threads);
+    parallel_for(num_threads, [&](size_t owner) {
+        auto& state = thread_states[owner];
+        if (state.addition_pairs.empty()) {
+            state.first_bucket = std::min(num_buckets, owner * buckets_per_thread);
+            state.end_bucket = std::min(num_buckets, (owner + 1) * buckets_per_thread);
+            state.bucket_occupied.assign(state.end_bucket - state.first_bucket, 0);
+            state.bucket_in_batch.assign(state.end_bucket - state.first_bucket, 0);
+            state.addition_pairs.resize(2 * OWNED_BUCKETS_ADDITION_BATCH_SIZE);
+            state.addition_buckets.resize(OWNED_BUCKETS_ADDITION_BATCH_SIZE);
+            state.scratch_space.resize(OWNED_BUCKETS_ADDITION_BATCH_SIZE);
+        }
+        thread_sums[owner].self_set_infinity();
+        if (state.first_bucket == state.end_bucket) {
+            return;
+        }
+        for (size_t producer_idx = 0; producer_idx < num_threads; ++producer_idx) {
+            for (const uint64_t entry : schedules[producer_idx][owner]) {
+                accumulate_entry(state, point_table, entry);
+            }
+        }
+        flush_addition_batch(state);
+        while (!state.deferred_entries.empty()) {
+            std::swap(state.deferred_entries, state.retry_entries);
+            state.deferred_entries.clear();
+            for (const uint64_t entry : state.retry_entries) {
+                accumulate_entry(state, point_table, entry);
+            }
+            flush_addition_batch(state);
+        }
+        thread_sums[owner] = reduce(state);
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (const auto& thread_sum : thread_sums) {
+        result += thread_sum;
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_owned_buckets(std::span<const typename Curve::AffineElement> points,
+                                                PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                                const size_t num_initial_points,
+                                                bool handle_edge_cases)
+{
+    PROFILE_THIS();
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    Element result;
+    result.self_set_infinity();
+    // Only the scalars below num_initial_points take part in this MSM
+    const size_t num_scalars =
+        scalars.start_index >= num_initial_points
+            ? 0
+            : std::min(scalars.size(), num_initial_points - scalars.start_index);
+    if (num_scalars == 0) {
+        return result;
+    }
+    BB_ASSERT_LTE(2 * (scalars.start_index + num_scalars), points.size());
+    const AffineElement* point_table = &points[2 * scalars.start_index];
+    const size_t num_split_scalars = 2 * num_scalars;
+
+    // Entry 2i multiplies point_table[2i] and entry 2i + 1 multiplies its endomorphism image point_table[2i + 1]
+    std::vector<std::array<uint64_t, 2>> split_scalars(num_split_scalars);
+    parallel_for_heuristic(
+        num_scalars,
+        [&](size_t i) {
+            const Fr scalar = scalars.span[i].from_montgomery_form();
+            Fr k1;
+            Fr k2;
+            Fr::split_into_endomorphism_scalars(scalar, k1, k2);
+            split_scalars[2 * i] = { k1.data[0], k1.data[1] };
+            split_scalars[2 * i + 1] = { k2.data[0], k2.data[1] };
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST * 4);
+
+    const size_t bits = get_optimal_bucket_width(num_scalars) + 1;
+    const size_t num_buckets = 1UL << (bits - 1);
+    const size_t num_rounds = (ENDOMORPHISM_SCALAR_BITS + bits) / bits;
+    OwnedBucketAccumulator<Curve> accumulator(num_buckets, handle_edge_cases);
+    const size_t num_threads = accumulator.get_num_threads();
+    const size_t points_per_thread = (num_split_scalars + num_threads - 1) / num_threads;
+
+    // result = ∑ᵣ 2^{bits⋅r}⋅(round sum r)
+    for (size_t round = num_rounds - 1; round < num_rounds; --round) {
+        for (size_t i = 0; (i < bits) && (round != num_rounds - 1); ++i) {
+            result.self_dbl();
+        }
+        // Each thread distributes its slice of the points to the threads owning their buckets
+        result += accumulator.accumulate(point_table, [&](size_t producer, auto& schedules) {
+            const size_t start = std::min(num_split_scalars, producer * points_per_thread);
+            const size_t end = std::min(num_split_scalars, start + points_per_thread);
+            for (size_t i = start; i < end; ++i) {
+                const int64_t digit = get_signed_window_digit(split_scalars[i], round * bits, bits);
+                if (digit == 0) {
+                    continue;
+                }
+                const size_t bucket = static_cast<size_t>(digit > 0 ? digit : -digit) - 1;
+                schedules[accumulator.get_owner(bucket)].push_back(make_owned_bucket_entry(i, digit < 0, bucket));
+            }
+        });
+    }
+    return result;
+}
+
+template class OwnedBucketAccumulator<curve::BN254>;
+template class OwnedBucketAccumulator<curve::Grumpkin>;
+
+template curve::BN254::Element pippenger_owned_buckets<curve::BN254>(
+    std::span<const curve::BN254::AffineElement> points,
+    PolynomialSpan<const curve::BN254::ScalarField> scalars,
+    size_t num_initial_points,
+    bool handle_edge_cases);
+
+template curve::Grumpkin::Element pippenger_owned_buckets<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::AffineElement> points,
+    PolynomialSpan<const curve::Grumpkin::ScalarField> scalars,
+    size_t num_initial_points,
+    bool handle_edge_cases);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,124 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+// Number of independent point additions that share a single batch inversion in the owned-bucket engine
+constexpr size_t OWNED_BUCKETS_ADDITION_BATCH_SIZE = 1 << 10;
+
+/**
+ * @brief Bucket schedule entry in the same layout as the sorted-schedule engine: the point index in the high 32 bits,
+ * the sign in bit 31 and the bucket index in the low 31 bits
+ */
+inline uint64_t make_owned_bucket_entry(size_t point_index, bool negate, size_t bucket)
+{
+    return (static_cast<uint64_t>(point_index) << 32) | (static_cast<uint64_t>(negate) << 31) |
+           static_cast<uint64_t>(bucket);
+}
+
+/**
+ * @brief Affine bucket accumulator in which every thread owns a disjoint range of the buckets
+ * @details accumulate() runs in two phases. In the bucketing phase, each producer thread emits schedule entries (see
+ * make_owned_bucket_entry), addressed to the thread owning their bucket. In the accumulation phase, each thread
+ * consumes the entries addressed to it and accumulates its buckets in affine form, batching up to
+ * OWNED_BUCKETS_ADDITION_BATCH_SIZE independent additions per batch inversion via add_affine_points. An entry whose
+ * bucket already has a pending addition in the current batch is deferred to the next batch. Finally, each thread
+ * reduces its own bucket range.
+ *
+ * The scratch space is kept between calls, so that the same accumulator can be used for every round of an MSM.
+ */
+template <typename Curve> class OwnedBucketAccumulator {
+  public:
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fq = typename Curve::BaseField;
+    // Called once per producer thread, to fill schedules[owner] with the entries for the buckets owned by `owner`
+    using ScheduleProducer = std::function<void(size_t producer, std::vector<std::vector<uint64_t>>& schedules)>;
+
+    OwnedBucketAccumulator(size_t num_buckets, bool handle_edge_cases);
+
+    size_t get_num_threads() const { return num_threads; }
+    size_t get_owner(size_t bucket) const { return bucket / buckets_per_thread; }
+
+    /**
+     * @brief Compute ∑ⱼ (j + 1)⋅bucket[j], where the buckets are filled with the entries emitted by `producer`
+     *
+     * @param point_table The points referenced by the schedule entries
+     * @param producer
+     * @return Element
+     */
+    Element accumulate(const AffineElement* point_table, const ScheduleProducer& producer);
+
+  private:
+    // Scratch memory of a thread that owns the bucket range [first_bucket, end_bucket)
+    struct ThreadState {
+        size_t first_bucket = 0;
+        size_t end_bucket = 0;
+        std::vector<uint8_t> bucket_occupied;
+        std::vector<uint8_t> bucket_in_batch;
+        std::vector<AffineElement> addition_pairs;
+        std::vector<uint32_t> addition_buckets;
+        std::vector<Fq> scratch_space;
+        std::vector<uint64_t> deferred_entries;
+        std::vector<uint64_t> retry_entries;
+        size_t batch_size = 0;
+    };
+
+    void flush_addition_batch(ThreadState& state);
+    void accumulate_entry(ThreadState& state, const AffineElement* point_table, uint64_t entry);
+    Element reduce(ThreadState& state);
+
+    size_t num_buckets;
+    size_t num_threads;
+    size_t buckets_per_thread;
+    bool handle_edge_cases;
+    // schedules[producer][owner] holds the entries emitted by `producer` for buckets owned by `owner`. The vectors are
+    // cleared but not deallocated between calls.
+    std::vector<std::vector<std::vector<uint64_t>>> schedules;
+    std::vector<AffineElement> buckets;
+    std::vector<ThreadState> thread_states;
+};
+
+/**
+ * @brief Pippenger with per-thread bucket ownership, as an alternative to sorting the point schedule
+ * @details The sorted-schedule engine (compute_wnaf_states + organize_buckets) radix sorts every round's point schedule
+ * by bucket so that each thread can be handed a contiguous bucket range. Here we skip the sort altogether:
+ *
+ * 1. Each scalar is split via the endomorphism and recoded into signed windows (see get_signed_window_digit), which
+ *    needs 2^{bits-1} buckets for a window of `bits` bits.
+ * 2. The buckets are partitioned into one disjoint range per thread (see OwnedBucketAccumulator). For each round, every
+ *    thread scans its slice of the points and emits a bucket index stream per owning thread (a single bucketing pass,
+ *    not a full sort).
+ * 3. Each thread then consumes the streams addressed to it, accumulates its buckets in affine form and reduces its own
+ *    bucket range; the per-thread round sums are combined on the calling thread.
+ *
+ * No thread ever writes to another thread's buckets, so no synchronisation is needed besides the fork/join between
+ * the bucketing and accumulation phases of each round.
+ *
+ * @param points Pippenger point table (raw points at even indices and endomorphism images at odd indices)
+ * @param scalars
+ * @param num_initial_points Only scalars with an index below num_initial_points are included in the MSM
+ * @param handle_edge_cases Whether the affine additions must handle doubling and the point at infinity
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element pippenger_owned_buckets(std::span<const typename Curve::AffineElement> points,
+                                                PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                                size_t num_initial_points,
+                                                bool handle_edge_cases);
+
+} // namespace bb::scalar_multiplication
@@ -6,11 +6,13 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
 
+#include "./owned_buckets_pippenger.hpp"
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
@@ -104,6 +106,20 @@
 
 namespace bb::scalar_multiplication {
 
+namespace {
+std::atomic<PippengerEngine> pippenger_engine = PippengerEngine::SORTED_SCHEDULE;
+} // namespace
+
+void set_pippenger_engine(PippengerEngine engine)
+{
+    pippenger_engine = engine;
+}
+
+PippengerEngine get_pippenger_engine()
+{
+    return pippenger_engine;
+}
+
 /**
  * The pippppenger point table computes for each point P = (x,y), a point P' = (\beta * x, -y) which enables us
  * to use the curve endomorphism for faster scalar multiplication. See below for more details.
@@ -915,6 +931,9 @@ typename Curve::Element pippenger_internal(std::span<const typename Curve::Affin
     BB_ASSERT_LTE(scalars.start_index + scalars.size(),
                   state.num_points / 2,
                   "Pippenger runtime state is too small to support this many points");
+    if (get_pippenger_engine() == PippengerEngine::BUCKET_OWNERSHIP) {
+        return pippenger_owned_buckets<Curve>(points, scalars, num_initial_points, handle_edge_cases);
+    }
     // multiplication_runtime_state state;
     compute_wnaf_states<Curve>(state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
     organize_buckets(state.point_schedule, num_initial_points * 2);
@@ -87,6 +87,16 @@ constexpr size_t get_num_buckets(const size_t num_points)
  *
  **/
 
+/**
+ * @brief The bucket accumulation strategy used by pippenger_internal
+ * @details SORTED_SCHEDULE is the algorithm described above. BUCKET_OWNERSHIP replaces the global radix sort with a
+ * per-thread bucket ownership scheme, see pippenger_owned_buckets.
+ */
+enum class PippengerEngine { SORTED_SCHEDULE, BUCKET_OWNERSHIP };
+
+void set_pippenger_engine(PippengerEngine engine);
+PippengerEngine get_pippenger_engine();
+
 template <typename Curve> struct multiplication_thread_state {
     typename Curve::Element* buckets;
     const uint64_t* point_schedule;
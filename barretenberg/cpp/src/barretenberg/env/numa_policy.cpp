@@ -0,0 +1,33 @@
+#include "numa_policy.hpp"
+#include <barretenberg/common/throw_or_abort.hpp>
+#include <cstdlib>
+#include <string>
+
+extern "C" {
+
+#ifdef NO_MULTITHREADING
+uint32_t env_numa_policy()
+{
+    return NUMA_POLICY_OFF;
+}
+#else
+/**
+ * The policy is read from BB_NUMA_POLICY: "off" (the default) or "local".
+ */
+uint32_t env_numa_policy()
+{
+    static const uint32_t policy = []() {
+        const char* val = std::getenv("BB_NUMA_POLICY");
+        const std::string name = val ? val : "off";
+        if (name == "off") {
+            return NUMA_POLICY_OFF;
+        }
+        if (name == "local") {
+            return NUMA_POLICY_LOCAL;
+        }
+        throw_or_abort("BB_NUMA_POLICY invalid.");
+    }();
+    return policy;
+}
+#endif
+}
@@ -0,0 +1,10 @@
+#pragma once
+#include "barretenberg/common/wasm_export.hpp"
+#include <cstdint>
+
+// Values of env_numa_policy()
+constexpr uint32_t NUMA_POLICY_OFF = 0;
+// Pin the parallel_for threads to cores and first-touch polynomial memory from the threads that process it
+constexpr uint32_t NUMA_POLICY_LOCAL = 1;
+
+WASM_IMPORT("env_numa_policy") uint32_t env_numa_policy();
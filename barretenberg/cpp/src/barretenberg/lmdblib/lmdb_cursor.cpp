@@ -71,4 +71,20 @@ bool LMDBCursor::read_prev(uint64_t numKeysToRead, KeyDupValuesVector& keyValueP
     return lmdb_queries::read_prev(*this, keyValuePairs, numKeysToRead);
 }
 
+bool LMDBCursor::read_next(uint64_t numItemsToRead,
+                           KeyValueViewsVector& keyValuePairs,
+                           std::vector<uint8_t>& arena) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return lmdb_queries::read_next(*this, keyValuePairs, arena, numItemsToRead);
+}
+
+bool LMDBCursor::read_prev(uint64_t numItemsToRead,
+                           KeyValueViewsVector& keyValuePairs,
+                           std::vector<uint8_t>& arena) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return lmdb_queries::read_prev(*this, keyValuePairs, arena, numItemsToRead);
+}
+
 } // namespace bb::lmdblib
@@ -30,6 +30,14 @@ class LMDBCursor {
     bool read_next(uint64_t numKeysToRead, KeyDupValuesVector& keyValuePairs) const;
     bool read_prev(uint64_t numKeysToRead, KeyDupValuesVector& keyValuePairs) const;
 
+    /*
+     * Reads up to numItemsToRead key/value pairs, copying them into a single arena owned by the caller rather than
+     * into a vector per key and value. Each duplicate of a key is read as its own pair.
+     * The views replace the contents of keyValuePairs and remain valid until the arena is next modified.
+     */
+    bool read_next(uint64_t numItemsToRead, KeyValueViewsVector& keyValuePairs, std::vector<uint8_t>& arena) const;
+    bool read_prev(uint64_t numItemsToRead, KeyValueViewsVector& keyValuePairs, std::vector<uint8_t>& arena) const;
+
   private:
     mutable std::mutex _mtx;
     std::shared_ptr<LMDBReadTransaction> _tx;
@@ -119,6 +119,42 @@ TEST_F(LMDBEnvironmentTest, can_read_from_database)
     }
 }
 
+TEST_F(LMDBEnvironmentTest, can_read_value_views_from_database)
+{
+    LMDBEnvironment::SharedPtr environment = std::make_shared<LMDBEnvironment>(
+        LMDBEnvironmentTest::_directory, LMDBEnvironmentTest::_mapSize, 1, LMDBEnvironmentTest::_maxReaders);
+    LMDBDatabase::SharedPtr db;
+
+    {
+        environment->wait_for_writer();
+        LMDBDatabaseCreationTransaction tx(environment);
+        db = std::make_unique<LMDBDatabase>(environment, tx, "DB", false, false);
+        EXPECT_NO_THROW(tx.commit());
+    }
+
+    {
+        environment->wait_for_writer();
+        LMDBWriteTransaction::Ptr tx = std::make_unique<LMDBWriteTransaction>(environment);
+        auto key = get_key(0);
+        auto data = get_value(0, 0);
+        EXPECT_NO_THROW(tx->put_value(key, data, *db));
+        EXPECT_NO_THROW(tx->commit());
+    }
+
+    {
+        environment->wait_for_reader();
+        LMDBReadTransaction::Ptr tx = std::make_unique<LMDBReadTransaction>(environment);
+        auto key = get_key(0);
+        auto expected = get_value(0, 0);
+        ValueView view;
+        EXPECT_TRUE(tx->get_value_view(key, view, *db));
+        EXPECT_EQ(std::vector<uint8_t>(view.begin(), view.end()), expected);
+
+        auto missing = get_key(1);
+        EXPECT_FALSE(tx->get_value_view(missing, view, *db));
+    }
+}
+
 TEST_F(LMDBEnvironmentTest, can_write_and_read_multiple)
 {
     LMDBEnvironment::SharedPtr environment = std::make_shared<LMDBEnvironment>(
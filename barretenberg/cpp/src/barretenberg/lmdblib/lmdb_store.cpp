@@ -141,11 +141,13 @@ void LMDBStore::get(KeysVector& keys, OptionalValuesVector& values, LMDBDatabase
     if (!db->duplicate_keys_permitted()) {
         const LMDBDatabase& dbRef = *db;
         for (auto& k : keys) {
-            OptionalValues optional;
-            Value value;
-            bool result = tx->get_value(k, value, dbRef);
-            optional = result ? OptionalValues(ValuesVector{ value }) : std::nullopt;
-            values.emplace_back(optional);
+            // copy each value straight out of the map into the vector that is returned
+            ValueView view;
+            if (!tx->get_value_view(k, view, dbRef)) {
+                values.emplace_back(std::nullopt);
+                continue;
+            }
+            values.emplace_back(ValuesVector{ Value(view.begin(), view.end()) });
         }
         return;
     }
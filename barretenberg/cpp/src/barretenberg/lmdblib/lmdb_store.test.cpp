@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <memory>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
@@ -723,6 +724,74 @@ TEST_F(LMDBStoreTest, can_read_duplicate_values_backwards_with_cursors)
     }
 }
 
+TEST_F(LMDBStoreTest, can_read_into_an_arena_with_cursors)
+{
+    LMDBStore::Ptr store = create_store(2);
+
+    const std::string dbName = "Test Database";
+    const std::string dupsDbName = "Test Database Dups";
+    store->open_database(dbName);
+    store->open_database(dupsDbName, true);
+
+    int64_t numKeys = 10;
+    int64_t numValues = 3;
+
+    write_test_data({ dbName }, numKeys, 1, *store);
+    write_test_data({ dupsDbName }, numKeys, numValues, *store);
+
+    auto to_vector = [](std::span<const uint8_t> view) { return std::vector<uint8_t>(view.begin(), view.end()); };
+
+    {
+        // read forwards and then backwards from a key mid-way through, re-using the arena
+        int64_t startKey = 3;
+        auto key = get_key(startKey);
+        LMDBStore::ReadTransaction::SharedPtr tx = store->create_shared_read_transaction();
+        LMDBStore::Cursor::Ptr cursor = store->create_cursor(tx, dbName);
+        EXPECT_TRUE(cursor->set_at_key(key));
+
+        int64_t numItemsToRead = 4;
+        KeyValueViewsVector keyValues;
+        std::vector<uint8_t> arena;
+        EXPECT_FALSE(cursor->read_next((uint64_t)numItemsToRead, keyValues, arena));
+        EXPECT_EQ(keyValues.size(), static_cast<size_t>(numItemsToRead));
+        for (size_t i = 0; i < keyValues.size(); i++) {
+            const auto count = static_cast<int64_t>(i);
+            EXPECT_EQ(to_vector(keyValues[i].key), get_key(startKey + count));
+            EXPECT_EQ(to_vector(keyValues[i].value), get_value(startKey + count, 0));
+        }
+
+        // the cursor is now at startKey + numItemsToRead, read all the way back to the start
+        EXPECT_TRUE(cursor->read_prev(static_cast<uint64_t>(numKeys), keyValues, arena));
+        EXPECT_EQ(keyValues.size(), static_cast<size_t>(startKey + numItemsToRead + 1));
+        for (size_t i = 0; i < keyValues.size(); i++) {
+            const auto count = static_cast<int64_t>(i);
+            EXPECT_EQ(to_vector(keyValues[i].key), get_key(startKey + numItemsToRead - count));
+            EXPECT_EQ(to_vector(keyValues[i].value), get_value(startKey + numItemsToRead - count, 0));
+        }
+    }
+
+    {
+        // each duplicate is read as its own item
+        int64_t startKey = 3;
+        auto key = get_key(startKey);
+        LMDBStore::ReadTransaction::SharedPtr tx = store->create_shared_read_transaction();
+        LMDBStore::Cursor::Ptr cursor = store->create_cursor(tx, dupsDbName);
+        EXPECT_TRUE(cursor->set_at_key(key));
+
+        int64_t numItemsToRead = 5;
+        KeyValueViewsVector keyValues;
+        std::vector<uint8_t> arena;
+        EXPECT_FALSE(cursor->read_next((uint64_t)numItemsToRead, keyValues, arena));
+        EXPECT_EQ(keyValues.size(), static_cast<size_t>(numItemsToRead));
+        for (size_t i = 0; i < keyValues.size(); i++) {
+            const auto count = static_cast<int64_t>(i);
+            int64_t keyValue = startKey + count / numValues;
+            EXPECT_EQ(to_vector(keyValues[i].key), get_key(keyValue));
+            EXPECT_EQ(to_vector(keyValues[i].value), get_value(keyValue, count % numValues));
+        }
+    }
+}
+
 TEST_F(LMDBStoreTest, can_read_past_the_end_with_cursors)
 {
     LMDBStore::Ptr store = create_store(2);
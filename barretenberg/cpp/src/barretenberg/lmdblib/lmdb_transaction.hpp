@@ -70,6 +70,14 @@ class LMDBTransaction {
 
     bool get_value(std::vector<uint8_t>& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    /*
+     * Reads the value at the given key without copying it out of the LMDB map.
+     * The view is only valid until the transaction ends or, for a write transaction, until its next write.
+     */
+    template <typename T> bool get_value_view(T& key, ValueView& data, const LMDBDatabase& db) const;
+
+    bool get_value_view(std::vector<uint8_t>& key, ValueView& data, const LMDBDatabase& db) const;
+
   protected:
     std::shared_ptr<LMDBEnvironment> _environment;
     uint64_t _id;
@@ -89,6 +97,12 @@ template <typename T> bool LMDBTransaction::get_value(T& key, uint64_t& data, co
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T> bool LMDBTransaction::get_value_view(T& key, ValueView& data, const LMDBDatabase& db) const
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    return get_value_view(keyBuffer, data, db);
+}
+
 template <typename T, typename K>
 bool LMDBTransaction::get_value_or_previous(T& key, K& data, const LMDBDatabase& db) const
 {
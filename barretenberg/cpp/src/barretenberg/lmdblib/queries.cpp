@@ -5,6 +5,9 @@
 #include "barretenberg/lmdblib/types.hpp"
 #include "lmdb.h"
 #include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace bb::lmdblib::lmdb_queries {
@@ -114,6 +117,20 @@ bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const bb::lmdbl
     return true;
 }
 
+bool get_value_view(Key& key, ValueView& data, const LMDBDatabase& db, const bb::lmdblib::LMDBTransaction& tx)
+{
+    MDB_val dbKey;
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    MDB_val dbVal;
+    if (!call_lmdb_func(mdb_get, tx.underlying(), db.underlying(), &dbKey, &dbVal)) {
+        return false;
+    }
+    data = ValueView(static_cast<const uint8_t*>(dbVal.mv_data), dbVal.mv_size);
+    return true;
+}
+
 bool set_at_key(const LMDBCursor& cursor, Key& key)
 {
     MDB_val dbKey;
@@ -214,6 +231,45 @@ bool read_next_dup(const LMDBCursor& cursor, KeyDupValuesVector& keyValues, uint
     return false;
 }
 
+bool read_next(const LMDBCursor& cursor,
+               KeyValueViewsVector& keyValues,
+               std::vector<uint8_t>& arena,
+               uint64_t numItemsToRead,
+               MDB_cursor_op op)
+{
+    // Collect the items first, they stay valid for the lifetime of the read transaction. That lets the arena be sized
+    // once, so that the views into it are not invalidated as it is filled.
+    std::vector<std::pair<MDB_val, MDB_val>> items;
+    MDB_val dbKey;
+    MDB_val dbVal;
+    int code = mdb_cursor_get(cursor.underlying(), &dbKey, &dbVal, MDB_GET_CURRENT);
+    while (items.size() < numItemsToRead && code == MDB_SUCCESS) {
+        items.emplace_back(dbKey, dbVal);
+        code = mdb_cursor_get(cursor.underlying(), &dbKey, &dbVal, op);
+    }
+
+    size_t totalSize = 0;
+    for (const auto& [key, value] : items) {
+        totalSize += key.mv_size + value.mv_size;
+    }
+    keyValues.clear();
+    keyValues.reserve(items.size());
+    arena.resize(totalSize);
+    uint8_t* next = arena.data();
+    auto copy_to_arena = [&](const MDB_val& dbVal) {
+        std::span<const uint8_t> view(next, dbVal.mv_size);
+        std::memcpy(next, dbVal.mv_data, dbVal.mv_size);
+        next += dbVal.mv_size;
+        return view;
+    };
+    for (const auto& [key, value] : items) {
+        std::span<const uint8_t> keyView = copy_to_arena(key);
+        keyValues.push_back({ .key = keyView, .value = copy_to_arena(value) });
+    }
+
+    return code != MDB_SUCCESS; // we're done
+}
+
 bool read_next(const LMDBCursor& cursor, KeyDupValuesVector& keyValues, uint64_t numKeysToRead)
 {
     return read_next(cursor, keyValues, numKeysToRead, MDB_NEXT);
@@ -223,6 +279,21 @@ bool read_prev(const LMDBCursor& cursor, KeyDupValuesVector& keyValues, uint64_t
     return read_next(cursor, keyValues, numKeysToRead, MDB_PREV);
 }
 
+bool read_next(const LMDBCursor& cursor,
+               KeyValueViewsVector& keyValues,
+               std::vector<uint8_t>& arena,
+               uint64_t numItemsToRead)
+{
+    return read_next(cursor, keyValues, arena, numItemsToRead, MDB_NEXT);
+}
+bool read_prev(const LMDBCursor& cursor,
+               KeyValueViewsVector& keyValues,
+               std::vector<uint8_t>& arena,
+               uint64_t numItemsToRead)
+{
+    return read_next(cursor, keyValues, arena, numItemsToRead, MDB_PREV);
+}
+
 bool read_next_dup(const LMDBCursor& cursor, KeyDupValuesVector& keyValues, uint64_t numKeysToRead)
 {
     return read_next_dup(cursor, keyValues, numKeysToRead, MDB_NEXT_NODUP);
@@ -450,6 +450,8 @@ bool get_value(Key& key, Value& data, const LMDBDatabase& db, const LMDBTransact
 
 bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const LMDBTransaction& tx);
 
+bool get_value_view(Key& key, ValueView& data, const LMDBDatabase& db, const LMDBTransaction& tx);
+
 bool set_at_key(const LMDBCursor& cursor, Key& key);
 bool set_at_key_gte(const LMDBCursor& cursor, Key& key);
 bool set_at_start(const LMDBCursor& cursor);
@@ -460,5 +462,14 @@ bool read_prev(const LMDBCursor& cursor, KeyDupValuesVector& keyValues, uint64_t
 
 bool read_next_dup(const LMDBCursor& cursor, KeyDupValuesVector& keyValues, uint64_t numKeysToRead);
 bool read_prev_dup(const LMDBCursor& cursor, KeyDupValuesVector& keyValues, uint64_t numKeysToRead);
+
+bool read_next(const LMDBCursor& cursor,
+               KeyValueViewsVector& keyValues,
+               std::vector<uint8_t>& arena,
+               uint64_t numItemsToRead);
+bool read_prev(const LMDBCursor& cursor,
+               KeyValueViewsVector& keyValues,
+               std::vector<uint8_t>& arena,
+               uint64_t numItemsToRead);
 } // namespace lmdb_queries
 } // namespace bb::lmdblib
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <iostream>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 namespace bb::lmdblib {
@@ -19,6 +20,16 @@ using KeyDupValuesVector = std::vector<KeyValuesPair>;
 using KeyOptionalValuesPair = std::pair<Key, OptionalValues>;
 using KeyOptionalValuesVector = std::vector<KeyOptionalValuesPair>;
 
+// A view of a value inside the LMDB map, see LMDBTransaction::get_value_view
+using ValueView = std::span<const uint8_t>;
+
+// A view of a key/value pair, either inside the LMDB map or inside an arena owned by the caller
+struct KeyValueView {
+    std::span<const uint8_t> key;
+    std::span<const uint8_t> value;
+};
+using KeyValueViewsVector = std::vector<KeyValueView>;
+
 struct DBStats {
     std::string name;
     uint64_t numDataItems;
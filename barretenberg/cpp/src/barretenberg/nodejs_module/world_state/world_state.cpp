@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <any>
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -181,6 +182,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::GET_SIBLING_PATH,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_path(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::GET_SIBLING_PATHS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_paths(obj, buffer); });
+
     _dispatcher.register_target(WorldStateMessageType::GET_BLOCK_NUMBERS_FOR_LEAF_INDICES,
                                 [this](msgpack::object& obj, msgpack::sbuffer& buffer) {
                                     return get_block_numbers_for_leaf_indices(obj, buffer);
@@ -262,6 +267,18 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
     _dispatcher.register_target(
         WorldStateMessageType::COPY_STORES,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return copy_stores(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::SET_GROUP_COMMIT,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return set_group_commit(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::COMMIT_STAGED_BLOCKS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return commit_staged_blocks(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::CREATE_FORK_FROM_FORK,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return create_fork_from_fork(obj, buffer); });
 }
 
 Napi::Value WorldStateWrapper::call(const Napi::CallbackInfo& info)
@@ -439,6 +456,23 @@ bool WorldStateWrapper::get_sibling_path(msgpack::object& obj, msgpack::sbuffer&
     return true;
 }
 
+bool WorldStateWrapper::get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<GetSiblingPathsRequest> request;
+    obj.convert(request);
+
+    std::vector<fr_sibling_path> paths =
+        _ws->get_sibling_paths(request.value.revision, request.value.treeId, request.value.leafIndices);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<std::vector<fr_sibling_path>> resp_msg(
+        WorldStateMessageType::GET_SIBLING_PATHS, header, paths);
+
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::get_block_numbers_for_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const
 {
     TypedMessage<GetBlockNumbersForLeafIndicesRequest> request;
@@ -701,6 +735,21 @@ bool WorldStateWrapper::create_fork(msgpack::object& obj, msgpack::sbuffer& buf)
     return true;
 }
 
+bool WorldStateWrapper::create_fork_from_fork(msgpack::object& obj, msgpack::sbuffer& buf)
+{
+    TypedMessage<ForkIdOnlyRequest> request;
+    obj.convert(request);
+
+    uint64_t forkId = _ws->create_fork_from_fork(request.value.forkId);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<CreateForkResponse> resp_msg(
+        WorldStateMessageType::CREATE_FORK_FROM_FORK, header, { forkId });
+    msgpack::pack(buf, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::delete_fork(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<DeleteForkRequest> request;
@@ -722,6 +771,8 @@ bool WorldStateWrapper::close(msgpack::object& obj, msgpack::sbuffer& buf)
 
     // The only reason this API exists is for testing purposes in TS (e.g. close db, open new db instance to test
     // persistence)
+    // Blocks staged by group commit would otherwise be lost
+    _ws->commit_staged_blocks();
     _ws.reset(nullptr);
 
     MsgHeader header(request.header.messageId);
@@ -843,6 +894,35 @@ bool WorldStateWrapper::copy_stores(msgpack::object& obj, msgpack::sbuffer& buff
     return true;
 }
 
+bool WorldStateWrapper::set_group_commit(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    TypedMessage<SetGroupCommitRequest> request;
+    obj.convert(request);
+
+    _ws->set_group_commit(request.value.maxBlocks, std::chrono::milliseconds(request.value.maxDelayMs));
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<EmptyResponse> resp_msg(WorldStateMessageType::SET_GROUP_COMMIT, header, {});
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
+bool WorldStateWrapper::commit_staged_blocks(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    HeaderOnlyMessage request;
+    obj.convert(request);
+
+    WorldStateStatusFull status = _ws->commit_staged_blocks();
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<WorldStateStatusFull> resp_msg(
+        WorldStateMessageType::COMMIT_STAGED_BLOCKS, header, { status });
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 Napi::Function WorldStateWrapper::get_class(Napi::Env env)
 {
     return DefineClass(env,
@@ -38,6 +38,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool get_leaf_value(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_leaf_preimage(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_sibling_path(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_block_numbers_for_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool find_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -55,6 +56,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool sync_block(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool create_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool create_fork_from_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool delete_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool close(msgpack::object& obj, msgpack::sbuffer& buffer);
@@ -70,6 +72,9 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool revert_checkpoint(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool copy_stores(msgpack::object& obj, msgpack::sbuffer& buffer);
+
+    bool set_group_commit(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool commit_staged_blocks(msgpack::object& obj, msgpack::sbuffer& buffer);
 };
 
 } // namespace bb::nodejs
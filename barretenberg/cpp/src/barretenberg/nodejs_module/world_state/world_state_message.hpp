@@ -54,6 +54,13 @@ enum WorldStateMessageType {
 
     COPY_STORES,
 
+    GET_SIBLING_PATHS,
+
+    SET_GROUP_COMMIT,
+    COMMIT_STAGED_BLOCKS,
+
+    CREATE_FORK_FROM_FORK,
+
     CLOSE = 999,
 };
 
@@ -144,6 +151,13 @@ struct GetSiblingPathRequest {
     MSGPACK_FIELDS(treeId, revision, leafIndex);
 };
 
+struct GetSiblingPathsRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<index_t> leafIndices;
+    MSGPACK_FIELDS(treeId, revision, leafIndices);
+};
+
 struct GetBlockNumbersForLeafIndicesRequest {
     MerkleTreeId treeId;
     WorldStateRevision revision;
@@ -239,6 +253,12 @@ struct CopyStoresRequest {
     MSGPACK_FIELDS(dstPath, compact);
 };
 
+struct SetGroupCommitRequest {
+    uint32_t maxBlocks;
+    uint64_t maxDelayMs;
+    MSGPACK_FIELDS(maxBlocks, maxDelayMs);
+};
+
 } // namespace bb::nodejs
 
 MSGPACK_ADD_ENUM(bb::nodejs::WorldStateMessageType)
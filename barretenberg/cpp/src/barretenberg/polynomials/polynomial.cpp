@@ -6,12 +6,14 @@
 
 #include "polynomial.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/numa.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
 #include "polynomial_arithmetic.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <fcntl.h>
 #include <list>
@@ -45,6 +47,62 @@ SharedShiftedVirtualZeroesArray<Fr> _clone(const SharedShiftedVirtualZeroesArray
     return { array.start_ - left_expansion, array.end_ + right_expansion, array.virtual_size_, backing_clone };
 }
 
+namespace {
+/**
+ * @brief Run func(offset, range) in parallel over contiguous chunks covering the backing memory of a polynomial
+ * @details A page is placed on the NUMA node of the thread that first writes to it. Under the local NUMA policy, the
+ * j-th iteration of a top-level parallel_for always runs on the same core, so the chunks are those in which sumcheck
+ * splits the edges [0, virtual_size) of its first round (see SumcheckProverRound::compute_univariate, for flavors
+ * that use a single chunk per thread), restricted to the indices [start_index, start_index + size) that are backed by
+ * memory: each chunk then ends up next to the core that processes it. Otherwise placement does not matter and the
+ * backing memory is split evenly, only to spread the work. The offsets are relative to the backing memory.
+ */
+template <typename Func>
+void _parallel_for_placement_chunks(size_t size, size_t virtual_size, size_t start_index, Func&& func)
+{
+    if (!numa_local_policy()) {
+        size_t num_threads = calculate_num_threads(size);
+        size_t range_per_thread = size / num_threads;
+        size_t leftovers = size - (range_per_thread * num_threads);
+        parallel_for(num_threads, [&](size_t j) {
+            size_t offset = j * range_per_thread;
+            size_t range = (j == num_threads - 1) ? range_per_thread + leftovers : range_per_thread;
+            func(offset, range);
+        });
+        return;
+    }
+
+    // The minimum number of edges per thread of sumcheck
+    constexpr size_t SUMCHECK_MIN_ITERATIONS_PER_THREAD = 1 << 6;
+    size_t num_threads = calculate_num_threads_pow2(virtual_size, SUMCHECK_MIN_ITERATIONS_PER_THREAD);
+    size_t range_per_thread = virtual_size / num_threads;
+    parallel_for(num_threads, [&](size_t j) {
+        size_t chunk_start = j * range_per_thread;
+        size_t chunk_end = (j == num_threads - 1) ? virtual_size : chunk_start + range_per_thread;
+        size_t begin = std::max(chunk_start, start_index);
+        size_t end = std::min(chunk_end, start_index + size);
+        if (begin < end) {
+            func(begin - start_index, end - begin);
+        }
+    });
+}
+} // namespace
+
+/**
+ * @brief Write to every page of the backing memory of a polynomial, in the chunks in which the zeroing constructor
+ * zeroes it
+ */
+template <typename Fr> void _first_touch(Fr* data, size_t size, size_t virtual_size, size_t start_index)
+{
+    constexpr size_t PAGE_SIZE = 4096;
+    auto* bytes = reinterpret_cast<uint8_t*>(data);
+    _parallel_for_placement_chunks(size, virtual_size, start_index, [&](size_t offset, size_t range) {
+        for (size_t byte = offset * sizeof(Fr); byte < (offset + range) * sizeof(Fr); byte += PAGE_SIZE) {
+            bytes[byte] = 0;
+        }
+    });
+}
+
 template <typename Fr>
 void Polynomial<Fr>::allocate_backing_memory(size_t size, size_t virtual_size, size_t start_index)
 {
@@ -72,13 +130,7 @@ template <typename Fr> Polynomial<Fr>::Polynomial(size_t size, size_t virtual_si
 
     allocate_backing_memory(size, virtual_size, start_index);
 
-    size_t num_threads = calculate_num_threads(size);
-    size_t range_per_thread = size / num_threads;
-    size_t leftovers = size - (range_per_thread * num_threads);
-
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t range = (j == num_threads - 1) ? range_per_thread + leftovers : range_per_thread;
+    _parallel_for_placement_chunks(size, virtual_size, start_index, [&](size_t offset, size_t range) {
         ASSERT(offset < size || size == 0);
         BB_ASSERT_LTE((offset + range), size);
         memset(static_cast<void*>(coefficients_.backing_memory_.get() + offset), 0, sizeof(Fr) * range);
@@ -97,6 +149,10 @@ Polynomial<Fr>::Polynomial(size_t size, size_t virtual_size, size_t start_index,
 {
     PROFILE_THIS_NAME("polynomial allocation without zeroing");
     allocate_backing_memory(size, virtual_size, start_index);
+    // The zeroing constructor places its pages as a side effect
+    if (numa_local_policy()) {
+        _first_touch(coefficients_.backing_memory_.get(), size, virtual_size, start_index);
+    }
 }
 
 template <typename Fr>
@@ -293,13 +349,29 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     return *this;
 }
 
-template <typename Fr> Polynomial<Fr> Polynomial<Fr>::create_non_parallel_zero_init(size_t size, size_t virtual_size)
+template <typename Fr>
+Polynomial<Fr> Polynomial<Fr>::create_non_parallel_zero_init(size_t size, size_t virtual_size, size_t start_index)
 {
-    Polynomial p(size, virtual_size, Polynomial<Fr>::DontZeroMemory::FLAG);
+    Polynomial p(size, virtual_size, start_index, Polynomial<Fr>::DontZeroMemory::FLAG);
     memset(static_cast<void*>(p.coefficients_.backing_memory_.get()), 0, sizeof(Fr) * size);
     return p;
 }
 
+template <typename Fr>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+Polynomial<Fr> Polynomial<Fr>::from_backing_memory(std::shared_ptr<Fr[]> backing_memory,
+                                                   size_t size,
+                                                   size_t virtual_size,
+                                                   size_t start_index)
+{
+    BB_ASSERT_LTE(start_index + size, virtual_size);
+    Polynomial p;
+    p.coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{
+        start_index, size + start_index, virtual_size, std::move(backing_memory)
+    };
+    return p;
+}
+
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/1113): Optimizing based on actual sizes would involve using
 // expand, but it is currently unused.
 template <typename Fr>
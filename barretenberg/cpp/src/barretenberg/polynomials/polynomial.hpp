@@ -324,7 +324,20 @@ template <typename Fr> class Polynomial {
      *
      * @return a polynomial initialized with zero on the range defined by size
      */
-    static Polynomial create_non_parallel_zero_init(size_t size, size_t virtual_size);
+    static Polynomial create_non_parallel_zero_init(size_t size, size_t virtual_size, size_t start_index = 0);
+
+    /**
+     * @brief A factory to construct a polynomial over memory that already holds its coefficients, without copying.
+     * @details The polynomial shares ownership of the memory, which can belong to another object through the aliasing
+     * constructor of std::shared_ptr (e.g. a vector that the coefficients were written to).
+     *
+     * @param backing_memory The coefficients from start_index to start_index + size
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    static Polynomial from_backing_memory(std::shared_ptr<Fr[]> backing_memory,
+                                          size_t size,
+                                          size_t virtual_size,
+                                          size_t start_index = 0);
 
     /**
      * @brief Expands the polynomial with new start_index and end_index
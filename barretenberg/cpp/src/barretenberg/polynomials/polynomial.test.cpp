@@ -1,4 +1,6 @@
 #include <cstddef>
+#include <memory>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -86,6 +88,33 @@ TEST(Polynomial, Share)
     EXPECT_NE(poly_clone, poly);
 }
 
+// Simple test/demonstration of a polynomial over memory owned by another object
+TEST(Polynomial, FromBackingMemory)
+{
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    auto values = std::make_shared<std::vector<FF>>(std::vector<FF>{ 0, 1, 2, 3 });
+
+    // Skip the first value, which is zero, so that the polynomial can be shifted
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<FF[]> memory(values, values->data() + 1);
+    auto poly = Polynomial::from_backing_memory(memory, /*size*/ 3, /*virtual_size*/ 8, /*start_index*/ 1);
+    EXPECT_EQ(poly.start_index(), 1);
+    EXPECT_EQ(poly.end_index(), 4);
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(poly.get(i), FF(i));
+    }
+    EXPECT_EQ(poly.get(6), FF(0));
+    EXPECT_EQ(poly.shifted()[0], FF(1));
+
+    // The polynomial writes to, and keeps alive, the original memory
+    poly.at(2) = 7;
+    EXPECT_EQ((*values)[2], FF(7));
+    values.reset();
+    memory.reset();
+    EXPECT_EQ(poly[3], FF(3));
+}
+
 // Simple test/demonstration of various edge conditions
 TEST(Polynomial, Indices)
 {
@@ -5,11 +5,16 @@
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
+#include <memory>
 
 namespace bb::pairing {
 struct miller_lines;
 } // namespace bb::pairing
 
+namespace bb::scalar_multiplication {
+template <typename Curve> struct FixedBaseTable;
+} // namespace bb::scalar_multiplication
+
 namespace bb::srs::factories {
 
 /**
@@ -25,6 +30,13 @@ template <typename Curve> class ProverCrs {
      */
     virtual std::span<typename Curve::AffineElement> get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+    /**
+     * @brief Returns the precomputed fixed-base table of a prefix of the monomial points, if there is one
+     */
+    virtual std::shared_ptr<const scalar_multiplication::FixedBaseTable<Curve>> get_fixed_base_table() const
+    {
+        return nullptr;
+    }
 };
 
 template <typename Curve> class VerifierCrs {
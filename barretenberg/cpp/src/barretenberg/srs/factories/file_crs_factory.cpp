@@ -7,9 +7,17 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "fixed_base_prover_crs.hpp"
 
 namespace bb::srs::factories {
 
+template <typename Curve>
+void FileProverCrs<Curve>::init_fixed_base_table(std::string const& path,
+                                                 const scalar_multiplication::FixedBaseTableConfig& config)
+{
+    fixed_base_table_ = load_or_compute_fixed_base_table<Curve>(path, get_monomial_points(), config);
+}
+
 FileVerifierCrs<curve::BN254>::FileVerifierCrs(std::string const& path, const size_t)
     : precomputed_g2_lines((bb::pairing::miller_lines*)(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
 {
@@ -48,10 +56,13 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 }
 
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+FileCrsFactory<Curve>::FileCrsFactory(std::string path,
+                                      size_t initial_degree,
+                                      scalar_multiplication::FixedBaseTableConfig fixed_base_config)
     : path_(std::move(path))
     , prover_degree_(initial_degree)
     , verifier_degree_(initial_degree)
+    , fixed_base_config_(fixed_base_config)
 {}
 
 template <typename Curve>
@@ -60,7 +71,7 @@ std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get
     PROFILE_THIS();
 
     if (prover_degree_ < degree || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_, fixed_base_config_);
         prover_degree_ = degree;
         vinfo("Initialized ", Curve::name, " prover CRS from file of size ", degree);
     }
@@ -2,6 +2,7 @@
 #include "../io.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "crs_factory.hpp"
@@ -15,7 +16,9 @@ namespace bb::srs::factories {
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path,
+                   size_t initial_degree = 0,
+                   scalar_multiplication::FixedBaseTableConfig fixed_base_config = {});
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -26,6 +29,7 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
     std::string path_;
     size_t prover_degree_;
     size_t verifier_degree_;
+    scalar_multiplication::FixedBaseTableConfig fixed_base_config_;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
@@ -37,11 +41,15 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
      * @details Allocates space in monomials_ for 2 * num_points affine elements, populates the first num_points with
      * the raw SRS elements P_i, then overwrites the same memory with the 'pippenger point table' which contains the raw
      * elements P_i at even indices and the endomorphism point (\beta * P_i.x, -P_i.y) at odd indices.
+     * Optionally also sets up a fixed-base table for a prefix of the points (see init_fixed_base_table).
      *
      * @param num_points
      * @param path
+     * @param fixed_base_config
      */
-    FileProverCrs(const size_t num_points, std::string const& path)
+    FileProverCrs(const size_t num_points,
+                  std::string const& path,
+                  const scalar_multiplication::FixedBaseTableConfig& fixed_base_config = {})
         : num_points(num_points)
     {
 
@@ -51,6 +59,7 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
 
         srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        init_fixed_base_table(path, fixed_base_config);
     };
 
     ~FileProverCrs()
@@ -64,9 +73,21 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
 
     [[nodiscard]] size_t get_monomial_size() const { return num_points; }
 
+    std::shared_ptr<const scalar_multiplication::FixedBaseTable<Curve>> get_fixed_base_table() const
+    {
+        return fixed_base_table_;
+    }
+
   private:
+    /**
+     * @brief Load the fixed-base table described by the config from the CRS directory, or compute and store it there
+     * (see load_or_compute_fixed_base_table)
+     */
+    void init_fixed_base_table(std::string const& path, const scalar_multiplication::FixedBaseTableConfig& config);
+
     size_t num_points;
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
+    std::shared_ptr<const scalar_multiplication::FixedBaseTable<Curve>> fixed_base_table_;
 };
 
 template <typename Curve> class FileVerifierCrs : public VerifierCrs<Curve> {
@@ -0,0 +1,158 @@
+#include "fixed_base_prover_crs.hpp"
+#include "barretenberg/common/log.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifndef __wasm__
+#include <unistd.h>
+#endif
+
+namespace bb::srs::factories {
+
+namespace {
+
+template <typename Curve>
+std::string get_fixed_base_table_path(std::string const& dir, size_t num_points, size_t window_bits, size_t depth)
+{
+    return format(dir, "/fixed_base_", Curve::name, "_", num_points, "_", window_bits, "_", depth, ".dat");
+}
+
+/**
+ * @brief Read a fixed-base table with the given parameters, or return nullptr if there is no such (valid) file
+ */
+template <typename Curve>
+std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> read_fixed_base_table(
+    std::string const& filename, const FixedBaseTableFileHeader& expected)
+{
+    std::ifstream file(filename, std::ifstream::binary);
+    if (!file) {
+        return nullptr;
+    }
+    FixedBaseTableFileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || std::memcmp(&header, &expected, sizeof(header)) != 0) {
+        return nullptr;
+    }
+    auto table = std::make_shared<scalar_multiplication::FixedBaseTable<Curve>>();
+    table->num_points = header.num_points;
+    table->window_bits = header.window_bits;
+    table->depth = header.depth;
+    table->points.resize(2 * table->num_points * table->depth);
+    file.read(reinterpret_cast<char*>(table->points.data()),
+              static_cast<std::streamsize>(table->points.size() * sizeof(typename Curve::AffineElement)));
+    if (!file) {
+        return nullptr;
+    }
+    return table;
+}
+
+template <typename Curve>
+bool write_fixed_base_table(std::string const& filename,
+                            const FixedBaseTableFileHeader& header,
+                            const scalar_multiplication::FixedBaseTable<Curve>& table)
+{
+#ifdef __wasm__
+    static_cast<void>(filename);
+    static_cast<void>(header);
+    static_cast<void>(table);
+    return false;
+#else
+    const std::string temp_filename = format(filename, ".tmp.", getpid());
+    {
+        std::ofstream file(temp_filename, std::ofstream::binary);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(table.points.data()),
+                   static_cast<std::streamsize>(table.points.size() * sizeof(typename Curve::AffineElement)));
+        if (!file) {
+            std::remove(temp_filename.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temp_filename.c_str(), filename.c_str()) != 0) {
+        std::remove(temp_filename.c_str());
+        return false;
+    }
+    return true;
+#endif
+}
+
+} // namespace
+
+template <typename Curve>
+uint64_t get_fixed_base_points_digest(std::span<const typename Curve::AffineElement> point_table, size_t num_points)
+{
+    // 64-bit FNV-1a over the words of the points; this guards against a stale table, not against tampering
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325;
+    constexpr uint64_t FNV_PRIME = 0x100000001b3;
+    static_assert(sizeof(typename Curve::AffineElement) % sizeof(uint64_t) == 0);
+    const size_t num_words = 2 * num_points * sizeof(typename Curve::AffineElement) / sizeof(uint64_t);
+    const auto* bytes = reinterpret_cast<const uint8_t*>(point_table.data());
+    uint64_t digest = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < num_words; ++i) {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+        digest = (digest ^ word) * FNV_PRIME;
+    }
+    return digest;
+}
+
+template <typename Curve>
+std::shared_ptr<const scalar_multiplication::FixedBaseTable<Curve>> load_or_compute_fixed_base_table(
+    std::string const& dir,
+    std::span<const typename Curve::AffineElement> point_table,
+    const scalar_multiplication::FixedBaseTableConfig& config)
+{
+    const size_t table_size = std::min(config.num_points, point_table.size() / 2);
+    if (table_size == 0) {
+        return nullptr;
+    }
+    const size_t depth =
+        scalar_multiplication::get_fixed_base_table_depth<Curve>(table_size, config.window_bits, config.memory_budget);
+    if (depth == 0) {
+        vinfo("Memory budget of ",
+              config.memory_budget,
+              " bytes is too small for a fixed-base table of ",
+              table_size,
+              " points");
+        return nullptr;
+    }
+
+    const FixedBaseTableFileHeader header{ FIXED_BASE_TABLE_MAGIC,
+                                           table_size,
+                                           config.window_bits,
+                                           depth,
+                                           get_fixed_base_points_digest<Curve>(point_table, table_size) };
+    const std::string filename = get_fixed_base_table_path<Curve>(dir, table_size, config.window_bits, depth);
+    auto table = read_fixed_base_table<Curve>(filename, header);
+    if (table) {
+        vinfo("Loaded ", Curve::name, " fixed-base table of depth ", depth, " from ", filename);
+        return table;
+    }
+    table = std::make_shared<scalar_multiplication::FixedBaseTable<Curve>>(
+        scalar_multiplication::compute_fixed_base_table<Curve>(point_table, table_size, config.window_bits, depth));
+    if (write_fixed_base_table<Curve>(filename, header, *table)) {
+        vinfo("Stored ", Curve::name, " fixed-base table of depth ", depth, " to ", filename);
+    } else {
+        vinfo("Could not store ", Curve::name, " fixed-base table to ", filename);
+    }
+    return table;
+}
+
+template uint64_t get_fixed_base_points_digest<curve::BN254>(std::span<const curve::BN254::AffineElement>, size_t);
+template uint64_t get_fixed_base_points_digest<curve::Grumpkin>(std::span<const curve::Grumpkin::AffineElement>,
+                                                                size_t);
+template std::shared_ptr<const scalar_multiplication::FixedBaseTable<curve::BN254>> load_or_compute_fixed_base_table<
+    curve::BN254>(std::string const&,
+                  std::span<const curve::BN254::AffineElement>,
+                  const scalar_multiplication::FixedBaseTableConfig&);
+template std::shared_ptr<const scalar_multiplication::FixedBaseTable<curve::Grumpkin>>
+load_or_compute_fixed_base_table<curve::Grumpkin>(std::string const&,
+                                                  std::span<const curve::Grumpkin::AffineElement>,
+                                                  const scalar_multiplication::FixedBaseTableConfig&);
+
+} // namespace bb::srs::factories
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
+#include "crs_factory.hpp"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace bb::srs::factories {
+
+/**
+ * @brief Header of a persisted fixed-base table
+ * @details The points follow the header in their in-memory (Montgomery) representation, so the file is a local cache
+ * rather than a portable format. points_digest is a digest of the prefix of the pippenger point table the table was
+ * computed from, so that a table is never reused against a different CRS.
+ */
+struct FixedBaseTableFileHeader {
+    uint64_t magic;
+    uint64_t num_points;
+    uint64_t window_bits;
+    uint64_t depth;
+    uint64_t points_digest;
+};
+
+constexpr uint64_t FIXED_BASE_TABLE_MAGIC = 0x6262666978656432; // "bbfixed2"
+
+/**
+ * @brief A (non-cryptographic) digest of the first num_points points of a pippenger point table
+ */
+template <typename Curve>
+uint64_t get_fixed_base_points_digest(std::span<const typename Curve::AffineElement> point_table, size_t num_points);
+
+/**
+ * @brief Load the fixed-base table described by the config from dir, or compute it and store it there
+ * @details The table covers the first min(config.num_points, point_table.size() / 2) points of the pippenger point
+ * table, with the largest depth allowed by the memory budget. Computing the table costs window_bits doublings per
+ * point and row, so it is persisted and only recomputed if it is missing or was computed from different points. The
+ * file is written under a temporary name and renamed into place, so that concurrent processes never read a partially
+ * written table. Failing to persist the table is not fatal.
+ *
+ * @return The table, or nullptr if the config disables it or its memory budget is too small for a single row
+ */
+template <typename Curve>
+std::shared_ptr<const scalar_multiplication::FixedBaseTable<Curve>> load_or_compute_fixed_base_table(
+    std::string const& dir,
+    std::span<const typename Curve::AffineElement> point_table,
+    const scalar_multiplication::FixedBaseTableConfig& config);
+
+/**
+ * @brief A prover CRS extended with a fixed-base table of a prefix of its points
+ * @details Used to add a fixed-base table to a CRS that does not build one itself, e.g. an MmapProverCrs.
+ */
+template <typename Curve> class FixedBaseProverCrs : public ProverCrs<Curve> {
+  public:
+    FixedBaseProverCrs(std::shared_ptr<ProverCrs<Curve>> prover_crs,
+                       std::shared_ptr<const scalar_multiplication::FixedBaseTable<Curve>> fixed_base_table)
+        : prover_crs_(std::move(prover_crs))
+        , fixed_base_table_(std::move(fixed_base_table))
+    {}
+
+    std::span<typename Curve::AffineElement> get_monomial_points() override
+    {
+        return prover_crs_->get_monomial_points();
+    }
+
+    size_t get_monomial_size() const override { return prover_crs_->get_monomial_size(); }
+
+    std::shared_ptr<const scalar_multiplication::FixedBaseTable<Curve>> get_fixed_base_table() const override
+    {
+        return fixed_base_table_;
+    }
+
+  private:
+    std::shared_ptr<ProverCrs<Curve>> prover_crs_;
+    std::shared_ptr<const scalar_multiplication::FixedBaseTable<Curve>> fixed_base_table_;
+};
+
+} // namespace bb::srs::factories
@@ -1,10 +1,14 @@
 #include "../io.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "barretenberg/srs/factories/fixed_base_prover_crs.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include "barretenberg/srs/factories/mmap_prover_crs.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include "file_crs_factory.hpp"
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 
@@ -77,3 +81,81 @@ TEST(reference_string, mem_grumpkin_file_consistency)
     //                      sizeof(Grumpkin::AffineElement) * 1024 * 2),
     //               0);
 }
+
+TEST(reference_string, mmap_bn254_file_consistency)
+{
+    // Convert 1024 points from file into a point table file.
+    std::vector<g1::affine_element> points(1024);
+    ::srs::IO<BN254>::read_transcript_g1(points.data(), 1024, bb::srs::get_ignition_crs_path());
+    g2::affine_element g2_point;
+    ::srs::IO<BN254>::read_transcript_g2(g2_point, bb::srs::get_ignition_crs_path());
+
+    const std::string point_table_path =
+        (std::filesystem::temp_directory_path() / "mmap_bn254_file_consistency_point_table.dat").string();
+    ASSERT_TRUE(write_point_table_file<BN254>(point_table_path, points));
+    EXPECT_EQ(MmapProverCrs<BN254>::get_file_num_points(point_table_path), 1024);
+    EXPECT_EQ(MmapProverCrs<BN254>::open(point_table_path, 2048), nullptr);
+    // The curve is part of the file header
+    EXPECT_EQ(MmapProverCrs<Grumpkin>::open(point_table_path, 1024), nullptr);
+
+    MemBn254CrsFactory mem_crs(points, g2_point);
+    MemBn254CrsFactory mmap_crs(MmapProverCrs<BN254>::open(point_table_path, 1000), g2_point);
+    auto mem_prover_crs = mem_crs.get_prover_crs(1000);
+    auto mmap_prover_crs = mmap_crs.get_prover_crs(1000);
+
+    EXPECT_EQ(mmap_prover_crs->get_monomial_size(), 1000);
+    EXPECT_EQ(memcmp(mem_prover_crs->get_monomial_points().data(),
+                     mmap_prover_crs->get_monomial_points().data(),
+                     sizeof(g1::affine_element) * 1000 * 2),
+              0);
+    EXPECT_EQ(mem_crs.get_verifier_crs()->get_g1_identity(), mmap_crs.get_verifier_crs()->get_g1_identity());
+
+    std::filesystem::remove(point_table_path);
+}
+
+TEST(reference_string, fixed_base_table_file_consistency)
+{
+    std::vector<g1::affine_element> points(1024);
+    for (auto& point : points) {
+        point = g1::affine_element(g1::element::random_element());
+    }
+    auto prover_crs = std::make_shared<MemProverCrs<BN254>>(points);
+    // Enough memory for two rows
+    const scalar_multiplication::FixedBaseTableConfig config{
+        .num_points = 256,
+        .window_bits = 12,
+        .memory_budget = 2 * scalar_multiplication::FixedBaseTable<BN254>::get_row_size(256),
+    };
+    const auto dir = std::filesystem::temp_directory_path() / "fixed_base_table_file_consistency";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+
+    // The first call computes and stores the table, the second one loads it
+    auto computed = load_or_compute_fixed_base_table<BN254>(dir.string(), prover_crs->get_monomial_points(), config);
+    ASSERT_NE(computed, nullptr);
+    EXPECT_EQ(computed->num_points, 256);
+    EXPECT_EQ(computed->depth, 2);
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(dir), std::filesystem::directory_iterator()), 1);
+    auto loaded = load_or_compute_fixed_base_table<BN254>(dir.string(), prover_crs->get_monomial_points(), config);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->points, computed->points);
+
+    // A table stored for other points is not reused
+    std::swap(points[0], points[1]);
+    auto other_crs = std::make_shared<MemProverCrs<BN254>>(points);
+    auto recomputed =
+        load_or_compute_fixed_base_table<BN254>(dir.string(), other_crs->get_monomial_points(), config);
+    ASSERT_NE(recomputed, nullptr);
+    const auto expected = scalar_multiplication::compute_fixed_base_table<BN254>(
+        other_crs->get_monomial_points(), config.num_points, config.window_bits, /*depth*/ 2);
+    EXPECT_EQ(recomputed->points, expected.points);
+    EXPECT_NE(recomputed->points, computed->points);
+
+    // A prover CRS extended with the table
+    FixedBaseProverCrs<BN254> fixed_base_crs(prover_crs, loaded);
+    EXPECT_EQ(fixed_base_crs.get_monomial_size(), 1024);
+    EXPECT_EQ(fixed_base_crs.get_fixed_base_table(), loaded);
+    EXPECT_EQ(prover_crs->get_fixed_base_table(), nullptr);
+
+    std::filesystem::remove_all(dir);
+}
@@ -24,6 +24,12 @@ class MemVerifierCrs : public VerifierCrs<Grumpkin> {
         scalar_multiplication::generate_pippenger_point_table<Grumpkin>(monomials_.get(), monomials_.get(), num_points);
     }
 
+    // Share the point table of the prover CRS, keeping the latter alive for as long as this CRS
+    MemVerifierCrs(std::shared_ptr<ProverCrs<Grumpkin>> const& prover_crs)
+        : num_points(prover_crs->get_monomial_size())
+        , monomials_(prover_crs, prover_crs->get_monomial_points().data())
+    {}
+
     virtual ~MemVerifierCrs() = default;
     std::span<const Grumpkin::AffineElement> get_monomial_points() const override
     {
@@ -51,6 +57,13 @@ MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::vector<Grumpkin::AffineElement
           prover_crs_->get_monomial_size());
 }
 
+MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::shared_ptr<ProverCrs<Grumpkin>> prover_crs)
+    : prover_crs_(std::move(prover_crs))
+    , verifier_crs_(std::make_shared<MemVerifierCrs>(prover_crs_))
+{
+    vinfo("Initialized ", curve::Grumpkin::name, " prover CRS with num points = ", prover_crs_->get_monomial_size());
+}
+
 std::shared_ptr<bb::srs::factories::ProverCrs<Grumpkin>> MemGrumpkinCrsFactory::get_prover_crs(size_t degree)
 {
     if (prover_crs_->get_monomial_size() < degree) {
@@ -13,6 +13,8 @@ namespace bb::srs::factories {
 class MemGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
   public:
     MemGrumpkinCrsFactory(std::vector<curve::Grumpkin::AffineElement> const& points);
+    // Use an existing prover CRS, e.g. an MmapProverCrs; the verifier CRS shares its point table
+    MemGrumpkinCrsFactory(std::shared_ptr<ProverCrs<curve::Grumpkin>> prover_crs);
     MemGrumpkinCrsFactory(MemGrumpkinCrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<curve::Grumpkin>> get_prover_crs(size_t degree) override;
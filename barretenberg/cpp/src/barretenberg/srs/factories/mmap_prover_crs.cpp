@@ -0,0 +1,174 @@
+#include "mmap_prover_crs.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs::factories {
+
+namespace {
+
+template <typename Curve> PointTableFileHeader make_point_table_file_header(size_t num_points)
+{
+    PointTableFileHeader header{};
+    header.magic = POINT_TABLE_FILE_MAGIC;
+    header.num_points = num_points;
+    header.element_size = sizeof(typename Curve::AffineElement);
+    std::strncpy(header.curve_name, Curve::name, sizeof(header.curve_name) - 1);
+    return header;
+}
+
+template <typename Curve> bool is_valid_point_table_file_header(const PointTableFileHeader& header)
+{
+    const auto expected = make_point_table_file_header<Curve>(header.num_points);
+    return header.magic == expected.magic && header.element_size == expected.element_size &&
+           std::strncmp(header.curve_name, expected.curve_name, sizeof(header.curve_name)) == 0;
+}
+
+} // namespace
+
+template <typename Curve>
+bool write_point_table_file(std::string const& filename, std::span<const typename Curve::AffineElement> points)
+{
+#ifdef __wasm__
+    static_cast<void>(filename);
+    static_cast<void>(points);
+    return false;
+#else
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t num_points = points.size();
+    std::vector<AffineElement> point_table(2 * num_points);
+    std::copy(points.begin(), points.end(), point_table.begin());
+    scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.data(), point_table.data(), num_points);
+
+    const std::string temp_filename = format(filename, ".tmp.", getpid());
+    {
+        std::ofstream file(temp_filename, std::ofstream::binary);
+        if (!file) {
+            return false;
+        }
+        const auto header = make_point_table_file_header<Curve>(num_points);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(point_table.data()),
+                   static_cast<std::streamsize>(point_table.size() * sizeof(AffineElement)));
+        if (!file) {
+            std::remove(temp_filename.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temp_filename.c_str(), filename.c_str()) != 0) {
+        std::remove(temp_filename.c_str());
+        return false;
+    }
+    return true;
+#endif
+}
+
+template <typename Curve> size_t MmapProverCrs<Curve>::get_file_num_points(std::string const& filename)
+{
+    std::ifstream file(filename, std::ifstream::binary | std::ifstream::ate);
+    if (!file) {
+        return 0;
+    }
+    const auto file_size = static_cast<size_t>(file.tellg());
+    file.seekg(0);
+    PointTableFileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || !is_valid_point_table_file_header<Curve>(header)) {
+        return 0;
+    }
+    // Guard against truncated files, which would fault when the missing pages are touched
+    if (file_size < sizeof(header) + 2 * header.num_points * sizeof(AffineElement)) {
+        return 0;
+    }
+    return header.num_points;
+}
+
+template <typename Curve>
+std::shared_ptr<MmapProverCrs<Curve>> MmapProverCrs<Curve>::open(std::string const& filename, size_t num_points)
+{
+#ifdef __wasm__
+    static_cast<void>(filename);
+    static_cast<void>(num_points);
+    return nullptr;
+#else
+    if (get_file_num_points(filename) < num_points) {
+        return nullptr;
+    }
+    return std::make_shared<MmapProverCrs>(filename, num_points);
+#endif
+}
+
+template <typename Curve>
+MmapProverCrs<Curve>::MmapProverCrs(std::string const& filename, const size_t num_points)
+    : num_points(num_points)
+{
+#ifdef __wasm__
+    static_cast<void>(filename);
+    throw_or_abort("MmapProverCrs is not supported in WASM builds.");
+#else
+    const size_t file_num_points = get_file_num_points(filename);
+    if (file_num_points < num_points) {
+        throw_or_abort(format("Pre-converted CRS file ",
+                              filename,
+                              " holds ",
+                              file_num_points,
+                              " points, but ",
+                              num_points,
+                              " are required."));
+    }
+
+    // Pippenger may prefetch slightly beyond the end of the point table (see point_table_size), so we reserve an
+    // anonymous region covering the overflow and map the file (read-only) over its start
+    const size_t data_size = sizeof(PointTableFileHeader) + 2 * num_points * sizeof(AffineElement);
+    mapping_size_ = sizeof(PointTableFileHeader) + scalar_multiplication::point_table_buf_size(num_points);
+    mapping_ = mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping_ == MAP_FAILED) {
+        throw_or_abort(format("Failed to reserve ", mapping_size_, " bytes for pre-converted CRS file ", filename));
+    }
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        munmap(mapping_, mapping_size_);
+        throw_or_abort(format("Failed to open pre-converted CRS file ", filename));
+    }
+    void* file_mapping = mmap(mapping_, data_size, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);
+    if (file_mapping == MAP_FAILED) {
+        munmap(mapping_, mapping_size_);
+        throw_or_abort(format("Failed to map pre-converted CRS file ", filename));
+    }
+    points_ = reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(mapping_) + sizeof(PointTableFileHeader));
+    vinfo("Mapped ", Curve::name, " prover CRS of size ", num_points, " from ", filename);
+#endif
+}
+
+template <typename Curve> MmapProverCrs<Curve>::~MmapProverCrs()
+{
+#ifndef __wasm__
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+    }
+#endif
+}
+
+template bool write_point_table_file<curve::BN254>(std::string const& filename,
+                                                   std::span<const curve::BN254::AffineElement> points);
+template bool write_point_table_file<curve::Grumpkin>(std::string const& filename,
+                                                      std::span<const curve::Grumpkin::AffineElement> points);
+
+template class MmapProverCrs<curve::BN254>;
+template class MmapProverCrs<curve::Grumpkin>;
+
+} // namespace bb::srs::factories
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "crs_factory.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace bb::srs::factories {
+
+/**
+ * @brief Header of a pre-converted prover CRS file
+ * @details The header is followed by the pippenger point table of the CRS (the raw points Pᵢ at even indices and the
+ * endomorphism points (β⋅Pᵢ.x, -Pᵢ.y) at odd indices), in the in-memory Montgomery representation. The header is
+ * padded to 64 bytes so that the points are suitably aligned when the file is mapped. As the representation is
+ * native, the file is a local cache of the CRS rather than a portable format.
+ */
+struct PointTableFileHeader {
+    uint64_t magic;
+    uint64_t num_points;
+    uint64_t element_size;
+    char curve_name[16];
+    uint64_t reserved[3];
+};
+static_assert(sizeof(PointTableFileHeader) == 64);
+
+constexpr uint64_t POINT_TABLE_FILE_MAGIC = 0x6262707474626c31; // "bbpttbl1"
+
+/**
+ * @brief Write the pippenger point table of the given CRS points to a pre-converted prover CRS file
+ * @details The file is written under a temporary name and renamed into place, so that concurrent processes never map
+ * a partially written file.
+ *
+ * @return Whether the file could be written
+ */
+template <typename Curve>
+bool write_point_table_file(std::string const& filename, std::span<const typename Curve::AffineElement> points);
+
+/**
+ * @brief A prover CRS backed by a read-only shared mapping of a pre-converted CRS file
+ * @details The points are already in Montgomery form and expanded with their endomorphism images, so construction
+ * only maps the file: pages are faulted in lazily as the MSMs touch them, and all processes mapping the same file
+ * share the same physical pages through the page cache. The points are never written by the provers, so the mapping
+ * is read-only and a stray write faults rather than silently diverging from the file. Files are only ever replaced by
+ * renaming a new file into place, never modified, so a mapping always sees a consistent table.
+ */
+template <typename Curve> class MmapProverCrs : public ProverCrs<Curve> {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+
+    MmapProverCrs(std::string const& filename, size_t num_points);
+    MmapProverCrs(const MmapProverCrs&) = delete;
+    MmapProverCrs& operator=(const MmapProverCrs&) = delete;
+    ~MmapProverCrs() override;
+
+    /**
+     * @brief Map the first num_points points of a pre-converted CRS file, or return nullptr if the file does not exist
+     * or holds too few points
+     */
+    static std::shared_ptr<MmapProverCrs> open(std::string const& filename, size_t num_points);
+
+    /**
+     * @brief The number of points in a pre-converted CRS file, or zero if the file is missing or invalid
+     */
+    static size_t get_file_num_points(std::string const& filename);
+
+    std::span<AffineElement> get_monomial_points() override { return { points_, num_points * 2 }; }
+
+    size_t get_monomial_size() const override { return num_points; }
+
+  private:
+    size_t num_points;
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    AffineElement* points_ = nullptr;
+};
+
+} // namespace bb::srs::factories
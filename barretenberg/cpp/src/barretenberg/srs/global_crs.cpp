@@ -18,6 +18,17 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
     crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point);
 }
 
+void init_crs_factory_with_prover_crs(std::shared_ptr<factories::ProverCrs<curve::BN254>> prover_crs,
+                                      g2::affine_element const g2_point)
+{
+    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(std::move(prover_crs), g2_point);
+}
+
+void init_grumpkin_crs_factory_with_prover_crs(std::shared_ptr<factories::ProverCrs<curve::Grumpkin>> prover_crs)
+{
+    grumpkin_crs_factory = std::make_shared<factories::MemGrumpkinCrsFactory>(std::move(prover_crs));
+}
+
 // Initializes crs from a file path this we use in the entire codebase
 void init_crs_factory(std::string crs_path)
 {
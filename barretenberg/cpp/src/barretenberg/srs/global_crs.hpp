@@ -25,6 +25,11 @@ void init_grumpkin_crs_factory(std::string crs_path);
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
 void init_crs_factory(std::vector<bb::g1::affine_element> const& points, bb::g2::affine_element const g2_point);
 
+// Initializes the crs from an existing prover crs (e.g. a memory-mapped one)
+void init_crs_factory_with_prover_crs(std::shared_ptr<factories::ProverCrs<curve::BN254>> prover_crs,
+                                      bb::g2::affine_element const g2_point);
+void init_grumpkin_crs_factory_with_prover_crs(std::shared_ptr<factories::ProverCrs<curve::Grumpkin>> prover_crs);
+
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory();
 std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
 
@@ -10,6 +10,9 @@
  */
 
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/batch_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/classified_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
@@ -25,7 +28,24 @@ using namespace bb;
 
 namespace {
 auto& engine = numeric::get_debug_randomness();
-}
+
+// Selects a pippenger engine while in scope, restoring the previous one however the scope is left
+class ScopedPippengerEngine {
+  public:
+    ScopedPippengerEngine(scalar_multiplication::PippengerEngine selected)
+        : previous(scalar_multiplication::get_pippenger_engine())
+    {
+        scalar_multiplication::set_pippenger_engine(selected);
+    }
+    ~ScopedPippengerEngine() { scalar_multiplication::set_pippenger_engine(previous); }
+
+    ScopedPippengerEngine(const ScopedPippengerEngine&) = delete;
+    ScopedPippengerEngine& operator=(const ScopedPippengerEngine&) = delete;
+
+  private:
+    scalar_multiplication::PippengerEngine previous;
+};
+} // namespace
 
 template <typename Curve> class ScalarMultiplicationTests : public ::testing::Test {
   public:
@@ -923,6 +943,152 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafe)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerBucketOwnership)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // Not a power of two, so that pippenger splits the MSM into several calls to pippenger_internal
+    constexpr size_t num_points = 5000;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    // Repeated points exercise the doubling edge case of the affine additions
+    for (size_t i = 0; i + 1 < num_points; i += 7) {
+        points.get()[i + 1] = points.get()[i];
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points.get()[i] * scalars[i];
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    ScopedPippengerEngine pippenger_engine(scalar_multiplication::PippengerEngine::BUCKET_OWNERSHIP);
+    Element result =
+        scalar_multiplication::pippenger<Curve>({ 0, scalars }, { points.get(), /*size*/ num_points * 2 }, state);
+    result = result.normalize();
+
+    EXPECT_EQ(result, expected);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerWithScalarClassification)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 5000;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+
+    // Mix of zero, unit, small and full-width scalars, dominated by the cheap classes
+    std::vector<Fr> scalars(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        switch (i % 5) {
+        case 0:
+            scalars[i] = Fr::zero();
+            break;
+        case 1:
+        case 2:
+            scalars[i] = Fr::one();
+            break;
+        case 3:
+            scalars[i] = Fr(engine.get_random_uint16());
+            break;
+        default:
+            // Largest small scalar, or a full-width one
+            scalars[i] = (i % 10 == 4) ? Fr::random_element()
+                                       : Fr((1ULL << scalar_multiplication::SMALL_SCALAR_BITS) - 1);
+            break;
+        }
+    }
+
+    const size_t start_index = 117;
+    std::span<const Fr> scalar_span(&scalars[start_index], num_points - start_index);
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = start_index; i < num_points; ++i) {
+        expected += points.get()[i] * scalars[i];
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    Element result = scalar_multiplication::pippenger_unsafe_with_scalar_classification<Curve>(
+        { start_index, scalar_span }, { points.get(), /*size*/ num_points * 2 }, state);
+    result = result.normalize();
+    EXPECT_EQ(result, expected);
+
+    // A dense polynomial falls back to pippenger over the whole input
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += AffineElement(points.get()[2 * i]) * scalars[i];
+    }
+    expected = expected.normalize();
+    result = scalar_multiplication::pippenger_unsafe_with_scalar_classification<Curve>(
+        { 0, scalars }, { points.get(), /*size*/ num_points * 2 }, state);
+    result = result.normalize();
+    EXPECT_EQ(result, expected);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, FixedBaseMSM)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 3000;
+    constexpr size_t start_index = 45;
+    constexpr size_t window_bits = 12;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    std::vector<Fr> scalars(num_points - 2 * start_index);
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        expected += points.get()[start_index + i] * scalars[i];
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    std::span<const AffineElement> point_table(points.get(), num_points * 2);
+
+    // A full-depth table needs a single pass; shallower tables need several passes with doublings in between
+    const size_t num_windows = scalar_multiplication::get_fixed_base_num_windows(window_bits);
+    for (const size_t depth : { num_windows, 4UL, 1UL }) {
+        auto table =
+            scalar_multiplication::compute_fixed_base_table<Curve>(point_table, num_points, window_bits, depth);
+        Element result = scalar_multiplication::fixed_base_msm<Curve>(table, { start_index, scalars });
+        result = result.normalize();
+        EXPECT_EQ(result, expected);
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
 {
     using Curve = TypeParam;
@@ -1066,3 +1232,63 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, BatchMultiScalarMul)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // MSMs of varying size and offset, sharing a single point table
+    const std::vector<size_t> msm_sizes = { 1, 17, 1000, 0, 4096, 333 };
+    const std::vector<size_t> start_indices = { 0, 5, 100, 0, 0, 2000 };
+    constexpr size_t num_points = 5000;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+
+    std::vector<std::vector<Fr>> scalars(msm_sizes.size());
+    std::vector<AffineElement> expected;
+    for (size_t j = 0; j < msm_sizes.size(); ++j) {
+        Element accumulator;
+        accumulator.self_set_infinity();
+        for (size_t i = 0; i < msm_sizes[j]; ++i) {
+            scalars[j].emplace_back(Fr::random_element());
+            accumulator += points.get()[start_indices[j] + i] * scalars[j].back();
+        }
+        expected.emplace_back(accumulator);
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    std::vector<std::span<const AffineElement>> point_tables(msm_sizes.size(), { points.get(), num_points * 2 });
+    std::vector<PolynomialSpan<const Fr>> scalar_spans;
+    for (size_t j = 0; j < msm_sizes.size(); ++j) {
+        scalar_spans.emplace_back(start_indices[j], scalars[j]);
+    }
+    std::vector<AffineElement> result =
+        scalar_multiplication::batch_multi_scalar_mul<Curve>(point_tables, scalar_spans);
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(ScalarMultiplicationWorkUnits, BatchMSMWorkUnits)
+{
+    const std::vector<size_t> msm_sizes = { 10, 3, 0, 7 };
+    const auto work_units = scalar_multiplication::get_batch_msm_work_units(msm_sizes, 4);
+
+    // 20 scalars over 4 threads: each thread receives exactly 5 scalars and every scalar is covered once
+    std::vector<size_t> covered(msm_sizes.size(), 0);
+    for (const auto& thread_units : work_units) {
+        size_t thread_size = 0;
+        for (const auto& unit : thread_units) {
+            EXPECT_EQ(unit.start, covered[unit.msm_index]);
+            covered[unit.msm_index] = unit.end;
+            thread_size += unit.end - unit.start;
+        }
+        EXPECT_EQ(thread_size, 5UL);
+    }
+    EXPECT_EQ(covered, msm_sizes);
+}
@@ -184,6 +184,15 @@ class UltraFlavor {
         auto get_sigmas() { return RefArray{ sigma_1, sigma_2, sigma_3, sigma_4 }; };
         auto get_ids() { return RefArray{ id_1, id_2, id_3, id_4 }; };
         auto get_tables() { return RefArray{ table_1, table_2, table_3, table_4 }; };
+
+        // The precomputed polynomials whose values are all small (selector-like), see
+        // CommitmentKey::commit_low_weight, and the remaining full-width ones. Together they cover all of them.
+        auto get_low_weight() { return concatenate(get_gate_selectors(), RefArray{ lagrange_first, lagrange_last }); }
+        auto get_full_width()
+        {
+            return concatenate(
+                get_non_gate_selectors(), get_sigmas(), get_ids(), RefArray{ table_1, table_2, table_3, table_4 });
+        }
     };
 
     /**
@@ -374,8 +383,14 @@ class UltraFlavor {
             if (proving_key.commitment_key == nullptr) {
                 proving_key.commitment_key = std::make_shared<CommitmentKey>(proving_key.circuit_size);
             }
-            for (auto [polynomial, commitment] : zip_view(proving_key.polynomials.get_precomputed(), this->get_all())) {
-                commitment = proving_key.commitment_key->commit(polynomial);
+            auto& ck = proving_key.commitment_key;
+            for (auto [polynomial, commitment] :
+                 zip_view(proving_key.polynomials.get_low_weight(), this->get_low_weight())) {
+                commitment = ck->commit_low_weight(polynomial);
+            }
+            for (auto [polynomial, commitment] :
+                 zip_view(proving_key.polynomials.get_full_width(), this->get_full_width())) {
+                commitment = ck->commit(polynomial);
             }
         }
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/964): Clean the boilerplate
@@ -0,0 +1,90 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include <algorithm>
+#include <span>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief The prover polynomials partially evaluated at the first \f$ k \f$ sumcheck challenges, computed on access
+ * from the full polynomials rather than stored
+ * @details Row \f$ i \f$ of the partial evaluation of \f$ P \f$ at \f$ (u_0, \ldots, u_{k-1}) \f$ is
+ * \f{align}{ P(u_0, \ldots, u_{k-1}, \vec i) = \sum_{b \in \{0,1\}^k} eq(u, b) \cdot P_{2^k i + b}, \f}
+ * where bit \f$ j \f$ of \f$ b \f$ is paired with \f$ u_j \f$. This is what \ref bb::SumcheckProver::partially_evaluate
+ * "partially evaluate" stores after \f$ k \f$ rounds, at the cost of \f$ 2^k \f$ multiplications per access instead of
+ * \f$ 2^{d-k} \f$ stored rows per polynomial. Provides the get_all() / operator[] / end_index() interface that
+ * SumcheckProverRound::compute_univariate uses. The full polynomials must outlive this object.
+ */
+template <typename Flavor> class StreamedMultivariates {
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+  public:
+    class Column {
+      public:
+        Column(const Polynomial& polynomial, std::span<const FF> weights)
+            : polynomial(&polynomial)
+            , weights(weights)
+            , log_num_folded(static_cast<size_t>(numeric::get_msb(weights.size())))
+        {}
+
+        FF operator[](size_t row) const
+        {
+            const size_t start = row << log_num_folded;
+            // Only the rows within the memory of the polynomial are non-zero
+            const size_t begin = std::max(start, polynomial->start_index());
+            const size_t end = std::min(start + weights.size(), polynomial->end_index());
+            FF result(0);
+            for (size_t full_row = begin; full_row < end; ++full_row) {
+                result += weights[full_row - start] * (*polynomial)[full_row];
+            }
+            return result;
+        }
+
+        size_t end_index() const { return (polynomial->end_index() + weights.size() - 1) >> log_num_folded; }
+
+      private:
+        const Polynomial* polynomial;
+        std::span<const FF> weights;
+        size_t log_num_folded;
+    };
+
+    StreamedMultivariates(const ProverPolynomials& full_polynomials, std::span<const FF> challenges)
+        : weights(1, FF(1))
+    {
+        // weights[b] = eq(challenges, b), built one challenge (i.e. one bit of b) at a time
+        weights.resize(size_t(1) << challenges.size());
+        for (size_t j = 0; j < challenges.size(); ++j) {
+            const size_t half = size_t(1) << j;
+            for (size_t b = 0; b < half; ++b) {
+                weights[b + half] = weights[b] * challenges[j];
+                weights[b] -= weights[b + half];
+            }
+        }
+
+        for (const auto& polynomial : full_polynomials.get_all()) {
+            columns.emplace_back(polynomial, weights);
+        }
+    }
+
+    // The weights are referenced by the columns
+    StreamedMultivariates(const StreamedMultivariates&) = delete;
+    StreamedMultivariates& operator=(const StreamedMultivariates&) = delete;
+
+    std::span<const Column> get_all() const { return columns; }
+
+  private:
+    std::vector<FF> weights;
+    std::vector<Column> columns;
+};
+
+} // namespace bb
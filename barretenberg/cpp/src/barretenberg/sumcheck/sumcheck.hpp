@@ -7,6 +7,7 @@
 #pragma once
 #include "barretenberg/plonk_honk_shared/library/grand_product_delta.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include "barretenberg/sumcheck/streamed_multivariates.hpp"
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
@@ -71,6 +72,13 @@ More precisely, it is a table with \f$ 2^{d-1} \f$ rows and \f$ N \f$ columns, s
 (P_j(1,i_1,\ldots, i_{d-1})) - P_j(0, i_1,\ldots, i_{d-1})) \\ = &\ \texttt{full_polynomials}_{2 i,j} + u_0 \cdot
 (\texttt{full_polynomials}_{2i+1,j} - \texttt{full_polynomials}_{2 i,j}) \f}
 
+### Memory-Bounded Mode
+The table takes \f$ N \cdot n/2 \f$ field elements. When the prover is given a memory budget that the table exceeds,
+the first \f$ k \f$ rounds, for the smallest \f$ k \f$ such that the table of \f$ n/2^k \f$ rows fits the budget, read
+the evaluations \f$ P_j(u_0, \ldots, u_{i-1}, \vec \ell) \f$ from the \ref bb::StreamedMultivariates "full
+polynomials" instead, computing each as a combination of \f$ 2^i \f$ of their rows. The table is populated after Round
+\f$ k-1 \f$ with \f$ 2^{d-k} \f$ rows.
+
 ### Updating Partial Evaluations in Subsequent Rounds
 In Round \f$ i < d-1\f$, \ref partially_evaluate "partially evaluate" updates the first \f$ 2^{d-1 - i} \f$ rows of
 \f$\texttt{partially_evaluated_polynomials}\f$ with the evaluations \f$ P_1(u_0,\ldots, u_i, \vec \ell),\ldots,
@@ -172,12 +180,19 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+
+    // The maximum size in bytes of #partially_evaluated_polynomials, or 0 for no bound (see "Memory-Bounded Mode")
+    const size_t partially_evaluated_memory_budget;
+
     // prover instantiates sumcheck with circuit size and a prover transcript
-    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
+    SumcheckProver(size_t multivariate_n,
+                   const std::shared_ptr<Transcript>& transcript,
+                   size_t partially_evaluated_memory_budget = 0)
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
-        , round(multivariate_n){};
+        , round(multivariate_n)
+        , partially_evaluated_memory_budget(partially_evaluated_memory_budget){};
 
     /**
      * @brief Non-ZK version: Compute round univariate, place it in transcript, compute challenge, partially evaluate.
@@ -197,30 +212,34 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
         bb::GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
 
         multivariate_challenge.reserve(multivariate_d);
-        // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
-        // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns. When the Flavor has ZK,
-        // compute_univariate also takes into account the zk_sumcheck_data.
-        auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, gate_separators, alpha);
-        // Initialize the partially evaluated polynomials which will be used in the following rounds.
-        // This will use the information in the structured full polynomials to save memory if possible.
-        partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, multivariate_n);
-
+        const size_t num_streamed_rounds = compute_num_streamed_rounds(full_polynomials);
+        // In the first round(s), we compute the univariate polynomial from the full polynomials and then populate the
+        // book-keeping table of #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns (or
+        // \f$ n/2^k \f$ rows after \f$ k \f$ streamed rounds).
         vinfo("starting sumcheck rounds...");
-        {
-            PROFILE_THIS_NAME("rest of sumcheck round 1");
+        SumcheckRoundUnivariate round_univariate;
+        for (size_t round_idx = 0; round_idx < num_streamed_rounds; round_idx++) {
+            PROFILE_THIS_NAME("streamed sumcheck round");
 
+            if (round_idx == 0) {
+                round_univariate =
+                    round.compute_univariate(full_polynomials, relation_parameters, gate_separators, alpha);
+            } else {
+                StreamedMultivariates<Flavor> streamed_polynomials(full_polynomials, multivariate_challenge);
+                round_univariate =
+                    round.compute_univariate(streamed_polynomials, relation_parameters, gate_separators, alpha);
+            }
             // Place the evaluations of the round univariate into transcript.
-            transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
-            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
+            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
-            // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, round_challenge);
             gate_separators.partially_evaluate(round_challenge);
-            round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-            // release memory?        // All but final round
-            // We operate on partially_evaluated_polynomials in place.
+            round.round_size = round.round_size >> 1;
         }
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        // Prepare sumcheck book-keeping table for the next round
+        populate_partially_evaluated_polynomials(full_polynomials);
+
+        for (size_t round_idx = num_streamed_rounds; round_idx < multivariate_d; round_idx++) {
             PROFILE_THIS_NAME("sumcheck loop");
 
             // Write the round univariate to the transcript
@@ -291,28 +310,37 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
         bb::GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
 
         multivariate_challenge.reserve(multivariate_d);
-        size_t round_idx = 0;
-        // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
-        // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns. When the Flavor has ZK,
-        // compute_univariate also takes into account the zk_sumcheck_data.
-        auto round_univariate = round.compute_univariate(round_idx,
-                                                         full_polynomials,
-                                                         relation_parameters,
-                                                         gate_separators,
-                                                         alpha,
-                                                         zk_sumcheck_data,
-                                                         row_disabling_polynomial);
-        // Initialize the partially evaluated polynomials which will be used in the following rounds.
-        // This will use the information in the structured full polynomials to save memory if possible.
-        partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, multivariate_n);
-
+        const size_t num_streamed_rounds = compute_num_streamed_rounds(full_polynomials);
+        // In the first round(s), we compute the univariate polynomial from the full polynomials and then populate the
+        // book-keeping table of #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns (or
+        // \f$ n/2^k \f$ rows after \f$ k \f$ streamed rounds). When the Flavor has ZK, compute_univariate also takes
+        // into account the zk_sumcheck_data.
         vinfo("starting sumcheck rounds...");
-        {
-            PROFILE_THIS_NAME("rest of sumcheck round 1");
-
+        SumcheckRoundUnivariate round_univariate;
+        for (size_t round_idx = 0; round_idx < num_streamed_rounds; round_idx++) {
+            PROFILE_THIS_NAME("streamed sumcheck round");
+
+            if (round_idx == 0) {
+                round_univariate = round.compute_univariate(round_idx,
+                                                            full_polynomials,
+                                                            relation_parameters,
+                                                            gate_separators,
+                                                            alpha,
+                                                            zk_sumcheck_data,
+                                                            row_disabling_polynomial);
+            } else {
+                StreamedMultivariates<Flavor> streamed_polynomials(full_polynomials, multivariate_challenge);
+                round_univariate = round.compute_univariate(round_idx,
+                                                            streamed_polynomials,
+                                                            relation_parameters,
+                                                            gate_separators,
+                                                            alpha,
+                                                            zk_sumcheck_data,
+                                                            row_disabling_polynomial);
+            }
             if constexpr (!IsGrumpkinFlavor<Flavor>) {
                 // Place the evaluations of the round univariate into transcript.
-                transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
+                transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
             } else {
 
                 // Compute monomial coefficients of the round univariate, commit to it, populate an auxiliary structure
@@ -321,20 +349,20 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
                     round_idx, round_univariate, eval_domain, transcript, ck, round_univariates, round_evaluations);
             }
 
-            const FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
+            const FF round_challenge =
+                transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
 
             multivariate_challenge.emplace_back(round_challenge);
-            // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, round_challenge);
             // Prepare ZK Sumcheck data for the next round
             zk_sumcheck_data.update_zk_sumcheck_data(round_challenge, round_idx);
             row_disabling_polynomial.update_evaluations(round_challenge, round_idx);
             gate_separators.partially_evaluate(round_challenge);
-            round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                      // release memory?        // All but final round
-                                                      // We operate on partially_evaluated_polynomials in place.
+            round.round_size = round.round_size >> 1;
         }
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        // Prepare sumcheck book-keeping table for the next round
+        populate_partially_evaluated_polynomials(full_polynomials);
+
+        for (size_t round_idx = num_streamed_rounds; round_idx < multivariate_d; round_idx++) {
 
             PROFILE_THIS_NAME("sumcheck loop");
 
@@ -500,6 +528,57 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
         });
     };
 
+    /**
+     * @brief The number of rounds computed from the full polynomials: 1, or, under a memory budget, the smallest number
+     * \f$ k \f$ for which #partially_evaluated_polynomials with \f$ n/2^k \f$ rows fits the budget
+     */
+    size_t compute_num_streamed_rounds(const ProverPolynomials& full_polynomials) const
+    {
+        if (partially_evaluated_memory_budget == 0) {
+            return 1;
+        }
+        size_t num_rounds = 1;
+        for (; num_rounds < multivariate_d; num_rounds++) {
+            const size_t num_folded_rows = size_t(1) << num_rounds;
+            size_t table_size = 0;
+            for (const auto& poly : full_polynomials.get_all()) {
+                table_size += (poly.end_index() + num_folded_rows - 1) / num_folded_rows * sizeof(FF);
+            }
+            if (table_size <= partially_evaluated_memory_budget) {
+                break;
+            }
+        }
+        vinfo("sumcheck streams ", num_rounds, " rounds from the full polynomials");
+        return num_rounds;
+    }
+
+    /**
+     * @brief Populate #partially_evaluated_polynomials with the partial evaluations of the full polynomials at the
+     * challenges of the rounds computed so far
+     */
+    void populate_partially_evaluated_polynomials(const ProverPolynomials& full_polynomials)
+    {
+        const size_t num_rounds = multivariate_challenge.size();
+        if (num_rounds == 1) {
+            // Initialize the partially evaluated polynomials which will be used in the following rounds.
+            // This will use the information in the structured full polynomials to save memory if possible.
+            partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, multivariate_n);
+            partially_evaluate(full_polynomials, multivariate_challenge[0]);
+            return;
+        }
+        StreamedMultivariates<Flavor> streamed_polynomials(full_polynomials, multivariate_challenge);
+        auto pep_view = partially_evaluated_polynomials.get_all();
+        auto streamed_view = streamed_polynomials.get_all();
+        parallel_for(streamed_view.size(), [&](size_t j) {
+            const auto& column = streamed_view[j];
+            const size_t size = column.end_index();
+            pep_view[j] = Polynomial<FF>(size, multivariate_n >> num_rounds, 0, Polynomial<FF>::DontZeroMemory::FLAG);
+            for (size_t i = 0; i < size; i++) {
+                pep_view[j].at(i) = column[i];
+            }
+        });
+    }
+
     /**
      * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
      * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$.
@@ -167,8 +167,57 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    // Check that computing the first rounds from the full polynomials, as the prover does under a memory budget,
+    // produces the same proof as computing them from the partially evaluated polynomials
+    void test_memory_budget()
+    {
+        const size_t multivariate_d(6);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        std::vector<bb::Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (auto& poly : random_polynomials) {
+            poly = random_poly(multivariate_n);
+        }
+        // A polynomial shorter than the hypercube, and one of odd length, as in structured traces
+        for (const size_t idx : { 0UL, 1UL }) {
+            const size_t size = idx == 0 ? multivariate_n / 4 : multivariate_n / 2 + 3;
+            random_polynomials[idx] = bb::Polynomial<FF>(size, multivariate_n);
+            for (auto& coeff : random_polynomials[idx].coeffs()) {
+                coeff = FF::random_element();
+            }
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        RelationParameters<FF> relation_parameters{
+            .beta = FF::random_element(),
+            .gamma = FF::random_element(),
+            .public_input_delta = FF::one(),
+        };
+        auto prove = [&](size_t memory_budget) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript, memory_budget);
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+            return transcript->export_proof();
+        };
+
+        const auto expected_proof = prove(/*memory_budget=*/0);
+        // A table of n/8 rows fits, so 3 rounds are streamed
+        EXPECT_EQ(prove(NUM_POLYNOMIALS * (multivariate_n / 8) * sizeof(FF)), expected_proof);
+        // Nothing fits, so all rounds are streamed
+        EXPECT_EQ(prove(1), expected_proof);
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
-    void test_prover_verifier_flow()
+    void test_prover_verifier_flow(size_t memory_budget = 0)
     {
         const size_t multivariate_d(3);
         const size_t multivariate_n(1 << multivariate_d);
@@ -242,7 +291,7 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
             .public_input_delta = FF::one(),
         };
         auto prover_transcript = Flavor::Transcript::prover_init_empty();
-        auto sumcheck_prover = SumcheckProver<Flavor, multivariate_d>(multivariate_n, prover_transcript);
+        auto sumcheck_prover = SumcheckProver<Flavor, multivariate_d>(multivariate_n, prover_transcript, memory_budget);
 
         RelationSeparator prover_alpha;
         for (size_t idx = 0; idx < prover_alpha.size(); idx++) {
@@ -415,6 +464,19 @@ TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
     this->test_prover_verifier_flow();
 }
+// Tests the prover-verifier flow with all rounds computed from the full polynomials
+TYPED_TEST(SumcheckTests, ProverAndVerifierMemoryBudget)
+{
+    this->test_prover_verifier_flow(/*memory_budget=*/1);
+}
+TYPED_TEST(SumcheckTests, MemoryBudget)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_memory_budget();
+    } else {
+        GTEST_SKIP() << "The Libra masking of ZK flavors is randomised, see ProverAndVerifierMemoryBudget";
+    }
+}
 // This tests is fed an invalid circuit and checks that the verifier would output false.
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimpleFailure)
 {
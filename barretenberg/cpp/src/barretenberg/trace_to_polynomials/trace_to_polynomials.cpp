@@ -19,14 +19,15 @@ namespace bb {
 template <class Flavor>
 void TraceToPolynomials<Flavor>::populate(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured)
+                                          bool is_structured,
+                                          bool populate_precomputed)
 {
 
     PROFILE_THIS_NAME("trace populate");
 
     // Share wire polynomials, selector polynomials between proving key and builder and copy cycles from raw circuit
     // data
-    auto trace_data = construct_trace_data(builder, proving_key, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key, is_structured, populate_precomputed);
 
     if constexpr (IsUltraOrMegaHonk<Flavor>) {
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
@@ -46,7 +47,7 @@ void TraceToPolynomials<Flavor>::populate(Builder& builder,
     }
 
     // Compute the permutation argument polynomials (sigma/id) and add them to proving key
-    {
+    if (populate_precomputed) {
 
         PROFILE_THIS_NAME("compute_permutation_argument_polynomials");
 
@@ -75,12 +76,12 @@ void TraceToPolynomials<Flavor>::add_memory_records_to_proving_key(TraceData& tr
 
 template <class Flavor>
 typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::construct_trace_data(
-    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured, bool populate_precomputed)
 {
 
     PROFILE_THIS_NAME("construct_trace_data");
 
-    TraceData trace_data{ builder, proving_key };
+    TraceData trace_data{ builder, proving_key, populate_precomputed };
 
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
     // For each block in the trace, populate wire polys, copy cycles and selector polys
@@ -110,14 +111,16 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
                     // Insert the real witness values from this block into the wire polys at the correct offset
                     trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
                     // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
+                    if (populate_precomputed) {
+                        trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
+                    }
                 }
             }
         }
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
+        for (size_t selector_idx = 0; populate_precomputed && selector_idx < NUM_SELECTORS; selector_idx++) {
             auto& selector = block.selectors[selector_idx];
             for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
                 size_t trace_row_idx = row_idx + offset;
@@ -32,7 +32,7 @@ template <class Flavor> class TraceToPolynomials {
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
-        TraceData(Builder& builder, ProvingKey& proving_key)
+        TraceData(Builder& builder, ProvingKey& proving_key, bool populate_precomputed = true)
         {
 
             PROFILE_THIS_NAME("TraceData constructor");
@@ -42,8 +42,11 @@ template <class Flavor> class TraceToPolynomials {
                 for (auto [wire, other_wire] : zip_view(wires, proving_key.polynomials.get_wires())) {
                     wire = other_wire.share();
                 }
-                for (auto [selector, other_selector] : zip_view(selectors, proving_key.polynomials.get_selectors())) {
-                    selector = other_selector.share();
+                if (populate_precomputed) {
+                    for (auto [selector, other_selector] :
+                         zip_view(selectors, proving_key.polynomials.get_selectors())) {
+                        selector = other_selector.share();
+                    }
                 }
             } else {
                 // Initialize and share the wire and selector polynomials
@@ -63,7 +66,7 @@ template <class Flavor> class TraceToPolynomials {
                     }
                 }
             }
-            {
+            if (populate_precomputed) {
                 PROFILE_THIS_NAME("copy cycle initialization");
 
                 copy_cycles.resize(builder.variables.size());
@@ -81,8 +84,13 @@ template <class Flavor> class TraceToPolynomials {
      *
      * @param builder
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to construct the selector and sigma/id polynomials. These depend only on the
+     * circuit structure, so they can be skipped when the proving key already holds them (e.g. loaded from a cache).
      */
-    static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
+    static void populate(Builder& builder,
+                         ProvingKey&,
+                         bool is_structured = false,
+                         bool populate_precomputed = true);
 
   private:
     /**
@@ -108,11 +116,13 @@ template <class Flavor> class TraceToPolynomials {
      * @param builder
      * @param dyadic_circuit_size
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to construct the selector polynomials and copy cycles
      * @return TraceData
      */
     static TraceData construct_trace_data(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured = false);
+                                          bool is_structured = false,
+                                          bool populate_precomputed = true);
 
     /**
      * @brief Construct and add the goblin ecc op wires to the proving key
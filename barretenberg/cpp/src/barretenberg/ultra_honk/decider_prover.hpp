@@ -58,6 +58,9 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProver_ {
 
     SumcheckOutput<Flavor> sumcheck_output;
 
+    // Memory budget in bytes of the sumcheck partially evaluated polynomials, unbounded if 0 (see SumcheckProver)
+    size_t sumcheck_memory_budget = 0;
+
   private:
     HonkProof proof;
 };
@@ -97,7 +97,7 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProvingKey_<Flavor>::allocate_se
 }
 
 template <IsUltraOrMegaHonk Flavor>
-void DeciderProvingKey_<Flavor>::allocate_table_lookup_polynomials(const Circuit& circuit)
+void DeciderProvingKey_<Flavor>::allocate_table_lookup_polynomials(const Circuit& circuit, bool allocate_tables)
 {
     PROFILE_THIS_NAME("allocate_table_lookup_and_lookup_read_polynomials");
 
@@ -107,7 +107,7 @@ void DeciderProvingKey_<Flavor>::allocate_table_lookup_polynomials(const Circuit
     ASSERT(dyadic_circuit_size > max_tables_size);
 
     // Allocate the polynomials containing the actual table data
-    if constexpr (IsUltraOrMegaHonk<Flavor>) {
+    if (allocate_tables) {
         for (auto& poly : proving_key.polynomials.get_tables()) {
             poly = Polynomial(max_tables_size, dyadic_circuit_size, table_offset);
         }
@@ -130,6 +130,34 @@ void DeciderProvingKey_<Flavor>::allocate_table_lookup_polynomials(const Circuit
         Polynomial(lookup_inverses_end - lookup_inverses_start, dyadic_circuit_size, lookup_inverses_start);
 }
 
+/**
+ * @brief Share the given precomputed polynomials into the proving key
+ * @details The polynomials must have been constructed for the same circuit. Polynomials of a different dyadic size,
+ * e.g. from a stale cache entry, are not shared at all.
+ *
+ * @return Whether the polynomials were shared
+ */
+template <IsUltraOrMegaHonk Flavor>
+bool DeciderProvingKey_<Flavor>::share_precomputed_polynomials(PrecomputedPolynomials& precomputed_polynomials)
+{
+    PROFILE_THIS_NAME("share_precomputed_polynomials");
+
+    for (auto& precomputed_poly : precomputed_polynomials.get_all()) {
+        if (precomputed_poly.virtual_size() != dyadic_circuit_size) {
+            info("Ignoring precomputed polynomials of size ",
+                 precomputed_poly.virtual_size(),
+                 " for a circuit of size ",
+                 dyadic_circuit_size);
+            return false;
+        }
+    }
+    for (auto [poly, precomputed_poly] :
+         zip_view(proving_key.polynomials.get_precomputed(), precomputed_polynomials.get_all())) {
+        poly = precomputed_poly.share();
+    }
+    return true;
+}
+
 template <IsUltraOrMegaHonk Flavor>
 void DeciderProvingKey_<Flavor>::allocate_ecc_op_polynomials(const Circuit& circuit)
     requires IsMegaFlavor<Flavor>
@@ -46,6 +46,7 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
   public:
     using Trace = TraceToPolynomials<Flavor>;
+    using PrecomputedPolynomials = typename Flavor::template PrecomputedEntities<Polynomial>;
 
     ProvingKey proving_key;
 
@@ -60,15 +61,29 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
     size_t overflow_size{ 0 }; // size of the structured execution trace overflow
 
+    /**
+     * @brief Construct the proving key of a circuit
+     *
+     * @param precomputed_polynomials Optionally, the precomputed (witness-independent) polynomials of the circuit, e.g.
+     * loaded from a cache. The proving key shares their memory instead of constructing the selectors, the sigma/id
+     * polynomials, the lookup tables and the lagrange polynomials. Supported for Ultra flavors only. Polynomials of a
+     * different dyadic size are ignored and the proving key is constructed as if none were given.
+     */
     DeciderProvingKey_(Circuit& circuit,
                        TraceSettings trace_settings = {},
-                       std::shared_ptr<CommitmentKey> commitment_key = nullptr)
+                       std::shared_ptr<CommitmentKey> commitment_key = nullptr,
+                       std::shared_ptr<PrecomputedPolynomials> precomputed_polynomials = nullptr)
         : is_structured(trace_settings.structure.has_value())
     {
         PROFILE_THIS_NAME("DeciderProvingKey(Circuit&)");
         vinfo("Constructing DeciderProvingKey");
         auto start = std::chrono::steady_clock::now();
 
+        bool has_precomputed = precomputed_polynomials != nullptr;
+        if constexpr (IsMegaFlavor<Flavor>) {
+            ASSERT(!has_precomputed && "Precomputed polynomials are not supported for Mega flavors.");
+        }
+
         circuit.finalize_circuit(/* ensure_nonzero = */ true);
 
         // If using a structured trace, set fixed block sizes, check their validity, and set the dyadic circuit size
@@ -108,16 +123,28 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
             if ((IsMegaFlavor<Flavor> && !is_structured) || (is_structured && circuit.blocks.has_overflow)) {
                 // Allocate full size polynomials
                 proving_key.polynomials = typename Flavor::ProverPolynomials(dyadic_circuit_size);
+                if (has_precomputed) {
+                    has_precomputed = share_precomputed_polynomials(*precomputed_polynomials);
+                }
             } else { // Allocate only a correct amount of memory for each polynomial
                 allocate_wires();
 
-                allocate_permutation_argument_polynomials();
+                if (has_precomputed) {
+                    has_precomputed = share_precomputed_polynomials(*precomputed_polynomials);
+                }
+                if (has_precomputed) {
+                    proving_key.polynomials.z_perm = Polynomial::shiftable(proving_key.circuit_size);
+                } else {
+                    allocate_permutation_argument_polynomials();
 
-                allocate_selectors(circuit);
+                    allocate_selectors(circuit);
+                }
 
-                allocate_table_lookup_polynomials(circuit);
+                allocate_table_lookup_polynomials(circuit, /*allocate_tables=*/!has_precomputed);
 
-                allocate_lagrange_polynomials();
+                if (!has_precomputed) {
+                    allocate_lagrange_polynomials();
+                }
 
                 if constexpr (IsMegaFlavor<Flavor>) {
                     allocate_ecc_op_polynomials(circuit);
@@ -133,7 +160,7 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         vinfo("populating trace...");
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured, /*populate_precomputed=*/!has_precomputed);
 
         {
             PROFILE_THIS_NAME("constructing prover instance after trace populate");
@@ -145,11 +172,11 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                 construct_databus_polynomials(circuit);
             }
         }
-        // Set the lagrange polynomials
-        proving_key.polynomials.lagrange_first.at(0) = 1;
-        proving_key.polynomials.lagrange_last.at(final_active_wire_idx) = 1;
+        if (!has_precomputed) {
+            // Set the lagrange polynomials
+            proving_key.polynomials.lagrange_first.at(0) = 1;
+            proving_key.polynomials.lagrange_last.at(final_active_wire_idx) = 1;
 
-        {
             PROFILE_THIS_NAME("constructing lookup table polynomials");
 
             construct_lookup_table_polynomials<Flavor>(
@@ -261,7 +288,9 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
     void allocate_selectors(const Circuit&);
 
-    void allocate_table_lookup_polynomials(const Circuit&);
+    void allocate_table_lookup_polynomials(const Circuit&, bool allocate_tables = true);
+
+    bool share_precomputed_polynomials(PrecomputedPolynomials& precomputed_polynomials);
 
     void allocate_ecc_op_polynomials(const Circuit&)
         requires IsMegaFlavor<Flavor>;
@@ -48,17 +48,22 @@ MergeProver::MergeProof MergeProver::construct_proof()
 
     transcript->send_to_verifier("subtable_size", static_cast<uint32_t>(current_subtable_size));
 
-    // Compute/get commitments [t^{shift}], [T_prev], and [T] and add to transcript
+    // Compute commitments [t^{shift}], [T_prev], and [T] in a single batch
+    std::vector<PolynomialSpan<const FF>> polynomials_to_commit;
+    polynomials_to_commit.reserve(3 * NUM_WIRES);
     for (size_t idx = 0; idx < NUM_WIRES; ++idx) {
-        // Compute commitments
-        Commitment t_commitment = pcs_commitment_key->commit(t_current[idx]);
-        Commitment T_prev_commitment = pcs_commitment_key->commit(T_prev[idx]);
-        Commitment T_commitment = pcs_commitment_key->commit(T_current[idx]);
+        polynomials_to_commit.emplace_back(t_current[idx]);
+        polynomials_to_commit.emplace_back(T_prev[idx]);
+        polynomials_to_commit.emplace_back(T_current[idx]);
+    }
+    std::vector<Commitment> commitments = pcs_commitment_key->batch_commit(polynomials_to_commit);
 
+    // Add the commitments to the transcript
+    for (size_t idx = 0; idx < NUM_WIRES; ++idx) {
         std::string suffix = std::to_string(idx);
-        transcript->send_to_verifier("t_CURRENT_" + suffix, t_commitment);
-        transcript->send_to_verifier("T_PREV_" + suffix, T_prev_commitment);
-        transcript->send_to_verifier("T_CURRENT_" + suffix, T_commitment);
+        transcript->send_to_verifier("t_CURRENT_" + suffix, commitments[3 * idx]);
+        transcript->send_to_verifier("T_PREV_" + suffix, commitments[3 * idx + 1]);
+        transcript->send_to_verifier("T_CURRENT_" + suffix, commitments[3 * idx + 2]);
     }
 
     // Compute evaluations T_j(\kappa), T_{j,prev}(\kappa), t_j(\kappa), add to transcript. For each polynomial we add a
@@ -121,13 +121,16 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commit
         // Commit to Goblin ECC op wires.
         // To avoid possible issues with the current work on the merge protocol, they are not
         // masked in MegaZKFlavor
-        for (auto [polynomial, label] :
-             zip_view(proving_key->proving_key.polynomials.get_ecc_op_wires(), commitment_labels.get_ecc_op_wires())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
-                transcript->send_to_verifier(domain_separator + label,
-                                             proving_key->proving_key.commitment_key->commit(polynomial));
-            };
+        {
+            PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
+            std::vector<PolynomialSpan<const FF>> ecc_op_wires;
+            for (auto& polynomial : proving_key->proving_key.polynomials.get_ecc_op_wires()) {
+                ecc_op_wires.emplace_back(polynomial);
+            }
+            auto commitments = proving_key->proving_key.commitment_key->batch_commit(ecc_op_wires);
+            for (auto [commitment, label] : zip_view(commitments, commitment_labels.get_ecc_op_wires())) {
+                transcript->send_to_verifier(domain_separator + label, commitment);
+            }
         }
 
         // Commit to DataBus related polynomials
@@ -162,11 +165,11 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_sorted_list
         PROFILE_THIS_NAME("COMMIT::lookup_counts_tags");
         commit_to_witness_polynomial(proving_key->proving_key.polynomials.lookup_read_counts,
                                      commitment_labels.lookup_read_counts,
-                                     CommitmentKey::CommitType::Sparse);
+                                     CommitmentKey::CommitType::LowWeight);
 
         commit_to_witness_polynomial(proving_key->proving_key.polynomials.lookup_read_tags,
                                      commitment_labels.lookup_read_tags,
-                                     CommitmentKey::CommitType::Sparse);
+                                     CommitmentKey::CommitType::LowWeight);
     }
     {
         PROFILE_THIS_NAME("COMMIT::wires");
@@ -1064,3 +1064,50 @@ TYPED_TEST(UltraHonkTests, RangeConstraintSmallVariable)
 
     TestFixture::prove_and_verify(circuit_builder, /*expected_result=*/true);
 }
+
+/**
+ * @brief Check that a proving key constructed from the precomputed polynomials of another proving key for the same
+ * circuit structure (e.g. loaded from a cache) produces valid proofs for the VK of the latter
+ */
+TYPED_TEST(UltraHonkTests, PrecomputedPolynomials)
+{
+    using Flavor = TypeParam;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+    using PrecomputedPolynomials = typename DeciderProvingKey::PrecomputedPolynomials;
+
+    // Circuits with the same structure and random witnesses
+    const auto construct_circuit = [&]() {
+        auto builder = UltraCircuitBuilder();
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder);
+        MockCircuits::add_lookup_gates(builder);
+        MockCircuits::add_RAM_gates(builder);
+        TestFixture::set_default_pairing_points_and_ipa_claim_and_proof(builder);
+        return builder;
+    };
+
+    auto builder = construct_circuit();
+    auto proving_key = std::make_shared<DeciderProvingKey>(builder);
+    auto verification_key = std::make_shared<typename TestFixture::VerificationKey>(proving_key->proving_key);
+
+    auto precomputed = std::make_shared<PrecomputedPolynomials>();
+    for (auto [poly, other_poly] :
+         zip_view(precomputed->get_all(), proving_key->proving_key.polynomials.get_precomputed())) {
+        poly = other_poly.share();
+    }
+
+    auto other_builder = construct_circuit();
+    auto other_proving_key = std::make_shared<DeciderProvingKey>(other_builder, TraceSettings{}, nullptr, precomputed);
+    EXPECT_EQ(other_proving_key->proving_key.active_region_data.get_ranges(),
+              proving_key->proving_key.active_region_data.get_ranges());
+
+    typename TestFixture::Prover prover(other_proving_key);
+    auto proof = prover.construct_proof();
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        auto ipa_verification_key = std::make_shared<VerifierCommitmentKey<curve::Grumpkin>>(1 << CONST_ECCVM_LOG_N);
+        typename TestFixture::Verifier verifier(verification_key, ipa_verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof, other_proving_key->proving_key.ipa_proof));
+    } else {
+        typename TestFixture::Verifier verifier(verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+}
@@ -83,6 +83,7 @@ template <IsUltraOrMegaHonk Flavor> HonkProof UltraProver_<Flavor>::construct_pr
     generate_gate_challenges();
 
     DeciderProver_<Flavor> decider_prover(proving_key, transcript);
+    decider_prover.sumcheck_memory_budget = sumcheck_memory_budget;
     decider_prover.construct_proof();
     return export_proof();
 }
@@ -43,6 +43,9 @@ template <IsUltraOrMegaHonk Flavor_> class UltraProver_ {
 
     std::shared_ptr<CommitmentKey> commitment_key;
 
+    // Memory budget in bytes of the sumcheck partially evaluated polynomials, unbounded if 0 (see SumcheckProver)
+    size_t sumcheck_memory_budget = 0;
+
     UltraProver_(const std::shared_ptr<DeciderPK>&, const std::shared_ptr<CommitmentKey>&);
 
     explicit UltraProver_(const std::shared_ptr<DeciderPK>&,
@@ -11,14 +11,14 @@ using namespace bb::avm2::simulation;
 
 std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmAPI::ProvingInputs& inputs)
 {
-    // Simulate.
+    // Simulate. The trace of the most numerous events is generated as they are emitted.
     info("Simulating...");
+    AvmTraceGenHelper tracegen_helper;
     AvmSimulationHelper simulation_helper(inputs.hints);
-    auto events = AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate());
+    auto events = AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate(tracegen_helper.start_streaming()));
 
     // Generate trace.
     info("Generating trace...");
-    AvmTraceGenHelper tracegen_helper;
     auto trace = AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events)));
 
     // Prove.
@@ -32,14 +32,14 @@ std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmA
 
 bool AvmAPI::check_circuit(const AvmAPI::ProvingInputs& inputs)
 {
-    // Simulate.
+    // Simulate. The trace of the most numerous events is generated as they are emitted.
     info("Simulating...");
+    AvmTraceGenHelper tracegen_helper;
     AvmSimulationHelper simulation_helper(inputs.hints);
-    auto events = AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate());
+    auto events = AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate(tracegen_helper.start_streaming()));
 
     // Generate trace.
     info("Generating trace...");
-    AvmTraceGenHelper tracegen_helper;
     auto trace = AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events)));
 
     // Check circuit.
@@ -1,37 +1,66 @@
 #include "barretenberg/vm2/constraining/polynomials.hpp"
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/tooling/stats.hpp"
 
 namespace bb::avm2::constraining {
+namespace {
+
+// Moves a column from the trace into a polynomial, freeing the column.
+// Rows before start_index are not stored and must be zero (the first row of a column to be shifted).
+AvmProver::Polynomial column_to_polynomial(tracegen::TraceContainer& trace, Column col, size_t start_index)
+{
+    const uint32_t num_rows = trace.get_column_rows(col);
+    const size_t allocated_size = num_rows > start_index ? num_rows - start_index : 0;
+
+    // Dense columns already hold their rows contiguously, so the polynomial takes over their memory.
+    std::vector<AvmProver::FF> dense_rows = trace.release_dense_column(col);
+    if (allocated_size > 0 && !dense_rows.empty()) {
+        BB_ASSERT_GTE(dense_rows.size(), static_cast<size_t>(num_rows));
+        for (size_t row = 0; row < start_index; ++row) {
+            BB_ASSERT_EQ(dense_rows[row], AvmProver::FF::zero());
+        }
+        auto owner = std::make_shared<std::vector<AvmProver::FF>>(std::move(dense_rows));
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<AvmProver::FF[]> memory(owner, owner->data() + start_index);
+        return AvmProver::Polynomial::from_backing_memory(
+            std::move(memory), allocated_size, CIRCUIT_SUBGROUP_SIZE, start_index);
+    }
+
+    // Sparse columns are copied over.
+    auto poly =
+        AvmProver::Polynomial::create_non_parallel_zero_init(allocated_size, CIRCUIT_SUBGROUP_SIZE, start_index);
+    trace.visit_column(col, [&](size_t row, const AvmProver::FF& value) {
+        // We use `at` because we are sure the row exists and the value is non-zero.
+        poly.at(row) = value;
+    });
+    // We free columns as we go.
+    trace.clear_column(col);
+    return poly;
+}
+
+} // namespace
 
 AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace)
 {
     AvmProver::ProverPolynomials polys;
 
     // Polynomials that will be shifted need special care.
-    AVM_TRACK_TIME("proving/init_polys_to_be_shifted", ({
+    AVM_TRACK_TIME("proving/set_polys_to_be_shifted", ({
                        auto to_be_shifted = polys.get_to_be_shifted();
-
-                       // NOTE: we can't parallelize because Polynomial construction uses parallelism.
-                       for (size_t i = 0; i < to_be_shifted.size(); i++) {
-                           auto& poly = to_be_shifted[i];
+                       bb::parallel_for(to_be_shifted.size(), [&](size_t i) {
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(TO_BE_SHIFTED_COLUMNS_ARRAY.at(i));
-                           uint32_t num_rows = trace.get_column_rows(col);
-                           // Since we are shifting, we need to allocate one less row.
-                           // The first row is always zero.
-                           uint32_t allocated_size = num_rows > 0 ? num_rows - 1 : 0;
-
-                           poly = AvmProver::Polynomial(
-                               /*memory size*/ allocated_size,
-                               /*largest possible index*/ CIRCUIT_SUBGROUP_SIZE,
-                               /*make shiftable with offset*/ 1);
-                       }
+                           // Since we are shifting, we start the polynomial at row 1. The first row is always zero.
+                           to_be_shifted[i] = column_to_polynomial(trace, col, /*start_index=*/1);
+                       });
                    }));
 
     // Catch-all with fully formed polynomials
@@ -42,39 +71,18 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
     //
     // NOTE FOR SELF: however, the counts will be known here and the inv have the same size?
     // think about it and check the formula.
-    AVM_TRACK_TIME("proving/init_polys_unshifted", ({
+    AVM_TRACK_TIME("proving/set_polys_unshifted", ({
                        auto unshifted = polys.get_unshifted();
+                       // TODO: We are now visiting per-column. Profile if per-row is better.
+                       // This would need changes to the trace container.
                        bb::parallel_for(unshifted.size(), [&](size_t i) {
                            auto& poly = unshifted[i];
                            // Some of the polynomials have been initialized above. Skip those.
                            if (poly.virtual_size() > 0) {
-                               // Already initialized above.
                                return;
                            }
-
-                           // WARNING! Column-Polynomials order matters!
-                           Column col = static_cast<Column>(i);
-                           const auto num_rows = trace.get_column_rows(col);
-                           poly = AvmProver::Polynomial::create_non_parallel_zero_init(num_rows, CIRCUIT_SUBGROUP_SIZE);
-                       });
-                   }));
-
-    AVM_TRACK_TIME("proving/set_polys_unshifted", ({
-                       auto unshifted = polys.get_unshifted();
-                       // TODO: We are now visiting per-column. Profile if per-row is better.
-                       // This would need changes to the trace container.
-                       bb::parallel_for(unshifted.size(), [&](size_t i) {
                            // WARNING! Column-Polynomials order matters!
-                           auto& poly = unshifted[i];
-                           Column col = static_cast<Column>(i);
-
-                           trace.visit_column(col, [&](size_t row, const AvmProver::FF& value) {
-                               // We use `at` because we are sure the row exists and the value is non-zero.
-                               poly.at(row) = value;
-                           });
-                           // We free columns as we go.
-                           // TODO: If we merge the init with the setting, this would be even more memory efficient.
-                           trace.clear_column(col);
+                           poly = column_to_polynomial(trace, static_cast<Column>(i), /*start_index=*/0);
                        });
                    }));
 
@@ -1,6 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #include "barretenberg/vm2/common/set.hpp"
@@ -19,16 +28,49 @@ template <typename Event> class EventEmitterInterface {
 template <typename Event> class EventEmitter : public EventEmitterInterface<Event> {
   public:
     using Container = std::vector<Event>;
+    // Consumes a chunk of events, in the order they were emitted.
+    using Sink = std::function<void(Container&&)>;
 
     virtual ~EventEmitter() = default;
-    void emit(Event&& event) override { events.push_back(std::move(event)); };
+    void emit(Event&& event) override
+    {
+        events.push_back(std::move(event));
+        if (sink && events.size() >= chunk_size) {
+            flush();
+            events.reserve(chunk_size);
+        }
+    };
+
+    // From now on, hands the events over to the sink in chunks of chunk_size instead of keeping them.
+    // This lets the events be consumed (and freed) while they are still being emitted.
+    void stream_to(Sink events_sink, size_t events_per_chunk)
+    {
+        assert(events_per_chunk > 0);
+        sink = std::move(events_sink);
+        chunk_size = events_per_chunk;
+        events.reserve(chunk_size);
+    }
+    // Hands the events emitted so far to the sink, if streaming.
+    void flush()
+    {
+        if (sink && !events.empty()) {
+            sink(std::exchange(events, {}));
+        }
+    }
 
     const Container& get_events() const { return events; }
     // Transfers ownership of the events to the caller (clears the internal container).
-    Container dump_events() { return std::move(events); }
+    // When streaming, the remaining events go to the sink instead and the result is empty.
+    Container dump_events()
+    {
+        flush();
+        return std::move(events);
+    }
 
   private:
     Container events;
+    Sink sink;
+    size_t chunk_size = 0;
 };
 
 // This is an EventEmitter that eagerly deduplicates events based on a provided key.
@@ -55,6 +97,150 @@ template <typename Event> class DeduplicatingEventEmitter : public EventEmitter<
     unordered_flat_set<typename Event::Key> elements_seen;
 };
 
+namespace detail {
+
+// The shard that sharded event emitters append the current thread's events to. See EventShardScope.
+inline thread_local size_t current_event_shard = 0;
+// Sharded emitters are told apart by id rather than address, since a new emitter can reuse a destroyed one's address.
+inline std::atomic<uint64_t> next_sharded_emitter_id = 1;
+
+} // namespace detail
+
+// Makes the current thread emit to the given shard of every sharded event emitter, while in scope.
+// Threads that emit concurrently must use different shards. Threads use shard 0 by default.
+class EventShardScope {
+  public:
+    EventShardScope(size_t shard)
+        : previous_shard(std::exchange(detail::current_event_shard, shard))
+    {}
+    ~EventShardScope() { detail::current_event_shard = previous_shard; }
+
+    EventShardScope(const EventShardScope&) = delete;
+    EventShardScope& operator=(const EventShardScope&) = delete;
+
+  private:
+    size_t previous_shard;
+};
+
+// An EventEmitter that several threads can emit to at once without contending for the events container.
+// Each thread appends to its own shard, whose events are stored in fixed-size chunks so that growing it never moves
+// them. The shards are merged when dumping the events: in increasing shard order, and in the order they were emitted
+// within a shard. The result is therefore deterministic as long as the events of each shard are.
+template <typename Event, typename ShardState = std::monostate>
+class ShardedEventEmitter : public EventEmitterInterface<Event> {
+  public:
+    using Container = std::vector<Event>;
+
+    ShardedEventEmitter() = default;
+    ShardedEventEmitter(const ShardedEventEmitter&) = delete;
+    ShardedEventEmitter& operator=(const ShardedEventEmitter&) = delete;
+    virtual ~ShardedEventEmitter() = default;
+
+    void emit(Event&& event) override { get_shard().push_back(std::move(event)); }
+
+    // Transfers ownership of the events of all shards to the caller (clears the shards).
+    // This must not run concurrently with emit.
+    Container dump_events()
+    {
+        std::lock_guard lock(shards_mutex);
+        size_t num_events = 0;
+        for (const auto& [index, shard] : shards) {
+            for (const auto& chunk : shard.chunks) {
+                num_events += chunk.size();
+            }
+        }
+        Container events;
+        events.reserve(num_events);
+        // Shards are kept (if empty), since threads hold on to them.
+        for (auto& [index, shard] : shards) {
+            for (auto& chunk : shard.chunks) {
+                std::move(chunk.begin(), chunk.end(), std::back_inserter(events));
+            }
+            shard.chunks.clear();
+            shard.state = {};
+        }
+        return events;
+    }
+
+  protected:
+    static constexpr size_t EVENTS_PER_CHUNK = 1024;
+
+    struct Shard {
+        std::vector<Container> chunks;
+        // Whatever a subclass needs to keep per shard.
+        ShardState state;
+
+        void push_back(Event&& event)
+        {
+            if (chunks.empty() || chunks.back().size() == EVENTS_PER_CHUNK) {
+                chunks.emplace_back().reserve(EVENTS_PER_CHUNK);
+            }
+            chunks.back().push_back(std::move(event));
+        }
+    };
+
+    Shard& get_shard()
+    {
+        // A thread keeps emitting to the same shard, so it remembers the last one it used to avoid the lock.
+        struct CachedShard {
+            uint64_t emitter_id = 0;
+            size_t index = 0;
+            Shard* shard = nullptr;
+        };
+        thread_local CachedShard cached;
+
+        const size_t index = detail::current_event_shard;
+        if (cached.emitter_id != id || cached.index != index) {
+            std::lock_guard lock(shards_mutex);
+            // Map nodes are stable, so the shard can be used without the lock from now on.
+            cached = { id, index, &shards[index] };
+        }
+        return *cached.shard;
+    }
+
+  private:
+    const uint64_t id = detail::next_sharded_emitter_id++;
+    std::mutex shards_mutex;
+    std::map<size_t, Shard> shards;
+};
+
+// A ShardedEventEmitter that deduplicates events based on a provided key.
+// Events are deduplicated eagerly within each shard, and across shards when dumping them (keeping the first).
+template <typename Event>
+class ShardedDeduplicatingEventEmitter
+    : public ShardedEventEmitter<Event, unordered_flat_set<typename Event::Key>> {
+  public:
+    using Base = ShardedEventEmitter<Event, unordered_flat_set<typename Event::Key>>;
+    using Container = Base::Container;
+
+    virtual ~ShardedDeduplicatingEventEmitter() = default;
+
+    void emit(Event&& event) override
+    {
+        auto& shard = this->get_shard();
+        if (shard.state.insert(event.get_key()).second) {
+            shard.push_back(std::move(event));
+        }
+    }
+    // Transfers ownership of the events to the caller (clears the shards).
+    Container dump_events()
+    {
+        Container events = Base::dump_events();
+        unordered_flat_set<typename Event::Key> elements_seen;
+        size_t num_unique_events = 0;
+        for (auto& event : events) {
+            if (elements_seen.insert(event.get_key()).second) {
+                if (&event != &events[num_unique_events]) {
+                    events[num_unique_events] = std::move(event);
+                }
+                num_unique_events++;
+            }
+        }
+        events.erase(events.begin() + static_cast<std::ptrdiff_t>(num_unique_events), events.end());
+        return events;
+    }
+};
+
 template <typename Event> class NoopEventEmitter : public EventEmitterInterface<Event> {
   public:
     using Container = std::vector<Event>;
@@ -0,0 +1,107 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/events/range_check_event.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+using testing::SizeIs;
+
+TEST(EventEmitterTest, StreamsEventsInChunks)
+{
+    std::vector<std::vector<int>> chunks;
+    EventEmitter<int> emitter;
+    emitter.emit(1);
+    emitter.stream_to([&](std::vector<int>&& chunk) { chunks.push_back(std::move(chunk)); }, 2);
+
+    emitter.emit(2);
+    EXPECT_THAT(chunks, ElementsAre(ElementsAre(1, 2)));
+    emitter.emit(3);
+    emitter.emit(4);
+    emitter.emit(5);
+    EXPECT_THAT(chunks, SizeIs(2));
+
+    EXPECT_THAT(emitter.dump_events(), IsEmpty());
+    EXPECT_THAT(chunks, ElementsAre(ElementsAre(1, 2), ElementsAre(3, 4), ElementsAre(5)));
+}
+
+TEST(EventEmitterTest, DeduplicatesAcrossChunks)
+{
+    std::vector<RangeCheckEvent> events;
+    DeduplicatingEventEmitter<RangeCheckEvent> emitter;
+    emitter.stream_to(
+        [&](std::vector<RangeCheckEvent>&& chunk) { events.insert(events.end(), chunk.begin(), chunk.end()); }, 2);
+
+    for (uint128_t value : { 1U, 2U, 1U, 3U, 2U, 4U }) {
+        emitter.emit({ .value = value, .num_bits = 8 });
+    }
+    emitter.flush();
+
+    EXPECT_THAT(events,
+                ElementsAre(RangeCheckEvent{ .value = 1, .num_bits = 8 },
+                            RangeCheckEvent{ .value = 2, .num_bits = 8 },
+                            RangeCheckEvent{ .value = 3, .num_bits = 8 },
+                            RangeCheckEvent{ .value = 4, .num_bits = 8 }));
+}
+
+TEST(EventEmitterTest, ShardedEmitterMergesShardsInOrder)
+{
+    constexpr size_t NUM_THREADS = 4;
+    constexpr int EVENTS_PER_THREAD = 5000;
+    ShardedEventEmitter<int> emitter;
+
+    // Shards are emitted to in reverse order, but merged in shard order.
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < NUM_THREADS; i++) {
+        threads.emplace_back([&, shard = NUM_THREADS - i - 1]() {
+            EventShardScope scope(shard);
+            for (int j = 0; j < EVENTS_PER_THREAD; j++) {
+                emitter.emit(static_cast<int>(shard) * EVENTS_PER_THREAD + j);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> events = emitter.dump_events();
+    ASSERT_THAT(events, SizeIs(NUM_THREADS * EVENTS_PER_THREAD));
+    for (size_t i = 0; i < events.size(); i++) {
+        EXPECT_EQ(events[i], static_cast<int>(i));
+    }
+
+    // The emitter can be used again after dumping.
+    emitter.emit(7);
+    EXPECT_THAT(emitter.dump_events(), ElementsAre(7));
+}
+
+TEST(EventEmitterTest, ShardedDeduplicatingEmitterDeduplicatesAcrossShards)
+{
+    ShardedDeduplicatingEventEmitter<RangeCheckEvent> emitter;
+    {
+        EventShardScope scope(1);
+        emitter.emit({ .value = 3, .num_bits = 8 });
+        emitter.emit({ .value = 1, .num_bits = 8 });
+        emitter.emit({ .value = 3, .num_bits = 8 });
+    }
+    emitter.emit({ .value = 2, .num_bits = 8 });
+    emitter.emit({ .value = 1, .num_bits = 8 });
+
+    EXPECT_THAT(emitter.dump_events(),
+                ElementsAre(RangeCheckEvent{ .value = 2, .num_bits = 8 },
+                            RangeCheckEvent{ .value = 1, .num_bits = 8 },
+                            RangeCheckEvent{ .value = 3, .num_bits = 8 }));
+    EXPECT_THAT(emitter.dump_events(), IsEmpty());
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
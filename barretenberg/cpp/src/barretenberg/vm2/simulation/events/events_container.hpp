@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include "barretenberg/vm2/simulation/events/address_derivation_event.hpp"
 #include "barretenberg/vm2/simulation/events/addressing_event.hpp"
 #include "barretenberg/vm2/simulation/events/alu_event.hpp"
@@ -50,4 +52,17 @@ struct EventsContainer {
     EventEmitterInterface<NullifierTreeCheckEvent>::Container nullifier_tree_check_events;
 };
 
+// Consumers of the events that are streamed out in chunks during simulation, rather than collected.
+// The corresponding containers in the EventsContainer are left empty. An unset sink means no streaming.
+struct EventSinks {
+    // Events per chunk. Large enough to amortize handing a chunk over, small enough to free events early.
+    size_t chunk_size = 1 << 14;
+
+    EventEmitter<MemoryEvent>::Sink memory;
+    EventEmitter<AluEvent>::Sink alu;
+    EventEmitter<RangeCheckEvent>::Sink range_check;
+    EventEmitter<Poseidon2HashEvent>::Sink poseidon2_hash;
+    EventEmitter<Poseidon2PermutationEvent>::Sink poseidon2_permutation;
+};
+
 } // namespace bb::avm2::simulation
@@ -1,8 +1,12 @@
 #include "barretenberg/vm2/simulation_helper.hpp"
 
+#include <chrono>
 #include <cstdint>
+#include <exception>
+#include <vector>
 
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/common/aztec_types.hpp"
 #include "barretenberg/vm2/common/field.hpp"
@@ -44,6 +48,7 @@
 #include "barretenberg/vm2/simulation/to_radix.hpp"
 #include "barretenberg/vm2/simulation/tx_execution.hpp"
 #include "barretenberg/vm2/simulation/update_check.hpp"
+#include "barretenberg/vm2/tooling/stats.hpp"
 
 namespace bb::avm2 {
 
@@ -57,16 +62,31 @@ struct ProvingSettings {
     template <typename E> using DefaultDeduplicatingEventEmitter = DeduplicatingEventEmitter<E>;
 };
 
+// Configuration for full simulation with several threads emitting events at once (see EventShardScope).
+struct ShardedProvingSettings {
+    template <typename E> using DefaultEventEmitter = ShardedEventEmitter<E>;
+    template <typename E> using DefaultDeduplicatingEventEmitter = ShardedDeduplicatingEventEmitter<E>;
+};
+
 // Configuration for fast simulation.
 struct FastSettings {
     template <typename E> using DefaultEventEmitter = NoopEventEmitter<E>;
     template <typename E> using DefaultDeduplicatingEventEmitter = NoopEventEmitter<E>;
 };
 
-} // namespace
-
-template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings()
+template <typename Emitter, typename Sink>
+void stream_events(Emitter& emitter, const Sink& sink, size_t chunk_size)
 {
+    // Emitters that can't stream (noop or sharded ones) are left as they are.
+    if constexpr (requires { emitter.stream_to(sink, chunk_size); }) {
+        if (sink) {
+            emitter.stream_to(sink, chunk_size);
+        }
+    }
+}
+
+// The event emitters of a simulation, of the kinds chosen by the settings S.
+template <typename S> struct SimulationEmitters {
     typename S::template DefaultEventEmitter<ExecutionEvent> execution_emitter;
     typename S::template DefaultDeduplicatingEventEmitter<AluEvent> alu_emitter;
     typename S::template DefaultEventEmitter<BitwiseEvent> bitwise_emitter;
@@ -92,27 +112,70 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
     typename S::template DefaultEventEmitter<UpdateCheckEvent> update_check_emitter;
     typename S::template DefaultEventEmitter<NullifierTreeCheckEvent> nullifier_tree_check_emitter;
 
+    void stream_to(const EventSinks& sinks)
+    {
+        stream_events(memory_emitter, sinks.memory, sinks.chunk_size);
+        stream_events(alu_emitter, sinks.alu, sinks.chunk_size);
+        stream_events(range_check_emitter, sinks.range_check, sinks.chunk_size);
+        stream_events(poseidon2_hash_emitter, sinks.poseidon2_hash, sinks.chunk_size);
+        stream_events(poseidon2_perm_emitter, sinks.poseidon2_permutation, sinks.chunk_size);
+    }
+
+    // Transfers ownership of the events of all the emitters to the caller.
+    EventsContainer dump_events()
+    {
+        return { execution_emitter.dump_events(),
+                 alu_emitter.dump_events(),
+                 bitwise_emitter.dump_events(),
+                 memory_emitter.dump_events(),
+                 bytecode_retrieval_emitter.dump_events(),
+                 bytecode_hashing_emitter.dump_events(),
+                 bytecode_decomposition_emitter.dump_events(),
+                 instruction_fetching_emitter.dump_events(),
+                 address_derivation_emitter.dump_events(),
+                 class_id_derivation_emitter.dump_events(),
+                 siloing_emitter.dump_events(),
+                 sha256_compression_emitter.dump_events(),
+                 ecc_add_emitter.dump_events(),
+                 scalar_mul_emitter.dump_events(),
+                 poseidon2_hash_emitter.dump_events(),
+                 poseidon2_perm_emitter.dump_events(),
+                 to_radix_emitter.dump_events(),
+                 field_gt_emitter.dump_events(),
+                 merkle_check_emitter.dump_events(),
+                 range_check_emitter.dump_events(),
+                 context_stack_emitter.dump_events(),
+                 public_data_tree_check_emitter.dump_events(),
+                 update_check_emitter.dump_events(),
+                 nullifier_tree_check_emitter.dump_events() };
+    }
+};
+
+// Simulates the transaction of the given hints, emitting its events to the given emitters.
+template <typename S> void simulate_with_emitters(const ExecutionHints& hints, SimulationEmitters<S>& emitters)
+{
     uint32_t current_block_number = static_cast<uint32_t>(hints.tx.globalVariables.blockNumber);
 
-    Poseidon2 poseidon2(poseidon2_hash_emitter, poseidon2_perm_emitter);
-    ToRadix to_radix(to_radix_emitter);
-    Ecc ecc(to_radix, ecc_add_emitter, scalar_mul_emitter);
-    MerkleCheck merkle_check(poseidon2, merkle_check_emitter);
-    RangeCheck range_check(range_check_emitter);
-    FieldGreaterThan field_gt(range_check, field_gt_emitter);
-    PublicDataTreeCheck public_data_tree_check(poseidon2, merkle_check, field_gt, public_data_tree_check_emitter);
-    NullifierTreeCheck nullifier_tree_check(poseidon2, merkle_check, field_gt, nullifier_tree_check_emitter);
-
-    AddressDerivation address_derivation(poseidon2, ecc, address_derivation_emitter);
-    ClassIdDerivation class_id_derivation(poseidon2, class_id_derivation_emitter);
+    Poseidon2 poseidon2(emitters.poseidon2_hash_emitter, emitters.poseidon2_perm_emitter);
+    ToRadix to_radix(emitters.to_radix_emitter);
+    Ecc ecc(to_radix, emitters.ecc_add_emitter, emitters.scalar_mul_emitter);
+    MerkleCheck merkle_check(poseidon2, emitters.merkle_check_emitter);
+    RangeCheck range_check(emitters.range_check_emitter);
+    FieldGreaterThan field_gt(range_check, emitters.field_gt_emitter);
+    PublicDataTreeCheck public_data_tree_check(
+        poseidon2, merkle_check, field_gt, emitters.public_data_tree_check_emitter);
+    NullifierTreeCheck nullifier_tree_check(poseidon2, merkle_check, field_gt, emitters.nullifier_tree_check_emitter);
+
+    AddressDerivation address_derivation(poseidon2, ecc, emitters.address_derivation_emitter);
+    ClassIdDerivation class_id_derivation(poseidon2, emitters.class_id_derivation_emitter);
     HintedRawContractDB raw_contract_db(hints);
     HintedRawMerkleDB raw_merkle_db(hints);
     ContractDB contract_db(raw_contract_db, address_derivation, class_id_derivation);
     MerkleDB merkle_db(raw_merkle_db, public_data_tree_check, nullifier_tree_check);
-    UpdateCheck update_check(poseidon2, range_check, merkle_db, current_block_number, update_check_emitter);
+    UpdateCheck update_check(poseidon2, range_check, merkle_db, current_block_number, emitters.update_check_emitter);
 
-    BytecodeHasher bytecode_hasher(poseidon2, bytecode_hashing_emitter);
-    Siloing siloing(siloing_emitter);
+    BytecodeHasher bytecode_hasher(poseidon2, emitters.bytecode_hashing_emitter);
+    Siloing siloing(emitters.siloing_emitter);
     InstructionInfoDB instruction_info_db;
     TxBytecodeManager bytecode_manager(contract_db,
                                        merkle_db,
@@ -121,53 +184,91 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
                                        range_check,
                                        update_check,
                                        current_block_number,
-                                       bytecode_retrieval_emitter,
-                                       bytecode_decomposition_emitter,
-                                       instruction_fetching_emitter);
+                                       emitters.bytecode_retrieval_emitter,
+                                       emitters.bytecode_decomposition_emitter,
+                                       emitters.instruction_fetching_emitter);
     ExecutionComponentsProvider execution_components(
-        bytecode_manager, range_check, memory_emitter, instruction_info_db);
+        bytecode_manager, range_check, emitters.memory_emitter, instruction_info_db);
 
-    Alu alu(alu_emitter);
-    Execution execution(alu, execution_components, instruction_info_db, execution_emitter, context_stack_emitter);
+    Alu alu(emitters.alu_emitter);
+    Execution execution(
+        alu, execution_components, instruction_info_db, emitters.execution_emitter, emitters.context_stack_emitter);
     TxExecution tx_execution(execution, merkle_db);
-    Sha256 sha256(sha256_compression_emitter);
+    Sha256 sha256(emitters.sha256_compression_emitter);
 
     tx_execution.simulate(hints.tx);
+}
+
+} // namespace
+
+template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings(const EventSinks& sinks)
+{
+    SimulationEmitters<S> emitters;
+    emitters.stream_to(sinks);
+    simulate_with_emitters(hints, emitters);
+    return emitters.dump_events();
+}
 
-    return { execution_emitter.dump_events(),
-             alu_emitter.dump_events(),
-             bitwise_emitter.dump_events(),
-             memory_emitter.dump_events(),
-             bytecode_retrieval_emitter.dump_events(),
-             bytecode_hashing_emitter.dump_events(),
-             bytecode_decomposition_emitter.dump_events(),
-             instruction_fetching_emitter.dump_events(),
-             address_derivation_emitter.dump_events(),
-             class_id_derivation_emitter.dump_events(),
-             siloing_emitter.dump_events(),
-             sha256_compression_emitter.dump_events(),
-             ecc_add_emitter.dump_events(),
-             scalar_mul_emitter.dump_events(),
-             poseidon2_hash_emitter.dump_events(),
-             poseidon2_perm_emitter.dump_events(),
-             to_radix_emitter.dump_events(),
-             field_gt_emitter.dump_events(),
-             merkle_check_emitter.dump_events(),
-             range_check_emitter.dump_events(),
-             context_stack_emitter.dump_events(),
-             public_data_tree_check_emitter.dump_events(),
-             update_check_emitter.dump_events(),
-             nullifier_tree_check_emitter.dump_events() };
+EventsContainer AvmSimulationHelper::simulate(const EventSinks& sinks)
+{
+    return simulate_with_settings<ProvingSettings>(sinks);
 }
 
-EventsContainer AvmSimulationHelper::simulate()
+EventsContainer AvmSimulationHelper::simulate_batch(const std::vector<ExecutionHints>& hints)
 {
-    return simulate_with_settings<ProvingSettings>();
+    SimulationEmitters<ShardedProvingSettings> emitters;
+    std::vector<std::exception_ptr> errors(hints.size());
+    parallel_for(hints.size(), [&](size_t i) {
+        // Each transaction emits to a shard of its own, so its events are merged in the order of the hints.
+        EventShardScope shard_scope(i);
+        try {
+            simulate_with_emitters(hints[i], emitters);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return emitters.dump_events();
 }
 
 void AvmSimulationHelper::simulate_fast()
 {
-    simulate_with_settings<FastSettings>();
+    simulate_with_settings<FastSettings>({});
+}
+
+std::vector<TxSimulationResult> AvmSimulationHelper::simulate_fast_batch(std::vector<ExecutionHints> hints)
+{
+    std::vector<TxSimulationResult> results(hints.size());
+    // Transactions share no state, so they are simulated independently.
+    // A failing transaction is reported in its result and does not stop the others.
+    AVM_TRACK_TIME("simulation/batch/all", ({
+                       parallel_for(hints.size(), [&](size_t i) {
+                           auto& result = results[i];
+                           const auto start = std::chrono::steady_clock::now();
+                           try {
+                               AvmSimulationHelper(std::move(hints[i])).simulate_fast();
+                               result.success = true;
+                           } catch (const std::exception& e) {
+                               result.error = e.what();
+                           }
+                           result.duration = std::chrono::steady_clock::now() - start;
+                       });
+                   }));
+    // A transaction often takes less than a millisecond, so the time is accumulated unrounded and truncated only once.
+#ifdef AVM_TRACK_STATS
+    std::chrono::nanoseconds tx_time{ 0 };
+    for (const auto& result : results) {
+        tx_time += result.duration;
+    }
+    Stats::get().increment(
+        "simulation/batch/tx_ms",
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(tx_time).count()));
+#endif
+    return results;
 }
 
 } // namespace bb::avm2
@@ -1,10 +1,22 @@
 #pragma once
 
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
 
 namespace bb::avm2 {
 
+// The outcome of simulating one of a batch of transactions.
+struct TxSimulationResult {
+    bool success = false;
+    // Why the simulation failed, if it did.
+    std::string error;
+    std::chrono::nanoseconds duration{ 0 };
+};
+
 class AvmSimulationHelper {
   public:
     AvmSimulationHelper(ExecutionHints hints)
@@ -12,13 +24,24 @@ class AvmSimulationHelper {
     {}
 
     // Full simulation with event collection.
-    simulation::EventsContainer simulate();
+    // The events with a sink are streamed to it while simulating, instead of being collected.
+    simulation::EventsContainer simulate(const simulation::EventSinks& sinks = {});
+
+    // Full simulation of independent transactions, in parallel (one transaction per thread at a time), collecting the
+    // events of all of them. Events are in the order of the hints, whichever thread simulated each transaction, and
+    // the events that are deduplicated are so across transactions too.
+    // If transactions fail, the error of the first of them is thrown.
+    static simulation::EventsContainer simulate_batch(const std::vector<ExecutionHints>& hints);
 
     // Fast simulation without event collection.
     void simulate_fast();
 
+    // Fast simulation of independent transactions, in parallel (one transaction per thread at a time).
+    // Each transaction runs against its own DBs, built from its hints. Results are in the order of the hints.
+    static std::vector<TxSimulationResult> simulate_fast_batch(std::vector<ExecutionHints> hints);
+
   private:
-    template <typename S> simulation::EventsContainer simulate_with_settings();
+    template <typename S> simulation::EventsContainer simulate_with_settings(const simulation::EventSinks& sinks);
 
     ExecutionHints hints;
 };
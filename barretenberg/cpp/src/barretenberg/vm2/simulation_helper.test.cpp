@@ -0,0 +1,100 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "barretenberg/vm2/simulation_helper.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "barretenberg/api/file_io.hpp"
+#include "barretenberg/vm2/common/avm_inputs.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+using ::testing::IsEmpty;
+using ::testing::Not;
+using ::testing::SizeIs;
+
+// Checks that the events of a batch are those of a transaction simulated alone, repeated once per transaction.
+template <typename Container>
+void expect_repeated(const Container& batch_events, const Container& tx_events, size_t num_txs)
+{
+    ASSERT_THAT(batch_events, SizeIs(num_txs * tx_events.size()));
+    for (size_t i = 0; i < batch_events.size(); i++) {
+        EXPECT_EQ(batch_events[i], tx_events[i % tx_events.size()]) << "event " << i;
+    }
+}
+
+TEST(AvmSimulationHelperTest, FastBatchMatchesSimulatingAlone)
+{
+    // cwd is expected to be barretenberg/cpp/build.
+    const auto inputs = AvmProvingInputs::from(read_file("../src/barretenberg/vm2/common/avm_inputs.testdata.bin"));
+
+    bool success = true;
+    std::string error;
+    try {
+        AvmSimulationHelper(inputs.hints).simulate_fast();
+    } catch (const std::exception& e) {
+        success = false;
+        error = e.what();
+    }
+
+    const auto results = AvmSimulationHelper::simulate_fast_batch(std::vector<ExecutionHints>(4, inputs.hints));
+
+    ASSERT_THAT(results, SizeIs(4));
+    for (const auto& result : results) {
+        EXPECT_EQ(result.success, success);
+        EXPECT_EQ(result.error, error);
+    }
+}
+
+TEST(AvmSimulationHelperTest, BatchMergesEventsInOrderOfHints)
+{
+    // cwd is expected to be barretenberg/cpp/build.
+    // The recorded inputs simulate successfully (the tracegen benchmarks rely on it too).
+    const auto inputs = AvmProvingInputs::from(read_file("../src/barretenberg/vm2/common/avm_inputs.testdata.bin"));
+    const std::vector<ExecutionHints> hints(4, inputs.hints);
+
+    std::optional<simulation::EventsContainer> tx_events;
+    ASSERT_NO_THROW(tx_events = AvmSimulationHelper(inputs.hints).simulate());
+    ASSERT_TRUE(tx_events.has_value());
+    ASSERT_THAT(tx_events->execution, Not(IsEmpty()));
+
+    simulation::EventsContainer events;
+    ASSERT_NO_THROW(events = AvmSimulationHelper::simulate_batch(hints));
+    expect_repeated(events.merkle_check, tx_events->merkle_check, hints.size());
+    expect_repeated(events.field_gt, tx_events->field_gt, hints.size());
+    expect_repeated(events.to_radix, tx_events->to_radix, hints.size());
+    expect_repeated(events.public_data_tree_check_events, tx_events->public_data_tree_check_events, hints.size());
+    expect_repeated(events.nullifier_tree_check_events, tx_events->nullifier_tree_check_events, hints.size());
+    EXPECT_THAT(events.execution, SizeIs(hints.size() * tx_events->execution.size()));
+    EXPECT_THAT(events.memory, SizeIs(hints.size() * tx_events->memory.size()));
+    // The transactions are the same, so deduplication leaves the events of one of them.
+    EXPECT_EQ(events.range_check, tx_events->range_check);
+
+    // Merging doesn't depend on which thread simulated which transaction.
+    const auto other_events = AvmSimulationHelper::simulate_batch(hints);
+    EXPECT_EQ(other_events.merkle_check, events.merkle_check);
+    EXPECT_EQ(other_events.range_check, events.range_check);
+    EXPECT_THAT(other_events.execution, SizeIs(events.execution.size()));
+    EXPECT_THAT(other_events.memory, SizeIs(events.memory.size()));
+}
+
+TEST(AvmSimulationHelperTest, BatchOfNoTransactions)
+{
+    const auto events = AvmSimulationHelper::simulate_batch({});
+    EXPECT_THAT(events.execution, IsEmpty());
+    EXPECT_THAT(events.range_check, IsEmpty());
+}
+
+TEST(AvmSimulationHelperTest, FastBatchOfNoTransactions)
+{
+    EXPECT_THAT(AvmSimulationHelper::simulate_fast_batch({}), IsEmpty());
+}
+
+} // namespace
+} // namespace bb::avm2
@@ -30,7 +30,6 @@ void AluTraceBuilder::process(const simulation::EventEmitterInterface<simulation
 {
     using C = Column;
 
-    uint32_t row = 0;
     for (const auto& event : events) {
         C opcode_selector = get_operation_selector(event.operation);
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/alu_event.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
@@ -9,8 +11,12 @@ namespace bb::avm2::tracegen {
 
 class AluTraceBuilder final {
   public:
+    // Rows are appended after those of previous calls, so the events can be processed in chunks.
     void process(const simulation::EventEmitterInterface<simulation::AluEvent>::Container& events,
                  TraceContainer& trace);
+
+  private:
+    uint32_t row = 0;
 };
 
 } // namespace bb::avm2::tracegen
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "barretenberg/api/file_io.hpp"
+#include "barretenberg/vm2/common/avm_inputs.hpp"
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/constraining/polynomials.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/simulation_helper.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+#include "barretenberg/vm2/tracegen_helper.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+
+namespace {
+
+constexpr size_t NUM_BENCH_COLUMNS = 64;
+
+// Sets range(0) rows in each of a set of columns, every range(1)-th row, and then reads them all back.
+// A stride of 1 fills the columns densely, a large stride leaves them sparse.
+void BM_trace_container_set_and_get(State& state)
+{
+    const auto num_rows = static_cast<uint32_t>(state.range(0));
+    const auto stride = static_cast<uint32_t>(state.range(1));
+    const FF value = FF::random_element();
+
+    for (auto _ : state) {
+        tracegen::TraceContainer trace;
+        for (size_t col = 0; col < NUM_BENCH_COLUMNS; col++) {
+            for (uint32_t row = 0; row < num_rows; row++) {
+                trace.set(static_cast<Column>(col), row * stride, value);
+            }
+        }
+        FF sum = 0;
+        for (size_t col = 0; col < NUM_BENCH_COLUMNS; col++) {
+            for (uint32_t row = 0; row < num_rows; row++) {
+                sum += trace.get(static_cast<Column>(col), row * stride);
+            }
+        }
+        DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BENCH_COLUMNS * num_rows) * 2);
+}
+
+AvmProvingInputs load_proving_inputs()
+{
+    // cwd is expected to be barretenberg/cpp/build-bench.
+    const char* path = std::getenv("AVM_PROVING_INPUTS");
+    return AvmProvingInputs::from(
+        read_file(path != nullptr ? path : "../src/barretenberg/vm2/common/avm_inputs.testdata.bin"));
+}
+
+// Generates the trace for the recorded proving inputs. Simulation is not timed.
+void BM_tracegen(State& state)
+{
+    const AvmProvingInputs inputs = load_proving_inputs();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto events = AvmSimulationHelper(inputs.hints).simulate();
+        state.ResumeTiming();
+        auto trace = AvmTraceGenHelper().generate_trace(std::move(events));
+        DoNotOptimize(trace);
+    }
+}
+
+// Generates the trace for the recorded proving inputs and turns it into the prover's polynomials.
+void BM_tracegen_and_compute_polynomials(State& state)
+{
+    const AvmProvingInputs inputs = load_proving_inputs();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto events = AvmSimulationHelper(inputs.hints).simulate();
+        state.ResumeTiming();
+        auto trace = AvmTraceGenHelper().generate_trace(std::move(events));
+        auto polynomials = constraining::compute_polynomials(trace);
+        DoNotOptimize(polynomials);
+    }
+}
+
+// Simulates the recorded proving inputs and generates their trace.
+// With range(0) set, the events are streamed to tracegen during simulation rather than collected first.
+void BM_simulate_and_tracegen(State& state)
+{
+    const AvmProvingInputs inputs = load_proving_inputs();
+    const bool streaming = state.range(0) != 0;
+
+    for (auto _ : state) {
+        AvmTraceGenHelper tracegen_helper;
+        const simulation::EventSinks sinks = streaming ? tracegen_helper.start_streaming() : simulation::EventSinks{};
+        auto events = AvmSimulationHelper(inputs.hints).simulate(sinks);
+        auto trace = tracegen_helper.generate_trace(std::move(events));
+        DoNotOptimize(trace);
+    }
+}
+
+// Fast-simulates a batch of range(0) copies of the recorded transaction, in parallel.
+void BM_simulate_fast_batch(State& state)
+{
+    const AvmProvingInputs inputs = load_proving_inputs();
+    const auto num_txs = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<ExecutionHints> hints(num_txs, inputs.hints);
+        state.ResumeTiming();
+        auto results = AvmSimulationHelper::simulate_fast_batch(std::move(hints));
+        DoNotOptimize(results);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_txs));
+}
+
+} // namespace
+
+BENCHMARK(BM_trace_container_set_and_get)
+    ->Unit(kMillisecond)
+    ->ArgsProduct({ { 1 << 12, 1 << 16 }, { 1, 64 } });
+BENCHMARK(BM_tracegen)->Unit(kMillisecond)->Iterations(3);
+BENCHMARK(BM_tracegen_and_compute_polynomials)->Unit(kMillisecond)->Iterations(3);
+BENCHMARK(BM_simulate_and_tracegen)->Unit(kMillisecond)->Iterations(3)->Arg(0)->Arg(1);
+BENCHMARK(BM_simulate_fast_batch)->Unit(kMillisecond)->Arg(1)->Arg(8)->Arg(64);
+
+BENCHMARK_MAIN();
@@ -13,7 +13,6 @@ void MemoryTraceBuilder::process(const simulation::EventEmitterInterface<simulat
 {
     using C = Column;
 
-    uint32_t row = 0;
     for (const auto& event : events) {
         trace.set(row,
                   { {
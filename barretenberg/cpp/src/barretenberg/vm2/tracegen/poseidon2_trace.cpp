@@ -290,7 +290,7 @@ void Poseidon2TraceBuilder::process_hash(
     TraceContainer& trace)
 {
     using C = Column;
-    uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
+    uint32_t& row = hash_row;
     for (const auto& event : hash_events) {
         auto input_size = event.inputs.size();
         auto num_perm_events = (input_size / 3) + static_cast<size_t>(input_size % 3 != 0);
@@ -350,7 +350,7 @@ void Poseidon2TraceBuilder::process_permutation(
     // These are where we will store the intermediate values of current_state in the trace.
     std::array<Column, 4> round_state_cols;
 
-    uint32_t row = 0;
+    uint32_t& row = perm_row;
 
     for (const auto& event : perm_events) {
         // The bulk of this code is a copy of the Poseidon2Permutation::permute function from bb
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -11,6 +12,8 @@ namespace bb::avm2::tracegen {
 
 class Poseidon2TraceBuilder final {
   public:
+    // Rows are appended after those of previous calls, so the events can be processed in chunks.
+    // Hashes and permutations have separate subtraces, which can be processed concurrently.
     void process_hash(const simulation::EventEmitterInterface<simulation::Poseidon2HashEvent>::Container& hash_events,
                       TraceContainer& trace);
     void process_permutation(
@@ -18,6 +21,10 @@ class Poseidon2TraceBuilder final {
         TraceContainer& trace);
 
     static std::vector<std::unique_ptr<class InteractionBuilderInterface>> lookup_jobs();
+
+  private:
+    uint32_t hash_row = 1; // We start from row 1 because this trace contains shifted columns.
+    uint32_t perm_row = 0;
 };
 
 } // namespace bb::avm2::tracegen
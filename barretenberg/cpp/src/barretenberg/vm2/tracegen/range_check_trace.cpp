@@ -20,7 +20,6 @@ void RangeCheckTraceBuilder::process(
 {
     using C = Column;
 
-    uint32_t row = 0;
     for (const auto& event : events) {
         // store off event entries to be used directly in row
         const uint256_t original_num_bits = event.num_bits;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -11,10 +12,14 @@ namespace bb::avm2::tracegen {
 
 class RangeCheckTraceBuilder final {
   public:
+    // Rows are appended after those of previous calls, so the events can be processed in chunks.
     void process(const simulation::EventEmitterInterface<simulation::RangeCheckEvent>::Container& events,
                  TraceContainer& trace);
 
     static std::vector<std::unique_ptr<class InteractionBuilderInterface>> lookup_jobs();
+
+  private:
+    uint32_t row = 0;
 };
 
 } // namespace bb::avm2::tracegen
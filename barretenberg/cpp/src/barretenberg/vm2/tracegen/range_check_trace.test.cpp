@@ -143,5 +143,20 @@ TEST(RangeCheckTraceGenTest, RangeCheckLte128Bit)
                           Field(&R::range_check_sel_r5_16_bit_rng_lookup, 1),
                           Field(&R::range_check_sel_r6_16_bit_rng_lookup, 1))));
 }
+
+TEST(RangeCheckTraceGenTest, ProcessesEventsInChunks)
+{
+    TestTraceContainer trace;
+    RangeCheckTraceBuilder builder;
+
+    builder.process({ { .value = 1, .num_bits = 8 }, { .value = 2, .num_bits = 8 } }, trace);
+    builder.process({ { .value = 3, .num_bits = 8 } }, trace);
+
+    EXPECT_THAT(trace.as_rows(),
+                ElementsAre(AllOf(Field(&R::range_check_sel, 1), Field(&R::range_check_value, 1)),
+                            AllOf(Field(&R::range_check_sel, 1), Field(&R::range_check_value, 2)),
+                            AllOf(Field(&R::range_check_sel, 1), Field(&R::range_check_value, 3))));
+}
+
 } // namespace
 } // namespace bb::avm2::tracegen
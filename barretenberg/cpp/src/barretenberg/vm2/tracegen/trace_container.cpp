@@ -13,16 +13,94 @@ constexpr auto clk_column = Column::precomputed_clk;
 
 } // namespace
 
+const FF& TraceContainer::ColumnData::get(uint32_t row) const
+{
+    if (is_dense) {
+        return row < dense_rows.size() ? dense_rows[row] : zero;
+    }
+    const auto it = sparse_rows.find(row);
+    return it == sparse_rows.end() ? zero : it->second;
+}
+
+void TraceContainer::ColumnData::set(uint32_t row, const FF& value)
+{
+    if (value.is_zero()) {
+        bool was_set = false;
+        if (is_dense) {
+            if (row < dense_rows.size() && !dense_rows[row].is_zero()) {
+                dense_rows[row] = zero;
+                num_dense_non_zero_rows--;
+                was_set = true;
+            }
+        } else {
+            was_set = sparse_rows.erase(row) > 0;
+        }
+        if (max_row_number == row && was_set) {
+            // This shouldn't happen often. We delay recalculation of the max row number
+            // until someone actually needs it.
+            row_number_dirty = true;
+        }
+        return;
+    }
+
+    max_row_number = std::max(max_row_number, static_cast<int64_t>(row));
+    if (is_dense && row >= dense_rows.size() &&
+        static_cast<size_t>(row) + 1 > SPARSE_ROWS_RATIO * (num_dense_non_zero_rows + 1)) {
+        // Growing the column this far would leave it mostly zeros.
+        make_sparse();
+    }
+
+    if (is_dense) {
+        if (row >= dense_rows.size()) {
+            dense_rows.resize(static_cast<size_t>(row) + 1, zero);
+        }
+        FF& entry = dense_rows[row];
+        num_dense_non_zero_rows += entry.is_zero() ? 1U : 0U;
+        entry = value;
+        return;
+    }
+
+    sparse_rows.insert_or_assign(row, value);
+    if (sparse_rows.size() >= DENSE_MIN_NON_ZERO_ROWS &&
+        DENSE_ROWS_RATIO * sparse_rows.size() >= static_cast<size_t>(max_row_number + 1)) {
+        make_dense();
+    }
+}
+
+void TraceContainer::ColumnData::make_dense()
+{
+    // The max row number might be an overestimate if it is dirty, but it is never an underestimate.
+    dense_rows.assign(static_cast<size_t>(max_row_number + 1), zero);
+    for (const auto& [row, value] : sparse_rows) {
+        dense_rows[row] = value;
+    }
+    num_dense_non_zero_rows = sparse_rows.size();
+    sparse_rows = unordered_flat_map<uint32_t, FF>();
+    is_dense = true;
+}
+
+void TraceContainer::ColumnData::make_sparse()
+{
+    sparse_rows.reserve(num_dense_non_zero_rows);
+    for (uint32_t row = 0; row < dense_rows.size(); ++row) {
+        if (!dense_rows[row].is_zero()) {
+            sparse_rows.emplace(row, dense_rows[row]);
+        }
+    }
+    dense_rows = std::vector<FF>();
+    num_dense_non_zero_rows = 0;
+    is_dense = false;
+}
+
 TraceContainer::TraceContainer()
-    : trace(std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
+    : trace(std::make_unique<std::array<ColumnData, NUM_COLUMNS_WITHOUT_SHIFTS>>())
 {}
 
 const FF& TraceContainer::get(Column col, uint32_t row) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
-    const auto it = column_data.rows.find(row);
-    return it == column_data.rows.end() ? zero : it->second;
+    return column_data.get(row);
 }
 
 const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row) const
@@ -37,17 +115,7 @@ void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
-    if (!value.is_zero()) {
-        column_data.rows.insert_or_assign(row, value);
-        column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
-    } else {
-        auto num_erased = column_data.rows.erase(row);
-        if (column_data.max_row_number == row && num_erased > 0) {
-            // This shouldn't happen often. We delay recalculation of the max row number
-            // until someone actually needs it.
-            column_data.row_number_dirty = true;
-        }
-    }
+    column_data.set(row, value);
 }
 
 void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> values)
@@ -61,7 +129,22 @@ void TraceContainer::reserve_column(Column col, size_t size)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
-    column_data.rows.reserve(size);
+    if (size >= DENSE_MIN_NON_ZERO_ROWS) {
+        // A column reserved this large is expected to be filled, so we store it densely from the start.
+        if (!column_data.is_dense) {
+            column_data.make_dense();
+        }
+        column_data.dense_rows.reserve(size);
+    } else if (!column_data.is_dense) {
+        column_data.sparse_rows.reserve(size);
+    }
+}
+
+bool TraceContainer::is_column_dense(Column col) const
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    std::shared_lock lock(column_data.mutex);
+    return column_data.is_dense;
 }
 
 uint32_t TraceContainer::get_column_rows(Column col) const
@@ -70,10 +153,18 @@ uint32_t TraceContainer::get_column_rows(Column col) const
     std::unique_lock lock(column_data.mutex);
     if (column_data.row_number_dirty) {
         // Trigger recalculation of max row number.
-        auto keys = std::views::keys(column_data.rows);
-        const auto it = std::max_element(keys.begin(), keys.end());
         // We use -1 to indicate that the column is empty.
-        column_data.max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
+        if (column_data.is_dense) {
+            int64_t row = static_cast<int64_t>(column_data.dense_rows.size()) - 1;
+            while (row >= 0 && column_data.dense_rows[static_cast<size_t>(row)].is_zero()) {
+                --row;
+            }
+            column_data.max_row_number = row;
+        } else {
+            auto keys = std::views::keys(column_data.sparse_rows);
+            const auto it = std::max_element(keys.begin(), keys.end());
+            column_data.max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
+        }
         column_data.row_number_dirty = false;
     }
     return static_cast<uint32_t>(column_data.max_row_number + 1);
@@ -99,7 +190,15 @@ void TraceContainer::visit_column(Column col, const std::function<void(uint32_t,
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
-    for (const auto& [row, value] : column_data.rows) {
+    if (column_data.is_dense) {
+        for (uint32_t row = 0; row < column_data.dense_rows.size(); ++row) {
+            if (!column_data.dense_rows[row].is_zero()) {
+                visitor(row, column_data.dense_rows[row]);
+            }
+        }
+        return;
+    }
+    for (const auto& [row, value] : column_data.sparse_rows) {
         visitor(row, value);
     }
 }
@@ -108,9 +207,35 @@ void TraceContainer::clear_column(Column col)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
-    column_data.rows.clear();
+    column_data.sparse_rows.clear();
+    column_data.dense_rows = std::vector<FF>();
+    column_data.num_dense_non_zero_rows = 0;
+    column_data.is_dense = false;
+    column_data.max_row_number = 0;
+    column_data.row_number_dirty = false;
+}
+
+std::vector<FF> TraceContainer::release_dense_column(Column col)
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    std::unique_lock lock(column_data.mutex);
+    if (!column_data.is_dense) {
+        return {};
+    }
+    std::vector<FF> rows = std::move(column_data.dense_rows);
+    column_data.dense_rows = std::vector<FF>();
+    // Drop the trailing zero rows, and the capacity that growing the column row by row left behind.
+    while (!rows.empty() && rows.back().is_zero()) {
+        rows.pop_back();
+    }
+    if (rows.capacity() - rows.size() > rows.size() / RELEASE_MAX_SLACK_RATIO) {
+        rows = std::vector<FF>(rows.begin(), rows.end());
+    }
+    column_data.num_dense_non_zero_rows = 0;
+    column_data.is_dense = false;
     column_data.max_row_number = 0;
     column_data.row_number_dirty = false;
+    return rows;
 }
 
 } // namespace bb::avm2::tracegen
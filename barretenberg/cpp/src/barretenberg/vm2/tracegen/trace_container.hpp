@@ -8,6 +8,7 @@
 #include <shared_mutex>
 #include <span>
 #include <unordered_map>
+#include <vector>
 
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/common/map.hpp"
@@ -46,8 +47,10 @@ class TraceContainer {
     // Reserve column size. Useful for precomputed columns.
     void reserve_column(Column col, size_t size);
 
-    // Visits non-zero values in a column.
+    // Visits non-zero values in a column. Dense columns are visited in row order, sparse ones in no particular order.
     void visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const;
+    // Whether a column is currently stored densely rather than sparsely.
+    bool is_column_dense(Column col) const;
     // Returns the number of rows in a column. That is, the maximum non-zero row index + 1.
     uint32_t get_column_rows(Column col) const;
     // Maximum number of rows in any column.
@@ -59,24 +62,49 @@ class TraceContainer {
 
     // Free column memory.
     void clear_column(Column col);
+    // Moves out the rows of a dense column (indexed by row, up to its last non-zero row) and clears the column.
+    // The vector is copied if its capacity exceeds its size by more than 1/RELEASE_MAX_SLACK_RATIO.
+    // Returns an empty vector and leaves the column untouched if it is sparse.
+    std::vector<FF> release_dense_column(Column col);
 
   private:
+    // A column is stored sparsely until enough of its rows are set, and then densely.
+    // The thresholds trade the hash overhead of the sparse map against the zeros stored by the dense vector.
+    // A dense entry is an FF (32 bytes) and a sparse one is roughly 1.5x that including the map's overhead.
+    static constexpr size_t DENSE_MIN_NON_ZERO_ROWS = 256;
+    // A column becomes dense once at least 1/DENSE_ROWS_RATIO of its rows are non-zero.
+    static constexpr size_t DENSE_ROWS_RATIO = 2;
+    // A dense column that would drop below 1/SPARSE_ROWS_RATIO non-zero rows becomes sparse again.
+    // This is lower than the dense threshold so that columns don't flip back and forth.
+    static constexpr size_t SPARSE_ROWS_RATIO = 8;
+    // A released dense column keeps at most 1/RELEASE_MAX_SLACK_RATIO of its size as unused capacity.
+    static constexpr size_t RELEASE_MAX_SLACK_RATIO = 8;
+
     // We use a mutex per column to allow for concurrent writes.
     // Observe that therefore concurrent write access to different columns is cheap.
-    struct SparseColumn {
+    struct ColumnData {
         std::shared_mutex mutex;
-        int64_t max_row_number = -1; // We use -1 to indicate that the column is empty.
-        bool row_number_dirty;       // Needs recalculation.
+        int64_t max_row_number = -1;   // We use -1 to indicate that the column is empty.
+        bool row_number_dirty = false; // Needs recalculation.
+        bool is_dense = false;
         // Future memory optimization notes: we can do the same trick as in Operand.
         // That is, store a variant with a unique_ptr. However, we should benchmark this.
         // (see serialization.hpp).
-        unordered_flat_map<uint32_t, FF> rows;
+        unordered_flat_map<uint32_t, FF> sparse_rows;
+        // Indexed by row, with zeros for unset rows. It can be longer than max_row_number + 1.
+        std::vector<FF> dense_rows;
+        size_t num_dense_non_zero_rows = 0;
+
+        const FF& get(uint32_t row) const;
+        void set(uint32_t row, const FF& value);
+        void make_dense();
+        void make_sparse();
     };
-    // We store the trace as a sparse matrix.
+    // We store the trace as a matrix of columns, each of which is sparse or dense.
     // We use a unique_ptr to allocate the array in the heap vs the stack.
-    // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
-    // we could unnecessarily put strain on the stack with sizeof(unordered_map) * 3k bytes.
-    std::unique_ptr<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+    // Even if the _content_ of each column is always heap-allocated, if we have 3k columns
+    // we could unnecessarily put strain on the stack with sizeof(ColumnData) * 3k bytes.
+    std::unique_ptr<std::array<ColumnData, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
 };
 
 } // namespace bb::avm2::tracegen
@@ -0,0 +1,121 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using testing::ElementsAre;
+using testing::Pair;
+using testing::UnorderedElementsAre;
+
+constexpr Column col = Column::precomputed_clk;
+
+std::vector<std::pair<uint32_t, FF>> get_column(const TraceContainer& trace)
+{
+    std::vector<std::pair<uint32_t, FF>> values;
+    trace.visit_column(col, [&](uint32_t row, const FF& value) { values.emplace_back(row, value); });
+    return values;
+}
+
+TEST(TraceContainerTest, SparseColumn)
+{
+    TraceContainer trace;
+    trace.set(col, 10, 1);
+    trace.set(col, 100000, 2);
+    trace.set(col, 50, 0);
+
+    EXPECT_FALSE(trace.is_column_dense(col));
+    EXPECT_EQ(trace.get(col, 10), 1);
+    EXPECT_EQ(trace.get(col, 100000), 2);
+    EXPECT_EQ(trace.get(col, 11), 0);
+    EXPECT_EQ(trace.get_column_rows(col), 100001);
+    EXPECT_THAT(get_column(trace), UnorderedElementsAre(Pair(10, 1), Pair(100000, 2)));
+
+    trace.set(col, 100000, 0);
+    EXPECT_EQ(trace.get_column_rows(col), 11);
+}
+
+TEST(TraceContainerTest, BecomesDenseWhenFilled)
+{
+    TraceContainer trace;
+    for (uint32_t row = 0; row < 1000; row++) {
+        trace.set(col, row, row + 1);
+    }
+
+    EXPECT_TRUE(trace.is_column_dense(col));
+    EXPECT_EQ(trace.get_column_rows(col), 1000);
+    for (uint32_t row = 0; row < 1000; row++) {
+        EXPECT_EQ(trace.get(col, row), row + 1);
+    }
+    EXPECT_EQ(trace.get(col, 1000), 0);
+    EXPECT_EQ(trace.get(col, 1 << 20), 0);
+
+    // Clearing the last rows makes the row count shrink.
+    trace.set(col, 999, 0);
+    trace.set(col, 998, 0);
+    EXPECT_EQ(trace.get_column_rows(col), 998);
+    EXPECT_EQ(get_column(trace).size(), 998);
+}
+
+TEST(TraceContainerTest, BecomesSparseWhenGrownTooFar)
+{
+    TraceContainer trace;
+    for (uint32_t row = 0; row < 300; row++) {
+        trace.set(col, row, 1);
+    }
+    EXPECT_TRUE(trace.is_column_dense(col));
+
+    trace.set(col, 1 << 20, 7);
+    EXPECT_FALSE(trace.is_column_dense(col));
+    EXPECT_EQ(trace.get_column_rows(col), (1 << 20) + 1);
+    EXPECT_EQ(trace.get(col, 299), 1);
+    EXPECT_EQ(trace.get(col, 1 << 20), 7);
+    EXPECT_EQ(get_column(trace).size(), 301);
+}
+
+TEST(TraceContainerTest, ReservedColumnsAreDense)
+{
+    TraceContainer trace;
+    trace.reserve_column(col, 1 << 10);
+    EXPECT_TRUE(trace.is_column_dense(col));
+
+    trace.set(col, 0, 5);
+    trace.set(col, 3, 6);
+    EXPECT_THAT(get_column(trace), ElementsAre(Pair(0, 5), Pair(3, 6)));
+
+    trace.clear_column(col);
+    EXPECT_FALSE(trace.is_column_dense(col));
+    EXPECT_THAT(get_column(trace), ElementsAre());
+}
+
+TEST(TraceContainerTest, ReleaseDenseColumn)
+{
+    TraceContainer trace;
+    trace.set(col, 3, 1);
+    EXPECT_THAT(trace.release_dense_column(col), ElementsAre());
+    EXPECT_EQ(trace.get(col, 3), 1);
+
+    for (uint32_t row = 0; row < 500; row++) {
+        trace.set(col, row, row);
+    }
+    // Trailing zero rows and the capacity left by growing the column are dropped.
+    trace.set(col, 600, 0);
+    std::vector<FF> rows = trace.release_dense_column(col);
+    ASSERT_EQ(rows.size(), 500);
+    EXPECT_LE(rows.capacity(), 500 + (500 / 8));
+    for (uint32_t row = 0; row < 500; row++) {
+        EXPECT_EQ(rows[row], row);
+    }
+    EXPECT_FALSE(trace.is_column_dense(col));
+    EXPECT_THAT(get_column(trace), ElementsAre());
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
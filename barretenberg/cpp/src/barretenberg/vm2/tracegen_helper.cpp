@@ -1,9 +1,17 @@
 #include "barretenberg/vm2/tracegen_helper.hpp"
 
 #include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <span>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "barretenberg/common/constexpr_utils.hpp"
@@ -153,10 +161,205 @@ template <typename T> std::vector<T> concatenate_jobs(std::vector<T>&& first, au
 
 } // namespace
 
-TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events)
+#ifndef NO_MULTITHREADING
+// Processes the chunks of one subtrace in order, on a thread of its own.
+// At most MAX_PENDING_CHUNKS chunks wait to be processed. Beyond that the emitting thread blocks until the worker
+// catches up, so that a subtrace that is slower to generate than to simulate does not hold all of its events.
+// If processing a chunk throws, the remaining chunks are dropped and the exception is rethrown by wait().
+class SubtraceWorker {
+  public:
+    static constexpr size_t MAX_PENDING_CHUNKS = 4;
+
+    SubtraceWorker(std::string key)
+        : key(std::move(key))
+        , thread([this]() { run(); })
+    {}
+    SubtraceWorker(const SubtraceWorker&) = delete;
+    SubtraceWorker& operator=(const SubtraceWorker&) = delete;
+
+    ~SubtraceWorker()
+    {
+        {
+            std::unique_lock lock(mutex);
+            stop = true;
+        }
+        chunk_pushed.notify_one();
+        thread.join();
+    }
+
+    void push(std::function<void()> process_chunk)
+    {
+        std::unique_lock lock(mutex);
+        chunk_done.wait(lock, [this] { return pending.size() < MAX_PENDING_CHUNKS || error; });
+        // The subtrace can't be completed anymore, so there is no point in processing the chunk.
+        if (error) {
+            return;
+        }
+        pending.push_back(std::move(process_chunk));
+        chunk_pushed.notify_one();
+    }
+
+    // Waits until all the chunks pushed so far have been processed, and records the time spent processing them.
+    // Throws the exception of the chunk that failed, if any.
+    void wait()
+    {
+        std::unique_lock lock(mutex);
+        chunk_done.wait(lock, [this] { return pending.empty() && !busy; });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        // A chunk often takes less than a millisecond, so the time is accumulated unrounded and truncated only once.
+#ifdef AVM_TRACK_STATS
+        Stats::get().increment(
+            key + "_ms",
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(busy_time).count()));
+#endif
+        busy_time = {};
+    }
+
+  private:
+    void run()
+    {
+        std::unique_lock lock(mutex);
+        while (true) {
+            chunk_pushed.wait(lock, [this] { return !pending.empty() || stop; });
+            if (pending.empty()) {
+                return;
+            }
+            auto process_chunk = std::move(pending.front());
+            pending.pop_front();
+            busy = true;
+            // Frees a slot for the emitting thread while this chunk is processed.
+            chunk_done.notify_all();
+            lock.unlock();
+            std::exception_ptr chunk_error;
+            auto start = std::chrono::steady_clock::now();
+            try {
+                process_chunk();
+            } catch (...) {
+                chunk_error = std::current_exception();
+            }
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            lock.lock();
+            busy_time += elapsed;
+            busy = false;
+            if (chunk_error) {
+                error = chunk_error;
+                pending.clear();
+            }
+            // Also wakes the emitting threads that wait for a slot, since they don't need one after an error.
+            chunk_done.notify_all();
+        }
+    }
+
+    const std::string key;
+    std::deque<std::function<void()>> pending;
+    bool busy = false;
+    bool stop = false;
+    // The exception of the first chunk that failed.
+    std::exception_ptr error;
+    std::chrono::steady_clock::duration busy_time{};
+    std::mutex mutex;
+    std::condition_variable chunk_pushed;
+    std::condition_variable chunk_done;
+    // Started last, once the state it uses is initialized.
+    std::thread thread;
+};
+
+// Generates the subtraces of streamed events while simulation is still emitting them.
+// Each subtrace has a worker of its own, so that its chunks are processed in order
+// and each chunk's rows follow those of the previous one.
+class StreamingTraceGen {
+  public:
+    StreamingTraceGen(TraceContainer& trace)
+        : trace(trace)
+    {}
+
+    EventSinks get_sinks()
+    {
+        EventSinks sinks;
+        sinks.memory = make_sink<MemoryEvent>(
+            memory_worker, [this](const auto& events) { memory_builder.process(events, trace); });
+        sinks.alu = make_sink<AluEvent>(alu_worker, [this](const auto& events) { alu_builder.process(events, trace); });
+        sinks.range_check = make_sink<RangeCheckEvent>(
+            range_check_worker, [this](const auto& events) { range_check_builder.process(events, trace); });
+        sinks.poseidon2_hash = make_sink<Poseidon2HashEvent>(
+            poseidon2_hash_worker, [this](const auto& events) { poseidon2_builder.process_hash(events, trace); });
+        sinks.poseidon2_permutation =
+            make_sink<Poseidon2PermutationEvent>(poseidon2_permutation_worker, [this](const auto& events) {
+                poseidon2_builder.process_permutation(events, trace);
+            });
+        return sinks;
+    }
+
+    // Waits until all the chunks sent so far have been processed.
+    // Throws the exception of the first subtrace that failed, once none of them is writing to the trace anymore.
+    void wait()
+    {
+        std::exception_ptr error;
+        auto wait_for = [&error](SubtraceWorker& worker) {
+            try {
+                worker.wait();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        };
+        wait_for(memory_worker);
+        wait_for(alu_worker);
+        wait_for(range_check_worker);
+        wait_for(poseidon2_hash_worker);
+        wait_for(poseidon2_permutation_worker);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+  private:
+    template <typename Event, typename F>
+    static typename EventEmitter<Event>::Sink make_sink(SubtraceWorker& worker, F process)
+    {
+        return [&worker, process](typename EventEmitter<Event>::Container&& events) {
+            // Shared, so that copies of the task don't copy the events. They are freed once the task has run.
+            auto chunk = std::make_shared<typename EventEmitter<Event>::Container>(std::move(events));
+            worker.push([=]() { process(*chunk); });
+        };
+    }
+
+    TraceContainer& trace;
+    MemoryTraceBuilder memory_builder;
+    AluTraceBuilder alu_builder;
+    RangeCheckTraceBuilder range_check_builder;
+    Poseidon2TraceBuilder poseidon2_builder;
+    // Declared after the builders, so that the workers are joined before the builders are destroyed.
+    SubtraceWorker memory_worker{ "tracegen/memory" };
+    SubtraceWorker alu_worker{ "tracegen/alu" };
+    SubtraceWorker range_check_worker{ "tracegen/range_check" };
+    SubtraceWorker poseidon2_hash_worker{ "tracegen/poseidon2_hash" };
+    SubtraceWorker poseidon2_permutation_worker{ "tracegen/poseidon2_permutation" };
+};
+#else
+// Without threads there is nothing to overlap, so events are not streamed.
+class StreamingTraceGen {
+  public:
+    StreamingTraceGen(TraceContainer&) {}
+    EventSinks get_sinks() { return {}; }
+    void wait() {}
+};
+#endif
+
+AvmTraceGenHelper::AvmTraceGenHelper() = default;
+AvmTraceGenHelper::~AvmTraceGenHelper() = default;
+
+EventSinks AvmTraceGenHelper::start_streaming()
 {
-    TraceContainer trace;
+    streaming = std::make_unique<StreamingTraceGen>(trace);
+    return streaming->get_sinks();
+}
 
+TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events)
+{
     // We process the events in parallel. Ideally the jobs should access disjoint column sets.
     {
         auto jobs = concatenate(
@@ -286,6 +489,12 @@ TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events)
         AVM_TRACK_TIME("tracegen/traces", execute_jobs(jobs));
     }
 
+    // The streamed subtraces have been generating since simulation started. Wait for them to finish.
+    if (streaming != nullptr) {
+        AVM_TRACK_TIME("tracegen/streamed_traces_wait", streaming->wait());
+        streaming.reset();
+    }
+
     // Now we can compute lookups and permutations.
     {
         auto jobs_interactions = concatenate_jobs(Poseidon2TraceBuilder::lookup_jobs(),
@@ -310,7 +519,8 @@ TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events)
 
     check_interactions(trace);
     print_trace_stats(trace);
-    return trace;
+    // Leave a fresh trace behind, in case the helper is used again.
+    return std::exchange(trace, TraceContainer());
 }
 
 TraceContainer AvmTraceGenHelper::generate_precomputed_columns()
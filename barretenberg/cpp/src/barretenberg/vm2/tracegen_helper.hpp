@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
@@ -7,10 +9,20 @@ namespace bb::avm2 {
 
 class AvmTraceGenHelper {
   public:
-    AvmTraceGenHelper() = default;
+    AvmTraceGenHelper();
+    ~AvmTraceGenHelper();
 
+    // Starts generating the subtraces of the events sent to the returned sinks as they arrive, so that tracegen
+    // overlaps with simulation. The trace of these events is part of the one returned by generate_trace.
+    simulation::EventSinks start_streaming();
+    // Generates the trace of the events, waiting for any streamed events to be processed.
     tracegen::TraceContainer generate_trace(simulation::EventsContainer&& events);
     tracegen::TraceContainer generate_precomputed_columns();
+
+  private:
+    tracegen::TraceContainer trace;
+    // Tracegen of the streamed events, if started.
+    std::unique_ptr<class StreamingTraceGen> streaming;
 };
 
-} // namespace bb::avm2
\ No newline at end of file
+} // namespace bb::avm2
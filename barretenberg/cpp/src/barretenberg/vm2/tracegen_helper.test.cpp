@@ -0,0 +1,36 @@
+#ifndef NO_MULTITHREADING
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "barretenberg/vm2/tracegen_helper.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "barretenberg/vm2/simulation/events/alu_event.hpp"
+#include "barretenberg/vm2/simulation/events/events_container.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+using simulation::AluEvent;
+using simulation::AluOperation;
+
+TEST(AvmTraceGenHelperTest, StreamedTracegenErrorReachesCaller)
+{
+    AvmTraceGenHelper tracegen_helper;
+    auto sinks = tracegen_helper.start_streaming();
+    ASSERT_TRUE(sinks.alu);
+
+    // The ALU trace builder throws on an unknown operation. Emitting many more chunks than a worker queues checks
+    // that emitting doesn't block on a worker that failed.
+    for (size_t i = 0; i < 64; i++) {
+        sinks.alu({ AluEvent{ .operation = static_cast<AluOperation>(42) } });
+    }
+
+    EXPECT_THROW(tracegen_helper.generate_trace({}), std::runtime_error);
+}
+
+} // namespace
+} // namespace bb::avm2
+#endif
@@ -203,12 +203,34 @@ struct WorldStateMeta {
     }
 };
 
+/**
+ * @brief How much of the synched chain is persisted when blocks are committed in groups, see
+ * WorldState::set_group_commit
+ */
+struct GroupCommitStatus {
+    // The last block persisted to disk, any blocks beyond it up to the unfinalised block number are staged in memory
+    index_t committedBlockNumber{ 0 };
+    index_t numStagedBlocks{ 0 };
+
+    MSGPACK_FIELDS(committedBlockNumber, numStagedBlocks);
+
+    bool operator==(const GroupCommitStatus& other) const = default;
+
+    friend std::ostream& operator<<(std::ostream& os, const GroupCommitStatus& status)
+    {
+        os << "committedBlockNumber: " << status.committedBlockNumber
+           << ", numStagedBlocks: " << status.numStagedBlocks;
+        return os;
+    }
+};
+
 struct WorldStateStatusFull {
     WorldStateStatusSummary summary;
     WorldStateDBStats dbStats;
     WorldStateMeta meta;
+    GroupCommitStatus groupCommit;
 
-    MSGPACK_FIELDS(summary, dbStats, meta);
+    MSGPACK_FIELDS(summary, dbStats, meta, groupCommit);
 
     WorldStateStatusFull() = default;
     WorldStateStatusFull(const WorldStateStatusSummary& summary,
@@ -227,6 +249,7 @@ struct WorldStateStatusFull {
             summary = std::move(other.summary);
             dbStats = std::move(other.dbStats);
             meta = std::move(other.meta);
+            groupCommit = other.groupCommit;
         }
         return *this;
     }
@@ -237,12 +260,14 @@ struct WorldStateStatusFull {
 
     bool operator==(const WorldStateStatusFull& other) const
     {
-        return summary == other.summary && dbStats == other.dbStats && meta == other.meta;
+        return summary == other.summary && dbStats == other.dbStats && meta == other.meta &&
+               groupCommit == other.groupCommit;
     }
 
     friend std::ostream& operator<<(std::ostream& os, const WorldStateStatusFull& status)
     {
-        os << "Summary: " << status.summary << ", DB Stats " << status.dbStats << ", Meta " << status.meta;
+        os << "Summary: " << status.summary << ", DB Stats " << status.dbStats << ", Meta " << status.meta
+           << ", Group commit " << status.groupCommit;
         return os;
     }
 };
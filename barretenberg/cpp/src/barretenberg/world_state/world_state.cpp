@@ -16,6 +16,7 @@
 #include "barretenberg/world_state/world_state_stores.hpp"
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
@@ -25,6 +26,7 @@
 #include <ostream>
 #include <stdexcept>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -189,6 +191,7 @@ Fork::SharedPtr WorldState::retrieve_fork(const uint64_t& forkId) const
 }
 uint64_t WorldState::create_fork(const std::optional<index_t>& blockNumber)
 {
+    commit_staged_blocks_if_any();
     block_number_t blockNumberForFork = 0;
     if (!blockNumber.has_value()) {
         // we are forking at latest
@@ -206,6 +209,19 @@ uint64_t WorldState::create_fork(const std::optional<index_t>& blockNumber)
     return forkId;
 }
 
+uint64_t WorldState::create_fork_from_fork(const uint64_t& parentForkId)
+{
+    if (parentForkId == CANONICAL_FORK_ID) {
+        throw std::runtime_error("Unable to fork the uncommitted state of the canonical fork");
+    }
+    Fork::SharedPtr fork = create_new_fork(retrieve_fork(parentForkId));
+    std::unique_lock lock(mtx);
+    uint64_t forkId = _forkId++;
+    fork->_forkId = forkId;
+    _forks[forkId] = fork;
+    return forkId;
+}
+
 void WorldState::remove_forks_for_block(const block_number_t& blockNumber)
 {
     // capture the shared pointers outside of the lock scope so we are not under the lock when the objects are destroyed
@@ -284,6 +300,29 @@ Fork::SharedPtr WorldState::create_new_fork(const block_number_t& blockNumber)
     return fork;
 }
 
+Fork::SharedPtr WorldState::create_new_fork(const Fork::SharedPtr& parent)
+{
+    Fork::SharedPtr fork = std::make_shared<Fork>();
+    fork->_blockNumber = parent->_blockNumber;
+    for (auto& [id, tree] : parent->_trees) {
+        MerkleTreeId tree_id = id;
+        std::visit(
+            [&](auto&& wrapper) {
+                using TreeType = typename std::decay_t<decltype(wrapper)>::TreeType;
+                auto store = wrapper.tree->fork_uncommitted_store();
+                std::unique_ptr<TreeType> forked;
+                if constexpr (std::is_same_v<TreeType, FrTree>) {
+                    forked = std::make_unique<TreeType>(std::move(store), _workers);
+                } else {
+                    forked = std::make_unique<TreeType>(std::move(store), _workers, _initial_tree_size.at(tree_id));
+                }
+                fork->_trees.insert({ tree_id, TreeWithStore(std::move(forked)) });
+            },
+            tree);
+    }
+    return fork;
+}
+
 TreeMetaResponse WorldState::get_tree_info(const WorldStateRevision& revision, MerkleTreeId tree_id) const
 {
     Fork::SharedPtr fork = retrieve_fork(revision.forkId);
@@ -456,6 +495,38 @@ fr_sibling_path WorldState::get_sibling_path(const WorldStateRevision& revision,
         fork->_trees.at(tree_id));
 }
 
+std::vector<fr_sibling_path> WorldState::get_sibling_paths(const WorldStateRevision& revision,
+                                                          MerkleTreeId tree_id,
+                                                          const std::vector<index_t>& leaf_indices) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+
+    return std::visit(
+        [&leaf_indices, revision](auto&& wrapper) {
+            Signal signal(1);
+            TypedResponse<GetSiblingPathsResponse> local;
+
+            auto callback = [&signal, &local](TypedResponse<GetSiblingPathsResponse>& response) {
+                local = std::move(response);
+                signal.signal_level(0);
+            };
+
+            if (revision.blockNumber) {
+                wrapper.tree->get_sibling_paths(
+                    leaf_indices, revision.blockNumber, callback, revision.includeUncommitted);
+            } else {
+                wrapper.tree->get_sibling_paths(leaf_indices, callback, revision.includeUncommitted);
+            }
+            signal.wait_for_level(0);
+
+            if (!local.success) {
+                throw std::runtime_error(local.message);
+            }
+            return std::move(local.inner.paths);
+        },
+        fork->_trees.at(tree_id));
+}
+
 void WorldState::get_block_numbers_for_leaf_indices(const WorldStateRevision& revision,
                                                     MerkleTreeId tree_id,
                                                     const std::vector<index_t>& leafIndices,
@@ -515,6 +586,15 @@ void WorldState::update_archive(const StateReference& block_state_ref,
 }
 
 std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
+{
+    std::pair<bool, std::string> result = commit_trees(status, CommitMode::COMMIT);
+    if (result.first) {
+        _numStagedBlocks = 0;
+    }
+    return result;
+}
+
+std::pair<bool, std::string> WorldState::commit_trees(WorldStateStatusFull& status, CommitMode mode)
 {
     // NOTE: the calling code is expected to ensure no other reads or writes happen during commit
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
@@ -524,8 +604,13 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
 
     {
         auto& wrapper = std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(MerkleTreeId::NULLIFIER_TREE));
-        commit_tree(
-            status.dbStats.nullifierTreeStats, signal, *wrapper.tree, success, message, status.meta.nullifierTreeMeta);
+        commit_tree(status.dbStats.nullifierTreeStats,
+                    signal,
+                    *wrapper.tree,
+                    success,
+                    message,
+                    status.meta.nullifierTreeMeta,
+                    mode);
     }
     {
         auto& wrapper = std::get<TreeWithStore<PublicDataTree>>(fork->_trees.at(MerkleTreeId::PUBLIC_DATA_TREE));
@@ -534,31 +619,100 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
                     *wrapper.tree,
                     success,
                     message,
-                    status.meta.publicDataTreeMeta);
+                    status.meta.publicDataTreeMeta,
+                    mode);
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::NOTE_HASH_TREE));
-        commit_tree(
-            status.dbStats.noteHashTreeStats, signal, *wrapper.tree, success, message, status.meta.noteHashTreeMeta);
+        commit_tree(status.dbStats.noteHashTreeStats,
+                    signal,
+                    *wrapper.tree,
+                    success,
+                    message,
+                    status.meta.noteHashTreeMeta,
+                    mode);
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
-        commit_tree(
-            status.dbStats.messageTreeStats, signal, *wrapper.tree, success, message, status.meta.messageTreeMeta);
+        commit_tree(status.dbStats.messageTreeStats,
+                    signal,
+                    *wrapper.tree,
+                    success,
+                    message,
+                    status.meta.messageTreeMeta,
+                    mode);
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::ARCHIVE));
-        commit_tree(
-            status.dbStats.archiveTreeStats, signal, *wrapper.tree, success, message, status.meta.archiveTreeMeta);
+        commit_tree(status.dbStats.archiveTreeStats,
+                    signal,
+                    *wrapper.tree,
+                    success,
+                    message,
+                    status.meta.archiveTreeMeta,
+                    mode);
     }
 
     signal.wait_for_level(0);
     return std::make_pair(success.load(), message);
 }
 
+std::pair<bool, std::string> WorldState::commit_or_stage_block(WorldStateStatusFull& status)
+{
+    // max_delay is only checked here, see set_group_commit
+    bool stage = _numStagedBlocks + 1 < _groupCommitMaxBlocks;
+    if (stage && _numStagedBlocks > 0 && _groupCommitMaxDelay.count() > 0) {
+        stage = std::chrono::steady_clock::now() - _firstStagedAt < _groupCommitMaxDelay;
+    }
+    if (!stage) {
+        return commit(status);
+    }
+    std::pair<bool, std::string> result = commit_trees(status, CommitMode::STAGE);
+    if (result.first && _numStagedBlocks++ == 0) {
+        _firstStagedAt = std::chrono::steady_clock::now();
+    }
+    return result;
+}
+
+void WorldState::commit_staged_blocks_if_any()
+{
+    if (_numStagedBlocks == 0) {
+        return;
+    }
+    WorldStateStatusFull status;
+    std::pair<bool, std::string> result = commit_trees(status, CommitMode::COMMIT_STAGED);
+    if (!result.first) {
+        throw std::runtime_error("Failed to commit staged blocks: " + result.second);
+    }
+    _numStagedBlocks = 0;
+}
+
+void WorldState::set_group_commit(uint32_t max_blocks, std::chrono::milliseconds max_delay)
+{
+    if (max_blocks == 0) {
+        throw std::runtime_error("Group commit requires at least 1 block per group");
+    }
+    // any blocks staged under the previous settings are committed now
+    commit_staged_blocks_if_any();
+    _groupCommitMaxBlocks = max_blocks;
+    _groupCommitMaxDelay = max_delay;
+}
+
+WorldStateStatusFull WorldState::commit_staged_blocks()
+{
+    WorldStateStatusFull status;
+    std::pair<bool, std::string> result = commit_trees(status, CommitMode::COMMIT_STAGED);
+    if (!result.first) {
+        throw std::runtime_error("Failed to commit staged blocks: " + result.second);
+    }
+    _numStagedBlocks = 0;
+    populate_status_summary(status);
+    return status;
+}
+
 void WorldState::rollback()
 {
     // NOTE: the calling code is expected to ensure no other reads or writes happen during rollback
@@ -585,7 +739,7 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
     WorldStateStatusFull status;
     if (is_same_state_reference(WorldStateRevision::uncommitted(), block_state_ref) &&
         is_archive_tip(WorldStateRevision::uncommitted(), block_header_hash)) {
-        std::pair<bool, std::string> result = commit(status);
+        std::pair<bool, std::string> result = commit_or_stage_block(status);
         if (!result.first) {
             throw std::runtime_error(result.second);
         }
@@ -665,7 +819,7 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
         throw std::runtime_error("Can't synch block: block state does not match world state");
     }
 
-    std::pair<bool, std::string> result = commit(status);
+    std::pair<bool, std::string> result = commit_or_stage_block(status);
     if (!result.first) {
         throw std::runtime_error(result.second);
     }
@@ -713,6 +867,7 @@ GetLowIndexedLeafResponse WorldState::find_low_leaf_index(const WorldStateRevisi
 
 WorldStateStatusSummary WorldState::set_finalised_blocks(const index_t& toBlockNumber)
 {
+    commit_staged_blocks_if_any();
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
     TreeMetaResponse archive_state = get_tree_info(revision, MerkleTreeId::ARCHIVE);
     if (toBlockNumber <= archive_state.meta.finalisedBlockHeight) {
@@ -729,6 +884,7 @@ WorldStateStatusSummary WorldState::set_finalised_blocks(const index_t& toBlockN
 }
 WorldStateStatusFull WorldState::unwind_blocks(const index_t& toBlockNumber)
 {
+    commit_staged_blocks_if_any();
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
     TreeMetaResponse archive_state = get_tree_info(revision, MerkleTreeId::ARCHIVE);
     if (toBlockNumber >= archive_state.meta.unfinalisedBlockHeight) {
@@ -745,6 +901,7 @@ WorldStateStatusFull WorldState::unwind_blocks(const index_t& toBlockNumber)
 }
 WorldStateStatusFull WorldState::remove_historical_blocks(const index_t& toBlockNumber)
 {
+    commit_staged_blocks_if_any();
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
     TreeMetaResponse archive_state = get_tree_info(revision, MerkleTreeId::ARCHIVE);
     if (toBlockNumber <= archive_state.meta.oldestHistoricBlock) {
@@ -996,7 +1153,7 @@ void WorldState::get_status_summary_from_meta_responses(WorldStateStatusSummary&
     status.treesAreSynched = determine_if_synched(metaResponses);
 }
 
-void WorldState::populate_status_summary(WorldStateStatusFull& status)
+void WorldState::populate_status_summary(WorldStateStatusFull& status) const
 {
     status.summary.finalisedBlockNumber = status.meta.archiveTreeMeta.finalisedBlockHeight;
     status.summary.unfinalisedBlockNumber = status.meta.archiveTreeMeta.unfinalisedBlockHeight;
@@ -1006,6 +1163,8 @@ void WorldState::populate_status_summary(WorldStateStatusFull& status)
         status.meta.noteHashTreeMeta.unfinalisedBlockHeight == status.summary.unfinalisedBlockNumber &&
         status.meta.nullifierTreeMeta.unfinalisedBlockHeight == status.summary.unfinalisedBlockNumber &&
         status.meta.publicDataTreeMeta.unfinalisedBlockHeight == status.summary.unfinalisedBlockNumber;
+    status.groupCommit.numStagedBlocks = _numStagedBlocks;
+    status.groupCommit.committedBlockNumber = status.summary.unfinalisedBlockNumber - _numStagedBlocks;
 }
 
 bool WorldState::is_same_state_reference(const WorldStateRevision& revision, const StateReference& state_ref) const
@@ -1037,6 +1196,10 @@ bool WorldState::determine_if_synched(std::array<TreeMeta, NUM_TREES>& metaRespo
 
 void WorldState::checkpoint(const uint64_t& forkId)
 {
+    if (forkId == CANONICAL_FORK_ID) {
+        // staged blocks are held behind a checkpoint of their own
+        commit_staged_blocks_if_any();
+    }
     Fork::SharedPtr fork = retrieve_fork(forkId);
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
     std::array<Response, NUM_TREES> local;
@@ -19,6 +19,7 @@
 #include "barretenberg/world_state/types.hpp"
 #include "barretenberg/world_state/world_state_stores.hpp"
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <exception>
 #include <iterator>
@@ -132,6 +133,18 @@ class WorldState {
                                                           MerkleTreeId tree_id,
                                                           index_t leaf_index) const;
 
+    /**
+     * @brief Get the sibling paths for a set of leaves in a tree, reading the nodes shared by several paths once
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_indices The indices of the leaves
+     * @return std::vector<crypto::merkle_tree::fr_sibling_path> The paths, in the order of the indices
+     */
+    std::vector<crypto::merkle_tree::fr_sibling_path> get_sibling_paths(const WorldStateRevision& revision,
+                                                                        MerkleTreeId tree_id,
+                                                                        const std::vector<index_t>& leaf_indices) const;
+
     void get_block_numbers_for_leaf_indices(const WorldStateRevision& revision,
                                             MerkleTreeId tree_id,
                                             const std::vector<index_t>& leafIndices,
@@ -259,6 +272,19 @@ class WorldState {
     void rollback();
 
     uint64_t create_fork(const std::optional<index_t>& blockNumber);
+
+    /**
+     * @brief Creates a fork of another fork's uncommitted state in constant time
+     * @details The parent's uncommitted state is shared copy-on-write with the new fork: it becomes an immutable
+     * snapshot that both forks read through, ahead of the persisted state, and each fork writes to its own layer above
+     * it. The parent must not have active checkpoints and no other operations may be in progress on it.
+     *
+     * Only forks of forks are created this way. Forks of the latest or of a historic block (create_fork) still start
+     * with empty caches and read committed state through LMDB's shared memory map, and the uncommitted state of the
+     * canonical fork cannot be forked. Once forked, the parent also reads through the shared layers, which costs up to
+     * ContentAddressedCache::MAX_SNAPSHOT_LAYERS lookups per read (see layered_cache_read_bench).
+     */
+    uint64_t create_fork_from_fork(const uint64_t& parentForkId);
     void delete_fork(const uint64_t& forkId);
 
     WorldStateStatusSummary set_finalised_blocks(const index_t& toBlockNumber);
@@ -273,11 +299,47 @@ class WorldState {
                                     const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
                                     const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes);
 
+    /**
+     * @brief Sets how many blocks sync_block may stage in memory before committing them together, in a single write
+     * transaction per tree, and how long the oldest of them may remain staged. By default every block is committed as
+     * it is synched, which is also the behaviour with max_blocks of 1. A max_delay of zero imposes no time limit.
+     * @details Staged blocks are part of the uncommitted state of the canonical fork. They are visible to reads of
+     * uncommitted state but not to reads of committed state or of historic blocks. They are committed before any
+     * operation that depends on the committed chain (forking, finalising, unwinding, removing historic blocks,
+     * checkpointing the canonical fork) and by commit and commit_staged_blocks.
+     *
+     * max_delay is only checked by sync_block, when the next block arrives: there is no timer here, as the operations
+     * on the canonical fork must be serialised by the caller. A caller that sets a max_delay and may stop synching
+     * blocks must call commit_staged_blocks itself once max_delay has passed (NativeWorldStateService does so).
+     *
+     * If the process exits with blocks staged, they are lost and need to be synched again from the last committed
+     * block, reported as GroupCommitStatus::committedBlockNumber. Each tree commits a group in its own write
+     * transaction, so a crash while a group is being committed can leave some trees at the end of the group and the
+     * others at its start, up to max_blocks blocks apart, where a crash without group commit leaves them at most one
+     * block apart. The world state then reports treesAreSynched as false and refuses to sync further blocks, as it does
+     * after an interrupted commit of a single block, and the node requires its world state to be re-synched.
+     */
+    void set_group_commit(uint32_t max_blocks, std::chrono::milliseconds max_delay);
+
+    /**
+     * @brief Commits any blocks staged by sync_block
+     */
+    WorldStateStatusFull commit_staged_blocks();
+
     void checkpoint(const uint64_t& forkId);
     void commit_checkpoint(const uint64_t& forkId);
     void revert_checkpoint(const uint64_t& forkId);
 
   private:
+    enum class CommitMode {
+        // Persist the uncommitted state as a new block, together with any staged blocks
+        COMMIT,
+        // Complete a block from the uncommitted state without persisting it
+        STAGE,
+        // Persist only the staged blocks
+        COMMIT_STAGED,
+    };
+
     std::shared_ptr<bb::ThreadPool> _workers;
     WorldStateStores::Ptr _persistentStores;
 
@@ -288,6 +350,12 @@ class WorldState {
     uint64_t _forkId = 0;
     uint32_t _initial_header_generator_point;
 
+    // Group commit of synched blocks, the caller is expected to serialise the operations on the canonical fork
+    uint32_t _groupCommitMaxBlocks = 1;
+    std::chrono::milliseconds _groupCommitMaxDelay{ 0 };
+    uint32_t _numStagedBlocks = 0;
+    std::chrono::steady_clock::time_point _firstStagedAt;
+
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
     void create_canonical_fork(const std::string& dataDir,
                                const std::unordered_map<MerkleTreeId, uint64_t>& dbSize,
@@ -296,6 +364,7 @@ class WorldState {
 
     Fork::SharedPtr retrieve_fork(const uint64_t& forkId) const;
     Fork::SharedPtr create_new_fork(const block_number_t& blockNumber);
+    Fork::SharedPtr create_new_fork(const Fork::SharedPtr& parent);
     void remove_forks_for_block(const block_number_t& blockNumber);
 
     bool unwind_block(const block_number_t& blockNumber, WorldStateStatusFull& status);
@@ -323,7 +392,13 @@ class WorldState {
     static void get_status_summary_from_meta_responses(WorldStateStatusSummary& status,
                                                        std::array<TreeMeta, NUM_TREES>& metaResponses);
 
-    static void populate_status_summary(WorldStateStatusFull& status);
+    void populate_status_summary(WorldStateStatusFull& status) const;
+
+    std::pair<bool, std::string> commit_trees(WorldStateStatusFull& status, CommitMode mode);
+
+    std::pair<bool, std::string> commit_or_stage_block(WorldStateStatusFull& status);
+
+    void commit_staged_blocks_if_any();
 
     template <typename TreeType>
     void commit_tree(TreeDBStats& dbStats,
@@ -331,7 +406,8 @@ class WorldState {
                      TreeType& tree,
                      std::atomic_bool& success,
                      std::string& message,
-                     TreeMeta& meta);
+                     TreeMeta& meta,
+                     CommitMode mode);
 
     template <typename TreeType>
     void unwind_tree(TreeDBStats& dbStats,
@@ -358,9 +434,10 @@ void WorldState::commit_tree(TreeDBStats& dbStats,
                              TreeType& tree,
                              std::atomic_bool& success,
                              std::string& message,
-                             TreeMeta& meta)
+                             TreeMeta& meta,
+                             CommitMode mode)
 {
-    tree.commit([&](TypedResponse<CommitResponse>& response) {
+    auto completion = [&](TypedResponse<CommitResponse>& response) {
         bool expected = true;
         if (!response.success && success.compare_exchange_strong(expected, false)) {
             message = response.message;
@@ -368,7 +445,18 @@ void WorldState::commit_tree(TreeDBStats& dbStats,
         dbStats = std::move(response.inner.stats);
         meta = std::move(response.inner.meta);
         signal.signal_decrement();
-    });
+    };
+    switch (mode) {
+    case CommitMode::COMMIT:
+        tree.commit(completion);
+        break;
+    case CommitMode::STAGE:
+        tree.stage_block(completion);
+        break;
+    case CommitMode::COMMIT_STAGED:
+        tree.commit_staged_blocks(completion);
+        break;
+    }
 }
 
 template <typename TreeType>
@@ -8,6 +8,7 @@
 #include "barretenberg/world_state/fork.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <gtest/gtest.h>
@@ -400,6 +401,28 @@ TEST_F(WorldStateTest, AppendOnlyTrees)
     }
 }
 
+TEST_F(WorldStateTest, GetSiblingPaths)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42), fr(43), fr(44) });
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(
+        MerkleTreeId::NULLIFIER_TREE, { { 150 }, { 142 } }, 0);
+
+    std::vector<index_t> indices{ 130, 2, 0, 129, 2, 1, 128 };
+    for (auto revision : { WorldStateRevision::committed(), WorldStateRevision::uncommitted() }) {
+        for (auto tree_id : { MerkleTreeId::NOTE_HASH_TREE,
+                              MerkleTreeId::NULLIFIER_TREE,
+                              MerkleTreeId::PUBLIC_DATA_TREE,
+                              MerkleTreeId::ARCHIVE }) {
+            auto paths = ws.get_sibling_paths(revision, tree_id, indices);
+            EXPECT_EQ(paths.size(), indices.size());
+            for (size_t i = 0; i < indices.size(); ++i) {
+                EXPECT_EQ(paths[i], ws.get_sibling_path(revision, tree_id, indices[i]));
+            }
+        }
+    }
+}
+
 TEST_F(WorldStateTest, AppendOnlyAllowDuplicates)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -772,6 +795,89 @@ TEST_F(WorldStateTest, SyncEmptyBlock)
     EXPECT_EQ(indices, expected);
 }
 
+TEST_F(WorldStateTest, SyncBlocksInGroups)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    ws.set_group_commit(3, std::chrono::milliseconds(0));
+
+    std::vector<StateReference> block_state_refs;
+    auto sync_next_block = [&]() {
+        auto block_number = static_cast<uint64_t>(block_state_refs.size() + 1);
+        fr note_hash(block_number * 10);
+        fr message(block_number * 10 + 1);
+        NullifierLeafValue nullifier(1000 + block_number);
+        PublicDataLeafValue public_write(1000 + block_number, 1);
+
+        // work out the state reference of the block on top of any staged blocks, then discard it
+        ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { note_hash });
+        ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, { message });
+        ws.append_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { nullifier });
+        ws.append_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, { public_write });
+        block_state_refs.push_back(ws.get_state_reference(WorldStateRevision::uncommitted()));
+        ws.rollback();
+
+        return ws.sync_block(
+            block_state_refs.back(), fr(block_number), { note_hash }, { message }, { nullifier }, { public_write });
+    };
+    auto expect_committed_block = [&](block_number_t block_number) {
+        auto archive = ws.get_tree_info(WorldStateRevision::committed(), MerkleTreeId::ARCHIVE);
+        EXPECT_EQ(archive.meta.unfinalisedBlockHeight, block_number);
+        auto state_ref = ws.get_state_reference(WorldStateRevision::committed());
+        for (const auto& [tree_id, snapshot] : block_state_refs[block_number - 1]) {
+            EXPECT_EQ(state_ref.at(tree_id), snapshot);
+        }
+    };
+
+    // the first two blocks are staged, the third commits all of them
+    WorldStateStatusFull status = sync_next_block();
+    EXPECT_EQ(status.summary, WorldStateStatusSummary(1, 0, 1, true));
+    EXPECT_EQ(status.groupCommit, (GroupCommitStatus{ .committedBlockNumber = 0, .numStagedBlocks = 1 }));
+    EXPECT_EQ(ws.get_tree_info(WorldStateRevision::committed(), MerkleTreeId::ARCHIVE).meta.unfinalisedBlockHeight, 0);
+
+    status = sync_next_block();
+    EXPECT_EQ(status.summary, WorldStateStatusSummary(2, 0, 1, true));
+    EXPECT_EQ(status.groupCommit, (GroupCommitStatus{ .committedBlockNumber = 0, .numStagedBlocks = 2 }));
+    auto uncommitted_state_ref = ws.get_state_reference(WorldStateRevision::uncommitted());
+    for (const auto& [tree_id, snapshot] : block_state_refs[1]) {
+        EXPECT_EQ(uncommitted_state_ref.at(tree_id), snapshot);
+    }
+
+    status = sync_next_block();
+    EXPECT_EQ(status.summary, WorldStateStatusSummary(3, 0, 1, true));
+    EXPECT_EQ(status.groupCommit, (GroupCommitStatus{ .committedBlockNumber = 3, .numStagedBlocks = 0 }));
+    expect_committed_block(3);
+
+    // staged blocks can be committed explicitly
+    status = sync_next_block();
+    EXPECT_EQ(status.groupCommit, (GroupCommitStatus{ .committedBlockNumber = 3, .numStagedBlocks = 1 }));
+    expect_committed_block(3);
+    status = ws.commit_staged_blocks();
+    EXPECT_EQ(status.summary, WorldStateStatusSummary(4, 0, 1, true));
+    EXPECT_EQ(status.groupCommit, (GroupCommitStatus{ .committedBlockNumber = 4, .numStagedBlocks = 0 }));
+    expect_committed_block(4);
+
+    // and are committed before forking
+    sync_next_block();
+    ws.create_fork(std::nullopt);
+    expect_committed_block(5);
+
+    // every block was committed as if it was synched on its own
+    for (uint64_t block_number = 1; block_number <= 5; block_number++) {
+        assert_leaf_value(
+            ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, block_number - 1, fr(block_number * 10));
+        assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, block_number, fr(block_number));
+    }
+    std::vector<std::optional<block_number_t>> blockNumbers;
+    ws.get_block_numbers_for_leaf_indices(
+        WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, { 0, 2, 4 }, blockNumbers);
+    std::vector<std::optional<block_number_t>> expected{ 1, 3, 5 };
+    EXPECT_EQ(blockNumbers, expected);
+
+    // blocks can be unwound across the group boundaries
+    ws.unwind_blocks(2);
+    expect_committed_block(2);
+}
+
 TEST_F(WorldStateTest, ForkingAtBlock0SameState)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -890,6 +996,51 @@ TEST_F(WorldStateTest, BuildsABlockInAFork)
     EXPECT_EQ(fork_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
 }
 
+TEST_F(WorldStateTest, ForksTheUncommittedStateOfAFork)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    auto build_first_half = [&](uint64_t fork_id) {
+        ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 42 }, fork_id);
+        ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 150 } }, 0, fork_id);
+        ws.batch_insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, { { 150, 1 } }, 0, fork_id);
+    };
+    auto build_second_half = [&](uint64_t fork_id) {
+        ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 43 }, fork_id);
+        ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 200 } }, 0, fork_id);
+        ws.batch_insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, { { 150, 2 } }, 0, fork_id);
+    };
+    auto uncommitted = [](uint64_t fork_id) {
+        return WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true };
+    };
+
+    EXPECT_THROW(ws.create_fork_from_fork(CANONICAL_FORK_ID), std::runtime_error);
+
+    auto parent_id = ws.create_fork(std::nullopt);
+    build_first_half(parent_id);
+    auto parent_state_ref = ws.get_state_reference(uncommitted(parent_id));
+
+    auto child_id = ws.create_fork_from_fork(parent_id);
+    EXPECT_EQ(ws.get_state_reference(uncommitted(child_id)), parent_state_ref);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision{ .forkId = child_id, .includeUncommitted = false }),
+              ws.get_state_reference(WorldStateRevision::committed()));
+
+    // the child's updates are built on the parent's state without changing it
+    build_second_half(child_id);
+    EXPECT_EQ(ws.get_state_reference(uncommitted(parent_id)), parent_state_ref);
+
+    // and match the same updates made to a single fork
+    auto expected_id = ws.create_fork(std::nullopt);
+    build_first_half(expected_id);
+    build_second_half(expected_id);
+    auto child_state_ref = ws.get_state_reference(uncommitted(child_id));
+    EXPECT_EQ(child_state_ref, ws.get_state_reference(uncommitted(expected_id)));
+
+    // the child outlives its parent
+    ws.delete_fork(parent_id);
+    assert_leaf_value(ws, uncommitted(child_id), MerkleTreeId::NOTE_HASH_TREE, 0, fr(42));
+    assert_leaf_value(ws, uncommitted(child_id), MerkleTreeId::NOTE_HASH_TREE, 1, fr(43));
+}
+
 TEST_F(WorldStateTest, GetBlockForIndex)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
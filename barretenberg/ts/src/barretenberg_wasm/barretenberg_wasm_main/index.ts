@@ -94,6 +94,10 @@ export class BarretenbergWasmMain extends BarretenbergWasmBase {
           // then we return 1, which should cause any algos using threading to just not create a thread.
           return this.remoteWasms.length + 1;
         },
+        env_numa_policy: () => {
+          // Threads are not pinned to cores in the browser or in node workers.
+          return 0;
+        },
       },
     };
     /* eslint-enable camelcase */
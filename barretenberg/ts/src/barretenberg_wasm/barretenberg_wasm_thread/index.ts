@@ -38,6 +38,10 @@ export class BarretenbergWasmThread extends BarretenbergWasmBase {
           // We return 1, which should cause any algos using threading to just not create a thread.
           return 1;
         },
+        env_numa_policy: () => {
+          // Threads are not pinned to cores in the browser or in node workers.
+          return 0;
+        },
       },
     };
     /* eslint-enable camelcase */
@@ -28,6 +28,7 @@ import {
   type WorldStateRevision,
   blockStateReference,
   treeStateReferenceToSnapshot,
+  worldStateRevision,
 } from './message.js';
 import type { NativeWorldStateInstance } from './native_world_state_instance.js';
 
@@ -124,6 +125,16 @@ export class MerkleTreesFacade implements MerkleTreeReadOperations {
     return new SiblingPath(siblingPath.length, siblingPath) as any;
   }
 
+  async getSiblingPaths<N extends number>(treeId: MerkleTreeId, leafIndices: bigint[]): Promise<SiblingPath<N>[]> {
+    const siblingPaths = await this.instance.call(WorldStateMessageType.GET_SIBLING_PATHS, {
+      leafIndices,
+      revision: this.revision,
+      treeId,
+    });
+
+    return siblingPaths.map(path => new SiblingPath(path.length, path) as any);
+  }
+
   async getStateReference(): Promise<StateReference> {
     const resp = await this.instance.call(WorldStateMessageType.GET_STATE_REFERENCE, {
       revision: this.revision,
@@ -186,6 +197,22 @@ export class MerkleTreesForkFacade extends MerkleTreesFacade implements MerkleTr
     assert.equal(revision.includeUncommitted, true, 'Fork must include uncommitted data');
     super(instance, initialHeader, revision);
   }
+
+  /**
+   * Creates a fork of this fork's uncommitted state. The state is shared copy-on-write, so this is cheap regardless of
+   * how much has been written to this fork. This fork must not have any active checkpoints.
+   */
+  async fork(): Promise<MerkleTreesForkFacade> {
+    const resp = await this.instance.call(WorldStateMessageType.CREATE_FORK_FROM_FORK, {
+      forkId: this.revision.forkId,
+    });
+    return new MerkleTreesForkFacade(
+      this.instance,
+      this.initialHeader,
+      worldStateRevision(true, resp.forkId, this.revision.blockNumber),
+    );
+  }
+
   async updateArchive(header: BlockHeader): Promise<void> {
     await this.instance.call(WorldStateMessageType.UPDATE_ARCHIVE, {
       forkId: this.revision.forkId,
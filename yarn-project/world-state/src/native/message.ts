@@ -43,6 +43,13 @@ export enum WorldStateMessageType {
 
   COPY_STORES,
 
+  GET_SIBLING_PATHS,
+
+  SET_GROUP_COMMIT,
+  COMMIT_STAGED_BLOCKS,
+
+  CREATE_FORK_FROM_FORK,
+
   CLOSE = 999,
 }
 
@@ -108,6 +115,10 @@ export interface TreeDBStats {
   leafIndicesDBStats: DBStats;
   /** Stats for the 'block indices' DB */
   blockIndicesDBStats: DBStats;
+  /** The number of node reads served by the node cache */
+  nodeCacheHits: bigint;
+  /** The number of node reads that missed the node cache */
+  nodeCacheMisses: bigint;
 }
 
 export interface WorldStateMeta {
@@ -136,10 +147,18 @@ export interface WorldStateDBStats {
   nullifierTreeStats: TreeDBStats;
 }
 
+export interface GroupCommitStatus {
+  /** Last block persisted to disk, blocks beyond it up to the unfinalised block number are staged in memory */
+  committedBlockNumber: bigint;
+  /** Number of synched blocks staged in memory, waiting to be committed together */
+  numStagedBlocks: bigint;
+}
+
 export interface WorldStateStatusFull {
   summary: WorldStateStatusSummary;
   dbStats: WorldStateDBStats;
   meta: WorldStateMeta;
+  groupCommit: GroupCommitStatus;
 }
 
 export function buildEmptyDBStats() {
@@ -160,6 +179,8 @@ export function buildEmptyTreeDBStats() {
     leafKeysDBStats: buildEmptyDBStats(),
     leafPreimagesDBStats: buildEmptyDBStats(),
     blockIndicesDBStats: buildEmptyDBStats(),
+    nodeCacheHits: 0n,
+    nodeCacheMisses: 0n,
   } as TreeDBStats;
 }
 
@@ -207,11 +228,19 @@ export function buildEmptyWorldStateSummary() {
   } as WorldStateStatusSummary;
 }
 
+export function buildEmptyGroupCommitStatus() {
+  return {
+    committedBlockNumber: 0n,
+    numStagedBlocks: 0n,
+  } as GroupCommitStatus;
+}
+
 export function buildEmptyWorldStateStatusFull() {
   return {
     meta: buildEmptyWorldStateMeta(),
     dbStats: buildEmptyWorldStateDBStats(),
     summary: buildEmptyWorldStateSummary(),
+    groupCommit: buildEmptyGroupCommitStatus(),
   } as WorldStateStatusFull;
 }
 
@@ -246,6 +275,8 @@ export function sanitiseTreeDBStats(stats: TreeDBStats) {
   stats.nodesDBStats = sanitiseDBStats(stats.nodesDBStats);
   stats.mapSize = BigInt(stats.mapSize);
   stats.physicalFileSize = BigInt(stats.physicalFileSize);
+  stats.nodeCacheHits = BigInt(stats.nodeCacheHits);
+  stats.nodeCacheMisses = BigInt(stats.nodeCacheMisses);
   return stats;
 }
 
@@ -267,10 +298,17 @@ export function sanitiseWorldStateTreeMeta(meta: WorldStateMeta) {
   return meta;
 }
 
+export function sanitiseGroupCommitStatus(status: GroupCommitStatus) {
+  status.committedBlockNumber = BigInt(status.committedBlockNumber);
+  status.numStagedBlocks = BigInt(status.numStagedBlocks);
+  return status;
+}
+
 export function sanitiseFullStatus(status: WorldStateStatusFull) {
   status.dbStats = sanitiseWorldStateDBStats(status.dbStats);
   status.summary = sanitiseSummary(status.summary);
   status.meta = sanitiseWorldStateTreeMeta(status.meta);
+  status.groupCommit = sanitiseGroupCommitStatus(status.groupCommit);
   return status;
 }
 
@@ -332,6 +370,11 @@ interface GetBlockNumbersForLeafIndicesResponse {
 interface GetSiblingPathRequest extends WithTreeId, WithLeafIndex, WithWorldStateRevision {}
 type GetSiblingPathResponse = Buffer[];
 
+interface GetSiblingPathsRequest extends WithTreeId, WithWorldStateRevision {
+  leafIndices: bigint[];
+}
+type GetSiblingPathsResponse = Buffer[][];
+
 interface GetStateReferenceRequest extends WithWorldStateRevision {}
 interface GetStateReferenceResponse {
   state: Record<MerkleTreeId, TreeStateReference>;
@@ -420,6 +463,13 @@ interface CopyStoresRequest extends WithCanonicalForkId {
   compact: boolean;
 }
 
+interface SetGroupCommitRequest extends WithCanonicalForkId {
+  /** Maximum number of synched blocks committed together */
+  maxBlocks: number;
+  /** Maximum time the first of them may wait to be committed, zero for no limit */
+  maxDelayMs: number;
+}
+
 export type WorldStateRequestCategories = WithForkId | WithWorldStateRevision | WithCanonicalForkId;
 
 export function isWithForkId(body: WorldStateRequestCategories): body is WithForkId {
@@ -442,6 +492,7 @@ export type WorldStateRequest = {
   [WorldStateMessageType.GET_LEAF_VALUE]: GetLeafRequest;
   [WorldStateMessageType.GET_LEAF_PREIMAGE]: GetLeafPreImageRequest;
   [WorldStateMessageType.GET_SIBLING_PATH]: GetSiblingPathRequest;
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsRequest;
   [WorldStateMessageType.GET_BLOCK_NUMBERS_FOR_LEAF_INDICES]: GetBlockNumbersForLeafIndicesRequest;
 
   [WorldStateMessageType.FIND_LEAF_INDICES]: FindLeafIndicesRequest;
@@ -473,6 +524,11 @@ export type WorldStateRequest = {
 
   [WorldStateMessageType.COPY_STORES]: CopyStoresRequest;
 
+  [WorldStateMessageType.SET_GROUP_COMMIT]: SetGroupCommitRequest;
+  [WorldStateMessageType.COMMIT_STAGED_BLOCKS]: WithCanonicalForkId;
+
+  [WorldStateMessageType.CREATE_FORK_FROM_FORK]: WithForkId;
+
   [WorldStateMessageType.CLOSE]: WithCanonicalForkId;
 };
 
@@ -484,6 +540,7 @@ export type WorldStateResponse = {
   [WorldStateMessageType.GET_LEAF_VALUE]: GetLeafResponse;
   [WorldStateMessageType.GET_LEAF_PREIMAGE]: GetLeafPreImageResponse;
   [WorldStateMessageType.GET_SIBLING_PATH]: GetSiblingPathResponse;
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsResponse;
   [WorldStateMessageType.GET_BLOCK_NUMBERS_FOR_LEAF_INDICES]: GetBlockNumbersForLeafIndicesResponse;
 
   [WorldStateMessageType.FIND_LEAF_INDICES]: FindLeafIndicesResponse;
@@ -515,6 +572,11 @@ export type WorldStateResponse = {
 
   [WorldStateMessageType.COPY_STORES]: void;
 
+  [WorldStateMessageType.SET_GROUP_COMMIT]: void;
+  [WorldStateMessageType.COMMIT_STAGED_BLOCKS]: WorldStateStatusFull;
+
+  [WorldStateMessageType.CREATE_FORK_FROM_FORK]: CreateForkResponse;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
@@ -12,6 +12,7 @@ import {
 import { timesAsync } from '@aztec/foundation/collection';
 import { EthAddress } from '@aztec/foundation/eth-address';
 import { Fr } from '@aztec/foundation/fields';
+import { sleep } from '@aztec/foundation/sleep';
 import type { SiblingPath } from '@aztec/foundation/trees';
 import { PublicDataWrite } from '@aztec/stdlib/avm';
 import type { L2Block } from '@aztec/stdlib/block';
@@ -153,6 +154,14 @@ describe('NativeWorldState', () => {
       await ws.close();
     });
 
+    const setStoredVersion = async (schemaVersion: number) => {
+      const fullPath = join(dataDir, 'world_state', DatabaseVersionManager.VERSION_FILE);
+      const storedWorldStateVersion = DatabaseVersion.fromBuffer(await readFile(fullPath));
+      expect(storedWorldStateVersion).toBeDefined();
+      const modifiedVersion = new DatabaseVersion(schemaVersion, storedWorldStateVersion!.rollupAddress);
+      await writeFile(fullPath, modifiedVersion.toBuffer());
+    };
+
     it('clears the database if the world state version is different', async () => {
       // open ws against the data again
       let ws = await NativeWorldStateService.new(rollupAddress, dataDir, wsTreeMapSizes);
@@ -168,15 +177,9 @@ describe('NativeWorldState', () => {
       const status = await ws.handleL2BlockAndMessages(block, messages);
       expect(status.summary.unfinalisedBlockNumber).toBe(1n);
       await ws.close();
-      // we open up the version file that was created and modify the version to be older
-      const fullPath = join(dataDir, 'world_state', DatabaseVersionManager.VERSION_FILE);
-      const storedWorldStateVersion = DatabaseVersion.fromBuffer(await readFile(fullPath));
-      expect(storedWorldStateVersion).toBeDefined();
-      const modifiedVersion = new DatabaseVersion(
-        storedWorldStateVersion!.schemaVersion - 1,
-        storedWorldStateVersion!.rollupAddress,
-      );
-      await writeFile(fullPath, modifiedVersion.toBuffer());
+      // we open up the version file that was created and modify the version to be newer, as if it had been written
+      // by software we can't downgrade from
+      await setStoredVersion(WORLD_STATE_DB_VERSION + 1);
 
       // Open the world state again and it should be empty
       ws = await NativeWorldStateService.new(rollupAddress, dataDir, wsTreeMapSizes);
@@ -186,6 +189,27 @@ describe('NativeWorldState', () => {
       await ws.close();
     });
 
+    it('upgrades a version 1 database in place', async () => {
+      let ws = await NativeWorldStateService.new(rollupAddress, dataDir, wsTreeMapSizes);
+      const fork = await ws.fork();
+      ({ block, messages } = await mockBlock(1, 2, fork));
+      await fork.close();
+      await ws.handleL2BlockAndMessages(block, messages);
+      await ws.close();
+
+      // Only the stored version is old here: reading version 1 records is covered by the lmdb_tree_store tests
+      await setStoredVersion(1);
+      ws = await NativeWorldStateService.new(rollupAddress, dataDir, wsTreeMapSizes);
+      expect((await ws.getStatusSummary()).unfinalisedBlockNumber).toBe(1n);
+      await expect(findLeafIndex(block.body.txEffects[0].noteHashes[0], ws)).resolves.toBeDefined();
+      await ws.close();
+
+      const storedVersion = DatabaseVersion.fromBuffer(
+        await readFile(join(dataDir, 'world_state', DatabaseVersionManager.VERSION_FILE)),
+      );
+      expect(storedVersion.schemaVersion).toBe(WORLD_STATE_DB_VERSION);
+    });
+
     it('fails to sync further blocks if trees are out of sync', async () => {
       // open ws against the same data dir but a different rollup and with a small max db size
       const rollupAddress = EthAddress.random();
@@ -323,6 +347,51 @@ describe('NativeWorldState', () => {
     });
   });
 
+  describe('Group commit', () => {
+    let ws: NativeWorldStateService;
+
+    beforeEach(async () => {
+      ws = await NativeWorldStateService.new(EthAddress.random(), dataDir, wsTreeMapSizes);
+    }, 30_000);
+
+    afterEach(async () => {
+      await ws.close();
+    });
+
+    it('commits staged blocks once the maximum delay has passed without a further block', async () => {
+      const fork = await ws.fork();
+      await ws.setGroupCommit(10, 100);
+      const committedArchive = await ws.getCommitted().getTreeInfo(MerkleTreeId.ARCHIVE);
+
+      const { block, messages } = await mockBlock(1, 1, fork);
+      const status = await ws.handleL2BlockAndMessages(block, messages);
+      expect(status.groupCommit.numStagedBlocks).toBe(1n);
+      expect(await ws.getCommitted().getTreeInfo(MerkleTreeId.ARCHIVE)).toEqual(committedArchive);
+
+      await sleep(500);
+      const archive = await ws.getCommitted().getTreeInfo(MerkleTreeId.ARCHIVE);
+      expect(archive.size).toBe(committedArchive.size + 1n);
+      await fork.close();
+    });
+
+    it('leaves blocks staged without a maximum delay until they are committed', async () => {
+      const fork = await ws.fork();
+      await ws.setGroupCommit(10);
+      const committedArchive = await ws.getCommitted().getTreeInfo(MerkleTreeId.ARCHIVE);
+
+      const { block, messages } = await mockBlock(1, 1, fork);
+      await ws.handleL2BlockAndMessages(block, messages);
+      await sleep(200);
+      expect(await ws.getCommitted().getTreeInfo(MerkleTreeId.ARCHIVE)).toEqual(committedArchive);
+
+      const status = await ws.commitStagedBlocks();
+      expect(status.groupCommit).toEqual({ committedBlockNumber: 1n, numStagedBlocks: 0n });
+      const archive = await ws.getCommitted().getTreeInfo(MerkleTreeId.ARCHIVE);
+      expect(archive.size).toBe(committedArchive.size + 1n);
+      await fork.close();
+    });
+  });
+
   describe('Pending and Proven chain', () => {
     let ws: NativeWorldStateService;
 
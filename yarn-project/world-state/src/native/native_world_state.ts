@@ -16,7 +16,7 @@ import { BlockHeader, PartialStateReference, StateReference } from '@aztec/stdli
 import { getTelemetryClient } from '@aztec/telemetry-client';
 
 import assert from 'assert/strict';
-import { mkdtemp, rm } from 'fs/promises';
+import { mkdir, mkdtemp, rm } from 'fs/promises';
 import { tmpdir } from 'os';
 import { join } from 'path';
 
@@ -38,7 +38,29 @@ import { NativeWorldState } from './native_world_state_instance.js';
 
 // The current version of the world state database schema
 // Increment this when making incompatible changes to the database schema
-export const WORLD_STATE_DB_VERSION = 1; // The initial version
+// Version 2 stores tree nodes and indexed leaf pre-images as fixed width records (barretenberg's
+// lmdb_store/record_codec.hpp) instead of msgpack. It still reads the msgpack records of version 1 and re-encodes
+// them as they are next written, so a version 1 database is upgraded in place without rewriting it. The migration is
+// one way: software of version 1 cannot read the new records, so it resets a version 2 database.
+export const WORLD_STATE_DB_VERSION = 2;
+
+/**
+ * Upgrades a world state database from an older schema version. Only version 1 is upgradable, see
+ * WORLD_STATE_DB_VERSION; any other database is reset.
+ */
+async function upgradeWorldStateDb(dataDir: string, storedVersion: number, latestVersion: number) {
+  if (storedVersion === 1 && latestVersion === 2) {
+    return;
+  }
+  if (storedVersion === 0) {
+    // There is no version file, either because the directory is new or because its contents are of unknown origin.
+    // Start from an empty directory, as the version manager does without an upgrade callback.
+    await rm(dataDir, { recursive: true, force: true, maxRetries: 3 });
+    await mkdir(dataDir, { recursive: true });
+    return;
+  }
+  throw new Error(`Can't upgrade world state from version ${storedVersion} to ${latestVersion}`);
+}
 
 export const WORLD_STATE_DIR = 'world_state';
 
@@ -46,6 +68,9 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
   protected initialHeader: BlockHeader | undefined;
   // This is read heavily and only changes when data is persisted, so we cache it
   private cachedStatusSummary: WorldStateStatusSummary | undefined;
+  // The maximum time a staged block may wait to be committed, see setGroupCommit
+  private groupCommitMaxDelayMs = 0;
+  private stagedBlocksCommitTimer: NodeJS.Timeout | undefined;
 
   protected constructor(
     protected readonly instance: NativeWorldState,
@@ -72,6 +97,7 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
       onOpen: (dir: string) => {
         return Promise.resolve(new NativeWorldState(dir, wsTreeMapSizes, prefilledPublicData, instrumentation));
       },
+      onUpgrade: upgradeWorldStateDb,
     });
 
     const [instance] = await versionManager.open();
@@ -180,7 +206,7 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
     });
 
     try {
-      return await this.instance.call(
+      const status = await this.instance.call(
         WorldStateMessageType.SYNC_BLOCK,
         {
           blockNumber: l2Block.number,
@@ -195,6 +221,44 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
         this.sanitiseAndCacheSummaryFromFull.bind(this),
         this.deleteCachedSummary.bind(this),
       );
+      this.scheduleStagedBlocksCommit(status);
+      return status;
+    } catch (err) {
+      this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
+      throw err;
+    }
+  }
+
+  /**
+   * Lets block sync stage up to maxBlocks blocks in memory and commit them together, in a single write transaction per
+   * tree, rather than committing each block as it is synched. Intended for catching up with the chain, where the sync
+   * is bound by the latency of each commit. Staged blocks are only visible to reads of uncommitted state, and need to
+   * be synched again if the process exits before they are committed. See GroupCommitStatus.
+   * The native world state only checks maxDelayMs when the next block is synched, so this service also commits the
+   * staged blocks once the first of them has waited maxDelayMs, in case sync stalls. Without a maxDelayMs, blocks stay
+   * staged until maxBlocks are synched, an operation needs the committed chain, or commitStagedBlocks is called.
+   * @param maxBlocks - The maximum number of blocks committed together, 1 commits every block as it is synched
+   * @param maxDelayMs - The maximum time the first staged block may wait to be committed, zero for no limit
+   */
+  public async setGroupCommit(maxBlocks: number, maxDelayMs = 0): Promise<void> {
+    this.clearStagedBlocksCommitTimer();
+    await this.instance.call(WorldStateMessageType.SET_GROUP_COMMIT, { maxBlocks, maxDelayMs, canonical: true });
+    this.groupCommitMaxDelayMs = maxDelayMs;
+  }
+
+  /**
+   * Commits any blocks staged by block sync
+   * @returns The new WorldStateStatus
+   */
+  public async commitStagedBlocks(): Promise<WorldStateStatusFull> {
+    this.clearStagedBlocksCommitTimer();
+    try {
+      return await this.instance.call(
+        WorldStateMessageType.COMMIT_STAGED_BLOCKS,
+        { canonical: true },
+        this.sanitiseAndCacheSummaryFromFull.bind(this),
+        this.deleteCachedSummary.bind(this),
+      );
     } catch (err) {
       this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
       throw err;
@@ -202,10 +266,34 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
   }
 
   public async close(): Promise<void> {
+    // the native module commits any staged blocks on close
+    this.clearStagedBlocksCommitTimer();
     await this.instance.close();
     await this.cleanup();
   }
 
+  /**
+   * Arms the commit of the staged blocks when the first of them has been staged, see setGroupCommit
+   */
+  private scheduleStagedBlocksCommit(status: WorldStateStatusFull) {
+    if (status.groupCommit.numStagedBlocks === 0n) {
+      this.clearStagedBlocksCommitTimer();
+      return;
+    }
+    if (this.groupCommitMaxDelayMs === 0 || this.stagedBlocksCommitTimer) {
+      return;
+    }
+    this.stagedBlocksCommitTimer = setTimeout(() => {
+      this.stagedBlocksCommitTimer = undefined;
+      this.commitStagedBlocks().catch(err => this.log.error(`Failed to commit staged blocks: ${err}`));
+    }, this.groupCommitMaxDelayMs);
+  }
+
+  private clearStagedBlocksCommitTimer() {
+    clearTimeout(this.stagedBlocksCommitTimer);
+    this.stagedBlocksCommitTimer = undefined;
+  }
+
   private async buildInitialHeader(): Promise<BlockHeader> {
     const state = await this.getInitialStateReference();
     return BlockHeader.empty({ state });
@@ -41,6 +41,9 @@ export const MUTATING_MSG_TYPES = new Set([
   WorldStateMessageType.CREATE_CHECKPOINT,
   WorldStateMessageType.COMMIT_CHECKPOINT,
   WorldStateMessageType.REVERT_CHECKPOINT,
+  WorldStateMessageType.SET_GROUP_COMMIT,
+  WorldStateMessageType.COMMIT_STAGED_BLOCKS,
+  WorldStateMessageType.CREATE_FORK_FROM_FORK,
 ]);
 
 // This class implements the per-fork operation queue